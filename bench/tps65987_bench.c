@@ -0,0 +1,861 @@
+/**
+*  @file      tps65987_bench.c
+*  @brief     tps65987 flash upgrade benchmark, runs against the simulated controller
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+/*
+* Every run upgrades the simulated controller from the -02 image to the -08
+* one and prints one JSON object per line on stdout (or -o file), the driver
+* log goes to -l file (default /dev/null):
+*
+*   {"image":"low-region","size":13504,"run":0,"result":0,"verified":1,
+*    "total_us":..,"phase_us":{"pre_ops":..,..,"reset":..},"port_down_us":..,
+*    "port_disable_us":..,"boot_us":..,
+*    "payload_bytes":..,"payload_Bps":..,"eff_100k":..,"eff_400k":..,
+*    "transfers":..,"msgs":..,"bus_bytes":..,"errors":..}
+*
+* --delta first upgrades to the -02 image (unmeasured, full write) so that the
+* sector map of the last verified write is there, as on a device, then runs
+* the measured -02 -> -08 upgrade against it; "full_rewrites" counts the
+* regions written whole again because FLvy failed after the delta write.
+*
+* eff_100k/eff_400k compare payload_Bps with what the bus could carry at all:
+* 9 bit times per byte, so 11111 B/s at 100kHz and 44444 B/s at 400kHz.
+*
+* --interrupt <n> cuts the power after <n> FLwd, powers the controller up
+* again and runs the upgrade a second time, which resumes from the journal;
+* "resumed_payload_bytes" is what the second run had to write.
+*
+* --deferred returns from the upgrade once the new image runs and copies the
+* other region after that: "new_fw_us" is until the switch over, "copy_us"
+* the copy.
+*
+* --flwd-errors <n>[,<burst>] fails every <n>th FLwd half way, and <burst>
+* attempts in a row from there; the upgrade retries the chunk and, when the
+* retries run out, erases its sector again:
+*   ..,"retried_chunks":..,"reerased_sectors":..,"retried_cmds":..,"chunk_errors":{"bus":..,..}
+*
+* --host-patch boots a controller with an empty flash (PTCH mode) from the
+* -08 image over the bus instead (see tps65987_dev_host_patch()):
+*   {"image":"low-region","run":0,"host_patch":1,"result":0,"running":1,
+*    "patch_us":..,"patch_bytes":..,"transfers":..,"msgs":..,"bus_bytes":..}
+*
+* --config <from.cfg>,<to.cfg> benchmarks a configuration change instead:
+* the simulated controller gets <from.cfg>, then only the registers of
+* <to.cfg> that differ are written (see src/tps65987_config.h):
+*   {"image":"config","run":0,"result":0,"regs":..,"skipped":..,"changed":..,
+*    "changed_bytes":..,"written_bytes":..,"read_us":..,"write_us":..,
+*    "total_us":..,"transfers":..,"msgs":..,"bus_bytes":..}
+*
+* --faults <spec> puts the fault injecting transport between the driver and
+* the simulator (see src/tps65987_fault.h), with the seed advanced every run;
+* every run adds what was injected and the retries, and after all runs one
+* summary line per image gives the success rate and the upgrade time of the
+* runs that succeeded:
+*   ..,"faults":{"nack":..,"io":..,"delay":..,"reject":..,"unknown":..,"flwd":..,"flvy":..}}
+*   {"image":"low-region","summary":1,"runs":..,"succeeded":..,"success_rate":..,
+*    "mean_us":..,"p50_us":..,"p99_us":..,"max_us":..,"retried_chunks":..,
+*    "reerased_sectors":..,"retried_cmds":..,"chunk_errors":{..},"faults":{..}}
+*
+* --status-probe <us> reads Status from a second thread every <us> during the
+* upgrade, on the same bus, and adds its latency:
+*   ..,"status_reads":..,"status_p50_us":..,"status_p99_us":..,"status_max_us":..}
+*/
+
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include<unistd.h>
+#include<pthread.h>
+#include<stdatomic.h>
+
+#include "tps65987_drv.h"
+#include "tps65987_latency.h"
+#include "tps65987_transport.h"
+#include "tps65987_sim.h"
+#include "tps65987_config.h"
+#include "tps65987_fault.h"
+
+#ifndef BENCH_IMAGE_DIR
+#define BENCH_IMAGE_DIR "/data/ota-file"
+#endif
+
+#define  BENCH_PATH_LEN     512
+
+typedef struct
+{
+    const char  *name;
+    const char  *from_file;
+    const char  *to_file;
+} s_BENCH_case;
+
+static const s_BENCH_case bench_cases[] =
+{
+    { "low-region",  "low-region-flash-02.bin", "low-region-flash-08.bin" },
+    { "full-region", "full-region-02.bin",      "full-region-08.bin" },
+};
+
+#define  BENCH_NUM_CASES    (sizeof(bench_cases) / sizeof(bench_cases[0]))
+
+#define  PROBE_MAX_SAMPLES  200000
+
+/*
+* status reads concurrent with the upgrade, see --status-probe
+*/
+typedef struct
+{
+    s_TPS_dev           *dev;
+    unsigned int        interval_us;
+
+    atomic_int          stop;
+
+    unsigned int        *samples;
+    unsigned int        num_samples;
+} s_BENCH_probe;
+
+static unsigned int probe_interval_us = 0;
+
+static unsigned int interrupt_after_flwd = 0;
+static unsigned int flwd_error_every = 0;
+static unsigned int flwd_error_burst = 1;
+
+static const char *config_files = NULL;
+static int host_patch = 0;
+
+static const char *fault_spec = NULL;
+static s_TPS_fault_config fault_cfg;
+
+/*
+* --faults: all runs of one image
+*/
+typedef struct
+{
+    unsigned int        runs;
+    unsigned int        succeeded;
+    unsigned int        *total_us;          //of the runs that succeeded
+    unsigned int        retried_chunks;
+    unsigned int        reerased_sectors;
+    unsigned int        retried_cmds;
+    unsigned int        errors[TPS_ERR_NUM];
+    s_TPS_fault_stats   faults;
+} s_BENCH_summary;
+
+#define  BENCH_JOURNAL_FILE "/tmp/tps65987-bench-journal.bin"
+#define  BENCH_SECTOR_MAP   BENCH_JOURNAL_FILE SECTOR_MAP_SUFFIX
+
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-n runs] [-b bus_hz] [-d image_dir] [-o out.jsonl] [-l driver.log] [--delta] [--sparse] [--staged] [--deferred]\n"
+                    "       [--status-probe interval_us] [--interrupt flwd_count]\n"
+                    "       [--flwd-errors every[,burst]] [--config from.cfg,to.cfg] [--host-patch]\n"
+                    "       [--faults nack=r,io=r,delay=r:us,reject=r,unknown=r,flwd=r,flvy=r,seed=n]\n", prog);
+}
+
+
+static unsigned char *load_file(const char *file_name, long *p_size)
+{
+    FILE *fp;
+    unsigned char *buf;
+    long size;
+
+    fp = fopen(file_name, "rb");
+    if(fp == NULL)
+    {
+        return NULL;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    rewind(fp);
+
+    buf = malloc(size > 0 ? size : 1);
+    if(buf == NULL || fread(buf, 1, size, fp) != (size_t)size)
+    {
+        free(buf);
+        fclose(fp);
+        return NULL;
+    }
+
+    fclose(fp);
+
+    *p_size = size;
+    return buf;
+}
+
+
+/*
+* both regions must hold the new image after the upgrade
+*/
+static int verify_flash(s_TPS_sim *p_sim, const s_TPS_sim_config *p_cfg, const unsigned char *image, long size)
+{
+    unsigned char *flash = tps65987_sim_flash(p_sim);
+    int region;
+
+    for(region = 0; region < 2; region++)
+    {
+        if(memcmp(&flash[p_cfg->region_addr[region]], image, size) != 0)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+
+static void *probe_thread(void *arg)
+{
+    s_BENCH_probe *p_probe = arg;
+    unsigned char buf[8];
+    unsigned long long start;
+
+    while(!atomic_load(&p_probe->stop) && p_probe->num_samples < PROBE_MAX_SAMPLES)
+    {
+        start = tps65987_now_us();
+
+        //NACKs while the controller resets count as well, the time is what matters
+        tps65987_dev_read(p_probe->dev, REG_Status, buf, sizeof(buf));
+
+        p_probe->samples[p_probe->num_samples++] = tps65987_now_us() - start;
+
+        tps65987_sleep_us(p_probe->interval_us);
+    }
+
+    return NULL;
+}
+
+
+static int cmp_uint(const void *a, const void *b)
+{
+    unsigned int x = *(const unsigned int *)a;
+    unsigned int y = *(const unsigned int *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+
+static void print_probe(FILE *out, s_BENCH_probe *p_probe)
+{
+    unsigned int n = p_probe->num_samples;
+
+    qsort(p_probe->samples, n, sizeof(p_probe->samples[0]), cmp_uint);
+
+    fprintf(out, ",\"status_reads\":%u,\"status_p50_us\":%u,\"status_p99_us\":%u,\"status_max_us\":%u",
+            n, n ? p_probe->samples[n / 2] : 0, n ? p_probe->samples[n * 99 / 100] : 0, n ? p_probe->samples[n - 1] : 0);
+}
+
+
+/*
+* --delta: the upgrade before this one, to the -02 image, on a simulator of
+* its own so none of the injected trouble applies; it leaves the sector map
+* of what the measured simulator starts with
+*/
+static int write_sector_map(char *from_path)
+{
+    s_TPS_sim_config sim_cfg;
+    s_TPS_sim *p_sim;
+    int result;
+
+    unlink(BENCH_JOURNAL_FILE);
+    unlink(BENCH_SECTOR_MAP);
+
+    tps65987_sim_default_config(&sim_cfg);
+    sim_cfg.i2c_addr = I2C_ADDR;
+    sim_cfg.bus_hz = 0;
+
+    p_sim = tps65987_sim_create(&sim_cfg);
+    if(p_sim == NULL || tps65987_sim_load_image_file(p_sim, from_path) != 0)
+    {
+        tps65987_sim_destroy(p_sim);
+        return -1;
+    }
+
+    tps65987_set_transport(tps65987_sim_transport(p_sim));
+    tps65987_set_journal(BENCH_JOURNAL_FILE);
+    tps65987_set_upgrade_flags(0);
+
+    result = tps65987_ext_flash_upgrade(from_path);
+    fflush(stdout);
+
+    tps65987_close_transport();
+    tps65987_sim_destroy(p_sim);
+
+    return result;
+}
+
+
+static void print_faults(FILE *out, const s_TPS_fault_stats *p_faults)
+{
+    fprintf(out, ",\"faults\":{\"nack\":%llu,\"io\":%llu,\"delay\":%llu,\"reject\":%llu,\"unknown\":%llu,\"flwd\":%llu,\"flvy\":%llu}",
+            p_faults->nacks, p_faults->io_errors, p_faults->delays, p_faults->cmd_rejects, p_faults->cmd_unknowns,
+            p_faults->flwd_fails, p_faults->flvy_fails);
+}
+
+
+static void print_chunk_errors(FILE *out, unsigned int retried_chunks, unsigned int reerased_sectors, unsigned int retried_cmds,
+                               const unsigned int *errors)
+{
+    int err;
+
+    fprintf(out, ",\"retried_chunks\":%u,\"reerased_sectors\":%u,\"retried_cmds\":%u,\"chunk_errors\":{",
+            retried_chunks, reerased_sectors, retried_cmds);
+    for(err = TPS_ERR_BUS; err < TPS_ERR_NUM; err++)
+    {
+        fprintf(out, "%s\"%s\":%u", err != TPS_ERR_BUS ? "," : "", tps65987_error_name(err), errors[err]);
+    }
+    fprintf(out, "}");
+}
+
+
+static void print_summary(FILE *out, const s_BENCH_case *p_case, s_BENCH_summary *p_sum)
+{
+    unsigned int n = p_sum->succeeded;
+    unsigned long long sum = 0;
+    unsigned int i;
+
+    qsort(p_sum->total_us, n, sizeof(p_sum->total_us[0]), cmp_uint);
+
+    for(i = 0; i < n; i++)
+    {
+        sum += p_sum->total_us[i];
+    }
+
+    fprintf(out, "{\"image\":\"%s\",\"summary\":1,\"runs\":%u,\"succeeded\":%u,\"success_rate\":%.4f,"
+            "\"mean_us\":%llu,\"p50_us\":%u,\"p99_us\":%u,\"max_us\":%u",
+            p_case->name, p_sum->runs, n, p_sum->runs ? (double)n / p_sum->runs : 0.0,
+            n ? sum / n : 0, n ? p_sum->total_us[n / 2] : 0, n ? p_sum->total_us[n * 99 / 100] : 0, n ? p_sum->total_us[n - 1] : 0);
+    print_chunk_errors(out, p_sum->retried_chunks, p_sum->reerased_sectors, p_sum->retried_cmds, p_sum->errors);
+    print_faults(out, &p_sum->faults);
+    fprintf(out, "}\n");
+    fflush(out);
+}
+
+
+static void add_faults(s_TPS_fault_stats *p_sum, const s_TPS_fault_stats *p_faults)
+{
+    p_sum->transfers += p_faults->transfers;
+    p_sum->nacks += p_faults->nacks;
+    p_sum->io_errors += p_faults->io_errors;
+    p_sum->delays += p_faults->delays;
+    p_sum->cmd_rejects += p_faults->cmd_rejects;
+    p_sum->cmd_unknowns += p_faults->cmd_unknowns;
+    p_sum->flwd_fails += p_faults->flwd_fails;
+    p_sum->flvy_fails += p_faults->flvy_fails;
+}
+
+
+static int run_case(FILE *out, const s_BENCH_case *p_case, const char *image_dir, int run,
+                    unsigned int bus_hz, unsigned int upgrade_flags, s_BENCH_summary *p_sum)
+{
+    char from_path[BENCH_PATH_LEN];
+    char to_path[BENCH_PATH_LEN];
+
+    s_TPS_sim_config sim_cfg;
+    s_TPS_sim *p_sim;
+    s_TPS_transport *p_transport;
+    s_TPS_transport *p_bus;
+    const s_TPS_upgrade_stats *p_stats;
+
+    s_TPS_transport *p_fault = NULL;
+    s_TPS_fault_config fault_run_cfg;
+    s_TPS_fault_stats faults;
+
+    s_BENCH_probe probe;
+    pthread_t probe_tid;
+
+    unsigned char *image;
+    long size;
+    int result;
+    int verified;
+    int phase;
+    double payload_Bps;
+    unsigned long long new_fw_us;
+    unsigned long long copy_us;
+
+    snprintf(from_path, sizeof(from_path), "%s/%s", image_dir, p_case->from_file);
+    snprintf(to_path, sizeof(to_path), "%s/%s", image_dir, p_case->to_file);
+
+    image = load_file(to_path, &size);
+    if(image == NULL)
+    {
+        fprintf(stderr, "fail to load %s\n", to_path);
+        return -1;
+    }
+
+    tps65987_sim_default_config(&sim_cfg);
+    sim_cfg.i2c_addr = I2C_ADDR;
+    sim_cfg.bus_hz = bus_hz;
+    sim_cfg.power_cut_after_flwd = interrupt_after_flwd;
+    sim_cfg.flwd_error_every = flwd_error_every;
+    sim_cfg.flwd_error_burst = flwd_error_burst;
+
+    p_sim = tps65987_sim_create(&sim_cfg);
+    if(p_sim == NULL || tps65987_sim_load_image_file(p_sim, from_path) != 0)
+    {
+        fprintf(stderr, "fail to set up the simulator with %s\n", from_path);
+        tps65987_sim_destroy(p_sim);
+        free(image);
+        return -1;
+    }
+
+    //the sim transport counts what really went over the bus, faults or not
+    p_transport = tps65987_sim_transport(p_sim);
+    p_bus = p_transport;
+
+    if((upgrade_flags & UPGRADE_FLAG_DELTA) && write_sector_map(from_path) != 0)
+    {
+        fprintf(stderr, "fail to write %s for --delta\n", from_path);
+    }
+
+    if(fault_spec != NULL)
+    {
+        fault_run_cfg = fault_cfg;
+        fault_run_cfg.seed += run;
+
+        p_fault = tps65987_fault_transport(p_transport, &fault_run_cfg);
+        p_bus = p_fault;
+    }
+
+    tps65987_set_transport(p_bus);
+
+    memset(&probe, 0, sizeof(probe));
+
+    if(probe_interval_us != 0)
+    {
+        probe.interval_us = probe_interval_us;
+        probe.samples = malloc(PROBE_MAX_SAMPLES * sizeof(probe.samples[0]));
+
+        probe.dev = tps65987_dev_create("probe", p_bus, I2C_ADDR);
+
+        pthread_create(&probe_tid, NULL, probe_thread, &probe);
+    }
+
+    tps65987_latency_reset(&tps65987_default_dev()->latency);
+    tps65987_set_upgrade_flags(upgrade_flags);
+
+    if(interrupt_after_flwd != 0)
+    {
+        unlink(BENCH_JOURNAL_FILE);
+        tps65987_set_journal(BENCH_JOURNAL_FILE);
+
+        //fails at the power cut, the journal stays
+        if(tps65987_ext_flash_upgrade(to_path) == 0)
+        {
+            tps65987_copy_region();
+        }
+        fflush(stdout);
+
+        tps65987_sim_reset(p_sim);
+        p_transport->transfers = 0;
+        p_transport->msgs = 0;
+        p_transport->bytes = 0;
+        p_transport->errors = 0;
+    }
+
+    result = tps65987_ext_flash_upgrade(to_path);
+    fflush(stdout);
+
+    //--deferred: the new image runs from here on, then the copy
+    new_fw_us = tps65987_get_upgrade_stats()->total_us;
+    copy_us = tps65987_now_us();
+
+    if(result == 0 && tps65987_copy_region() != 0)
+    {
+        result = -1;
+    }
+
+    copy_us = tps65987_now_us() - copy_us;
+    fflush(stdout);
+
+    if(probe_interval_us != 0)
+    {
+        atomic_store(&probe.stop, 1);
+        pthread_join(probe_tid, NULL);
+    }
+
+    p_stats = tps65987_get_upgrade_stats();
+    verified = verify_flash(p_sim, &sim_cfg, image, size);
+
+    payload_Bps = p_stats->total_us ? p_stats->payload_bytes * 1000000.0 / p_stats->total_us : 0.0;
+
+    fprintf(out, "{\"image\":\"%s\",\"size\":%ld,\"run\":%d,\"bus_hz\":%u,\"flags\":%u,\"result\":%d,\"verified\":%d,",
+            p_case->name, size, run, bus_hz, upgrade_flags, result, verified);
+    fprintf(out, "\"total_us\":%llu,\"phase_us\":{", p_stats->total_us);
+    for(phase = 0; phase < UPGRADE_PHASE_NUM; phase++)
+    {
+        fprintf(out, "%s\"%s\":%llu", phase ? "," : "", tps65987_upgrade_phase_name(phase), p_stats->phase_us[phase]);
+    }
+    fprintf(out, "},\"port_down_us\":%llu,\"port_disable_us\":%llu,\"boot_us\":%llu,\"payload_bytes\":%u,\"written_chunks\":%u,\"skipped_chunks\":%u,",
+            p_stats->port_down_us, p_stats->port_disable_us, p_stats->boot_us, p_stats->payload_bytes, p_stats->written_chunks, p_stats->skipped_chunks);
+    fprintf(out, "\"payload_Bps\":%.0f,\"eff_100k\":%.4f,\"eff_400k\":%.4f,",
+            payload_Bps, payload_Bps / (100000.0 / 9), payload_Bps / (400000.0 / 9));
+    fprintf(out, "\"transfers\":%llu,\"msgs\":%llu,\"bus_bytes\":%llu,\"errors\":%llu",
+            p_transport->transfers, p_transport->msgs, p_transport->bytes, p_transport->errors);
+
+    if(upgrade_flags & UPGRADE_FLAG_DEFERRED)
+    {
+        fprintf(out, ",\"new_fw_us\":%llu,\"copy_us\":%llu", new_fw_us, copy_us);
+    }
+
+    if(upgrade_flags & UPGRADE_FLAG_DELTA)
+    {
+        fprintf(out, ",\"full_rewrites\":%u", p_stats->full_rewrites);
+    }
+
+    if(interrupt_after_flwd != 0)
+    {
+        fprintf(out, ",\"interrupt_after_flwd\":%u,\"resumed_payload_bytes\":%u", interrupt_after_flwd, p_stats->payload_bytes);
+    }
+
+    tps65987_set_journal(NULL);
+
+    if(flwd_error_every != 0 || p_fault != NULL)
+    {
+        print_chunk_errors(out, p_stats->retried_chunks, p_stats->reerased_sectors, p_stats->retried_cmds, p_stats->errors);
+    }
+
+    if(p_fault != NULL)
+    {
+        tps65987_fault_get_stats(p_fault, &faults);
+        print_faults(out, &faults);
+
+        p_sum->runs++;
+        if(result == 0 && verified)
+        {
+            p_sum->total_us[p_sum->succeeded++] = p_stats->total_us;
+        }
+        p_sum->retried_chunks += p_stats->retried_chunks;
+        p_sum->reerased_sectors += p_stats->reerased_sectors;
+        p_sum->retried_cmds += p_stats->retried_cmds;
+        for(phase = TPS_ERR_BUS; phase < TPS_ERR_NUM; phase++)
+        {
+            p_sum->errors[phase] += p_stats->errors[phase];
+        }
+        add_faults(&p_sum->faults, &faults);
+    }
+
+    if(probe_interval_us != 0)
+    {
+        print_probe(out, &probe);
+        tps65987_dev_destroy(probe.dev);
+        free(probe.samples);
+    }
+
+    fprintf(out, "}\n");
+    fflush(out);
+
+    tps65987_close_transport();
+    tps65987_sim_destroy(p_sim);
+    free(image);
+
+    return (result == 0 && verified) ? 0 : -1;
+}
+
+
+/*
+* --host-patch: from power up with nothing in the flash to the application
+*/
+static int run_patch_case(FILE *out, const s_BENCH_case *p_case, const char *image_dir, int run, unsigned int bus_hz)
+{
+    char to_path[BENCH_PATH_LEN];
+    unsigned char mode[4] = {0};
+
+    s_TPS_sim_config sim_cfg;
+    s_TPS_sim *p_sim;
+    s_TPS_transport *p_transport;
+    const s_TPS_upgrade_stats *p_stats;
+    int result;
+
+    snprintf(to_path, sizeof(to_path), "%s/%s", image_dir, p_case->to_file);
+
+    tps65987_sim_default_config(&sim_cfg);
+    sim_cfg.i2c_addr = I2C_ADDR;
+    sim_cfg.bus_hz = bus_hz;
+
+    p_sim = tps65987_sim_create(&sim_cfg);
+    if(p_sim == NULL)
+    {
+        return -1;
+    }
+
+    p_transport = tps65987_sim_transport(p_sim);
+    tps65987_set_transport(p_transport);
+
+    result = tps65987_host_patch_bundle(to_path);
+    tps65987_i2c_read(I2C_ADDR, REG_MODE, mode, 4);
+    fflush(stdout);
+
+    p_stats = tps65987_get_upgrade_stats();
+
+    fprintf(out, "{\"image\":\"%s\",\"run\":%d,\"bus_hz\":%u,\"host_patch\":1,\"result\":%d,\"running\":%d,"
+            "\"patch_us\":%llu,\"patch_bytes\":%u,",
+            p_case->name, run, bus_hz, result, memcmp(mode, "APP ", 4) == 0, p_stats->patch_us, p_stats->patch_bytes);
+    fprintf(out, "\"transfers\":%llu,\"msgs\":%llu,\"bus_bytes\":%llu}\n",
+            p_transport->transfers, p_transport->msgs, p_transport->bytes);
+    fflush(out);
+
+    tps65987_close_transport();
+    tps65987_sim_destroy(p_sim);
+
+    return result;
+}
+
+
+/*
+* --config: the bus time of going from one configuration to the other, on
+* a controller running the -02 image
+*/
+static int run_config_case(FILE *out, const char *image_dir, int run, unsigned int bus_hz)
+{
+    char image_path[BENCH_PATH_LEN];
+    char from_path[BENCH_PATH_LEN];
+    const char *to_path;
+
+    s_TPS_sim_config sim_cfg;
+    s_TPS_sim *p_sim;
+    s_TPS_transport *p_transport;
+    s_TPS_config from;
+    s_TPS_config to;
+    s_TPS_config_stats stats;
+    unsigned long long start;
+    unsigned long long total_us;
+    int result;
+
+    to_path = strchr(config_files, ',');
+    if(to_path == NULL || to_path - config_files >= BENCH_PATH_LEN)
+    {
+        fprintf(stderr, "--config wants from.cfg,to.cfg\n");
+        return -1;
+    }
+
+    memcpy(from_path, config_files, to_path - config_files);
+    from_path[to_path - config_files] = 0;
+    to_path++;
+
+    if(tps65987_config_load(from_path, &from) != 0 || tps65987_config_load(to_path, &to) != 0)
+    {
+        fprintf(stderr, "fail to load %s\n", config_files);
+        return -1;
+    }
+
+    tps65987_sim_default_config(&sim_cfg);
+    sim_cfg.i2c_addr = I2C_ADDR;
+    sim_cfg.bus_hz = bus_hz;
+
+    snprintf(image_path, sizeof(image_path), "%s/%s", image_dir, bench_cases[0].from_file);
+
+    p_sim = tps65987_sim_create(&sim_cfg);
+    if(p_sim == NULL || tps65987_sim_load_image_file(p_sim, image_path) != 0)
+    {
+        fprintf(stderr, "fail to set up the simulator with %s\n", image_path);
+        tps65987_sim_destroy(p_sim);
+        return -1;
+    }
+
+    p_transport = tps65987_sim_transport(p_sim);
+    tps65987_set_transport(p_transport);
+
+    result = tps65987_dev_config_apply(tps65987_default_dev(), &from, 0, &stats);
+
+    p_transport->transfers = 0;
+    p_transport->msgs = 0;
+    p_transport->bytes = 0;
+
+    start = tps65987_now_us();
+    if(result == 0)
+    {
+        result = tps65987_dev_config_apply(tps65987_default_dev(), &to, 0, &stats);
+    }
+    total_us = tps65987_now_us() - start;
+
+    fprintf(out, "{\"image\":\"config\",\"run\":%d,\"bus_hz\":%u,\"result\":%d,\"regs\":%u,\"skipped\":%u,\"changed\":%u,"
+            "\"changed_bytes\":%u,\"written_bytes\":%u,\"read_us\":%llu,\"write_us\":%llu,\"total_us\":%llu,",
+            run, bus_hz, result, stats.regs, stats.skipped, stats.changed, stats.changed_bytes, stats.written_bytes,
+            stats.read_us, stats.write_us, total_us);
+    fprintf(out, "\"transfers\":%llu,\"msgs\":%llu,\"bus_bytes\":%llu}\n",
+            p_transport->transfers, p_transport->msgs, p_transport->bytes);
+    fflush(out);
+
+    tps65987_close_transport();
+    tps65987_sim_destroy(p_sim);
+
+    return result;
+}
+
+
+int main(int argc, char* argv[])
+{
+    const char *image_dir = BENCH_IMAGE_DIR;
+    const char *out_file = NULL;
+    const char *log_file = "/dev/null";
+
+    unsigned int bus_hz = 400000;
+    unsigned int upgrade_flags = 0;
+    int runs = 1;
+
+    s_BENCH_summary summaries[BENCH_NUM_CASES];
+
+    FILE *out;
+    int i, run;
+    int ret = 0;
+
+    for(i = 1; i < argc; i++)
+    {
+        if(strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+        {
+            runs = atoi(argv[++i]);
+        }
+        else if(strcmp(argv[i], "-b") == 0 && i + 1 < argc)
+        {
+            bus_hz = strtoul(argv[++i], NULL, 0);
+        }
+        else if(strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+        {
+            image_dir = argv[++i];
+        }
+        else if(strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+        {
+            out_file = argv[++i];
+        }
+        else if(strcmp(argv[i], "-l") == 0 && i + 1 < argc)
+        {
+            log_file = argv[++i];
+        }
+        else if(strcmp(argv[i], "--delta") == 0)
+        {
+            upgrade_flags |= UPGRADE_FLAG_DELTA;
+        }
+        else if(strcmp(argv[i], "--sparse") == 0)
+        {
+            upgrade_flags |= UPGRADE_FLAG_SPARSE;
+        }
+        else if(strcmp(argv[i], "--staged") == 0)
+        {
+            upgrade_flags |= UPGRADE_FLAG_STAGED;
+        }
+        else if(strcmp(argv[i], "--deferred") == 0)
+        {
+            upgrade_flags |= UPGRADE_FLAG_DEFERRED;
+        }
+        else if(strcmp(argv[i], "--status-probe") == 0 && i + 1 < argc)
+        {
+            probe_interval_us = strtoul(argv[++i], NULL, 0);
+        }
+        else if(strcmp(argv[i], "--interrupt") == 0 && i + 1 < argc)
+        {
+            interrupt_after_flwd = strtoul(argv[++i], NULL, 0);
+        }
+        else if(strcmp(argv[i], "--host-patch") == 0)
+        {
+            host_patch = 1;
+        }
+        else if(strcmp(argv[i], "--config") == 0 && i + 1 < argc)
+        {
+            config_files = argv[++i];
+        }
+        else if(strcmp(argv[i], "--faults") == 0 && i + 1 < argc)
+        {
+            fault_spec = argv[++i];
+
+            tps65987_fault_default_config(&fault_cfg);
+            if(tps65987_fault_parse(fault_spec, &fault_cfg) != 0)
+            {
+                fprintf(stderr, "bad --faults %s\n", fault_spec);
+                return -1;
+            }
+        }
+        else if(strcmp(argv[i], "--flwd-errors") == 0 && i + 1 < argc)
+        {
+            char *end;
+
+            flwd_error_every = strtoul(argv[++i], &end, 0);
+            if(*end == ',')
+            {
+                flwd_error_burst = strtoul(end + 1, NULL, 0);
+            }
+        }
+        else
+        {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+
+    /*
+    * the driver logs to stdout, keep the results on the original one
+    */
+    if(out_file != NULL)
+    {
+        out = fopen(out_file, "w");
+    }
+    else
+    {
+        out = fdopen(dup(STDOUT_FILENO), "w");
+    }
+
+    if(out == NULL)
+    {
+        fprintf(stderr, "fail to open the result file\n");
+        return -1;
+    }
+
+    if(freopen(log_file, "w", stdout) == NULL)
+    {
+        fprintf(stderr, "fail to open %s\n", log_file);
+        return -1;
+    }
+
+    I2C_ADDR = 0x38;
+
+    memset(summaries, 0, sizeof(summaries));
+    for(i = 0; i < BENCH_NUM_CASES; i++)
+    {
+        summaries[i].total_us = calloc(runs > 0 ? runs : 1, sizeof(summaries[i].total_us[0]));
+    }
+
+    for(run = 0; run < runs; run++)
+    {
+        if(config_files != NULL)
+        {
+            if(run_config_case(out, image_dir, run, bus_hz) != 0)
+            {
+                ret = -1;
+            }
+            continue;
+        }
+
+        for(i = 0; i < BENCH_NUM_CASES; i++)
+        {
+            if(host_patch)
+            {
+                if(run_patch_case(out, &bench_cases[i], image_dir, run, bus_hz) != 0)
+                {
+                    ret = -1;
+                }
+                continue;
+            }
+
+            if(run_case(out, &bench_cases[i], image_dir, run, bus_hz, upgrade_flags, &summaries[i]) != 0)
+            {
+                ret = -1;
+            }
+        }
+    }
+
+    for(i = 0; i < BENCH_NUM_CASES; i++)
+    {
+        if(fault_spec != NULL && config_files == NULL && !host_patch)
+        {
+            print_summary(out, &bench_cases[i], &summaries[i]);
+        }
+        free(summaries[i].total_us);
+    }
+
+    fclose(out);
+
+    return ret;
+}
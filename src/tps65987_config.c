@@ -0,0 +1,270 @@
+/**
+*  @file      tps65987_config.c
+*  @brief     tps65987 application configuration applied as register diffs
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+
+#include "tps65987_config.h"
+#include "tps65987_latency.h"
+#include "tps65987_regmap.h"
+#include "tps65987_xact.h"
+
+
+int tps65987_config_load(const char *file_name, s_TPS_config *p_cfg)
+{
+    s_TPS_config_reg *p_reg;
+    char line[512];
+    char *p;
+    char *end;
+    unsigned long val;
+    int line_no = 0;
+    FILE *fp;
+
+    memset(p_cfg, 0, sizeof(*p_cfg));
+
+    fp = fopen(file_name, "r");
+    if(fp == NULL)
+    {
+        printf("fail to open config %s\n", file_name);
+        return -1;
+    }
+
+    while(fgets(line, sizeof(line), fp) != NULL)
+    {
+        line_no++;
+
+        p = strchr(line, '#');
+        if(p != NULL)
+        {
+            *p = 0;
+        }
+
+        val = strtoul(line, &end, 16);
+        if(end == line)
+        {
+            continue;   //empty
+        }
+
+        if(val > 0xFF || p_cfg->num_regs == CONFIG_MAX_REGS)
+        {
+            printf("%s:%d: bad register\n", file_name, line_no);
+            fclose(fp);
+            return -1;
+        }
+
+        p_reg = &p_cfg->regs[p_cfg->num_regs];
+        p_reg->reg = val;
+
+        for(p = end; ; p = end)
+        {
+            val = strtoul(p, &end, 16);
+            if(end == p)
+            {
+                break;
+            }
+
+            if(val > 0xFF || p_reg->len == CONFIG_REG_SIZE)
+            {
+                printf("%s:%d: bad data\n", file_name, line_no);
+                fclose(fp);
+                return -1;
+            }
+
+            p_reg->data[p_reg->len++] = val;
+        }
+
+        if(p_reg->len != 0)
+        {
+            p_cfg->num_regs++;
+        }
+    }
+
+    fclose(fp);
+
+    return 0;
+}
+
+
+/*
+* XACT_MAX_OPS registers at a time, into live[]
+*/
+static int ReadRegs(s_TPS_dev *p_dev, const s_TPS_config_reg **regs, int num, unsigned char live[][CONFIG_REG_SIZE])
+{
+    s_TPS_xact xact;
+    int i;
+
+    tps65987_xact_init(&xact, p_dev->transport, p_dev->i2c_addr);
+
+    for(i = 0; i < num; i++)
+    {
+        tps65987_xact_read(&xact, regs[i]->reg, live[i], regs[i]->len);
+    }
+
+    return tps65987_xact_run(&xact);
+}
+
+
+static int WriteRegs(s_TPS_dev *p_dev, const s_TPS_config_reg *regs, int num)
+{
+    s_TPS_xact xact;
+    int i;
+
+    tps65987_xact_init(&xact, p_dev->transport, p_dev->i2c_addr);
+
+    for(i = 0; i < num; i++)
+    {
+        tps65987_xact_write(&xact, regs[i].reg, (unsigned char *)regs[i].data, regs[i].len);
+    }
+
+    return tps65987_xact_run(&xact);
+}
+
+
+int tps65987_dev_config_diff(s_TPS_dev *p_dev, const s_TPS_config *p_target, s_TPS_config *p_diff,
+                             s_TPS_config_stats *p_stats)
+{
+    const s_TPS_config_reg *batch[XACT_MAX_OPS];
+    unsigned char live[XACT_MAX_OPS][CONFIG_REG_SIZE];
+    const s_TPS_regdesc *p_desc;
+    unsigned long long start = tps65987_now_us();
+    unsigned int changed;
+    unsigned int i;
+    int num = 0;
+    int j;
+    int k;
+
+    p_diff->num_regs = 0;
+    p_stats->regs = p_target->num_regs;
+
+    for(i = 0; i <= p_target->num_regs; i++)
+    {
+        if(i < p_target->num_regs)
+        {
+            p_desc = tps65987_regmap_find(p_target->regs[i].reg);
+            if(p_desc == NULL || !(p_desc->perm & TPS_REG_WRITE))
+            {
+                printf("config: skip 0x%02x %s, not writable\n", p_target->regs[i].reg,
+                       p_desc != NULL ? p_desc->name : "(unknown)");
+                p_stats->skipped++;
+                continue;
+            }
+
+            batch[num++] = &p_target->regs[i];
+            if(num < XACT_MAX_OPS)
+            {
+                continue;
+            }
+        }
+
+        if(num == 0)
+        {
+            break;
+        }
+
+        if(ReadRegs(p_dev, batch, num, live) != 0)
+        {
+            p_stats->read_us += tps65987_now_us() - start;
+            return -1;
+        }
+
+        for(j = 0; j < num; j++)
+        {
+            changed = 0;
+            for(k = 0; k < batch[j]->len; k++)
+            {
+                changed += live[j][k] != batch[j]->data[k];
+            }
+
+            if(changed != 0)
+            {
+                printf("config: 0x%02x differs in %u of %d bytes\n", batch[j]->reg, changed, batch[j]->len);
+                p_diff->regs[p_diff->num_regs++] = *batch[j];
+                p_stats->changed++;
+                p_stats->changed_bytes += changed;
+            }
+        }
+
+        num = 0;
+    }
+
+    p_stats->read_us += tps65987_now_us() - start;
+
+    return 0;
+}
+
+
+int tps65987_dev_config_apply(s_TPS_dev *p_dev, const s_TPS_config *p_target, unsigned int flags,
+                              s_TPS_config_stats *p_stats)
+{
+    const s_TPS_config_reg *batch[XACT_MAX_OPS];
+    unsigned char live[XACT_MAX_OPS][CONFIG_REG_SIZE];
+    s_TPS_config diff;
+    unsigned char outdata[4];
+    unsigned long long transfers = p_dev->transport->transfers;
+    unsigned long long start;
+    unsigned int i;
+    int num;
+    int j;
+    int src_caps = 0;
+    int ret = 0;
+
+    memset(p_stats, 0, sizeof(*p_stats));
+
+    if(tps65987_dev_config_diff(p_dev, p_target, &diff, p_stats) != 0)
+    {
+        printf("config: fail to read the live registers\n");
+        ret = -1;
+    }
+    else if(diff.num_regs != 0 && !(flags & CONFIG_FLAG_DRY_RUN))
+    {
+        start = tps65987_now_us();
+
+        for(i = 0; i < diff.num_regs && ret == 0; i += num)
+        {
+            num = diff.num_regs - i < XACT_MAX_OPS ? diff.num_regs - i : XACT_MAX_OPS;
+
+            for(j = 0; j < num; j++)
+            {
+                batch[j] = &diff.regs[i + j];
+                p_stats->written_bytes += diff.regs[i + j].len;
+                src_caps |= diff.regs[i + j].reg == TPS_REG_TRANSMIT_SOURCE_CAPABILITIES;
+            }
+
+            if(WriteRegs(p_dev, &diff.regs[i], num) != 0 || ReadRegs(p_dev, batch, num, live) != 0)
+            {
+                printf("config: write of 0x%02x.. failed\n", diff.regs[i].reg);
+                ret = -1;
+                break;
+            }
+
+            for(j = 0; j < num; j++)
+            {
+                if(memcmp(live[j], batch[j]->data, batch[j]->len) != 0)
+                {
+                    printf("config: 0x%02x reads back different\n", batch[j]->reg);
+                    ret = -1;
+                }
+            }
+        }
+
+        //new source PDOs only go out with the next negotiation, start one
+        if(ret == 0 && src_caps &&
+           (tps65987_dev_exec_4CC_Cmd(p_dev, "SSrC", NULL, 0, outdata, 1) != 0 || outdata[0] != 0))
+        {
+            printf("config: SSrC failed\n");
+            ret = -1;
+        }
+
+        p_stats->write_us = tps65987_now_us() - start;
+    }
+
+    p_stats->transfers = p_dev->transport->transfers - transfers;
+
+    return ret;
+}
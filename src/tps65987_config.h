@@ -0,0 +1,75 @@
+/**
+*  @file      tps65987_config.h
+*  @brief     tps65987 application configuration applied as register diffs
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#ifndef TPS65987_CONFIG_H
+#define TPS65987_CONFIG_H
+
+#include "tps65987_drv.h"
+
+/*
+* A configuration file has one register per line: its address and then its
+* bytes, all hex; '#' starts a comment. tools/tps65987_mkconfig.py writes
+* them from the .pjt projects.
+*
+*   0x28 ca 58 b6 3f 00 00 00
+*/
+#define  CONFIG_MAX_REGS            64
+#define  CONFIG_REG_SIZE            64
+
+#define  CONFIG_FLAG_DRY_RUN        0x01    //diff only, write nothing
+
+
+typedef struct
+{
+    unsigned char       reg;
+    unsigned char       len;
+    unsigned char       data[CONFIG_REG_SIZE];
+} s_TPS_config_reg;
+
+
+typedef struct
+{
+    unsigned int        num_regs;
+    s_TPS_config_reg    regs[CONFIG_MAX_REGS];
+} s_TPS_config;
+
+
+typedef struct
+{
+    unsigned int        regs;               //in the configuration
+    unsigned int        skipped;            //read-only or not in the register map
+    unsigned int        changed;            //registers that differ
+    unsigned int        changed_bytes;
+    unsigned int        written_bytes;      //whole registers
+    unsigned long long  read_us;
+    unsigned long long  write_us;           //incl. the read back
+    unsigned long long  transfers;
+} s_TPS_config_stats;
+
+
+int tps65987_config_load(const char *file_name, s_TPS_config *p_cfg);
+
+/*
+* the writable registers of p_target whose live value differs, with their
+* target value
+*/
+int tps65987_dev_config_diff(s_TPS_dev *p_dev, const s_TPS_config *p_target, s_TPS_config *p_diff,
+                             s_TPS_config_stats *p_stats);
+
+/*
+* Writes only the registers that differ and reads them back. A register is
+* written whole, the controller doesn't take partial writes. The port stays
+* up; if Transmit Source Capabilities (0x32) changed, SSrC sends them to the
+* sink right away. The writes only change the running configuration: a
+* reset or GAID (e.g. the next upgrade) loads the one in the flash image
+* again, so apply it after every boot until the image carries it.
+*/
+int tps65987_dev_config_apply(s_TPS_dev *p_dev, const s_TPS_config *p_target, unsigned int flags,
+                              s_TPS_config_stats *p_stats);
+
+#endif
@@ -18,9 +18,12 @@
 #include<linux/i2c-dev.h>
 
 #include "tps65987_drv.h"
-
-#define OTA_FILE_NAME "/data/ota-file/low-region-flash-"
-#define OTA_FILE_NAME1 ".bin"
+#include "tps65987_latency.h"
+#include "tps65987_transport.h"
+#include "tps65987_trace.h"
+#include "tps65987_image.h"
+#include "tps65987_xact.h"
+#include "tps65987_regmap.h"
 
 /*the I2C addr will change, 0x38 or 0x20
   i2c1 cab be master/slave, address is 0x20
@@ -56,43 +59,62 @@ int check_endian(void)
 }
 
 
-enum FLASH_UPGRADE_STATE
+static s_TPS_dev default_dev;
+static int default_dev_init = 0;
+
+static const char *upgrade_phase_names[UPGRADE_PHASE_NUM] =
 {
-    OPEN_FILE,
-    READ_FILE,
-    VERIFY_IF_VALID,
-    CLOSE_FILE,
+    "pre_ops",
+    "flrr",
+    "readback",
+    "flem",
+    "write",
+    "flvy",
+    "second_region",
+    "reset",
 };
 
 
-struct FLASH_UPGRADE_PARA
+/*
+* account the time since *p_start to 'phase', move the progress on to the next
+* phase and restart the clock; the per-command phases only count for the
+* first region
+*/
+static void UpgradePhaseDone(s_TPS_dev *p_dev, enum UPGRADE_PHASE phase, unsigned long long *p_start)
 {
-    enum FLASH_UPGRADE_STATE flash_upgrade_state;
-
-    unsigned char active_region;
-    unsigned char inactive_region;
-
-    unsigned char flash_upgrade_finish;
-
-} flash_upgrade_para;
+    unsigned long long now = tps65987_now_us();
 
+    if(p_dev->flash_upgrade_para.region_pass == 0 || phase == PHASE_SECOND_REGION || phase == PHASE_RESET)
+    {
+        p_dev->upgrade_stats.phase_us[phase] += now - *p_start;
+        atomic_store(&p_dev->phase, phase + 1);
+    }
 
-static int fd;
+    *p_start = now;
+}
 
 
-int i2c_open_tps65987(unsigned char i2c_addr,char *i2c_file_name)
+/*
+* open an i2c bus, the address is only the default one for the fd,
+* every message carries its own
+*/
+s_TPS_transport *tps65987_i2c_open(unsigned char i2c_addr, const char *i2c_file_name)
 {
     int ret;
 
     int val;
 
+    int fd;
+
+    s_TPS_transport *p_transport;
+
     fd = open(i2c_file_name, O_RDWR);
 
     if(fd < 0)
     {
         perror("Unable to open i2c control file");
 
-        return -1;
+        return NULL;
     }
 
     printf("open i2c file success %d\n",fd);
@@ -101,7 +123,8 @@ int i2c_open_tps65987(unsigned char i2c_addr,char *i2c_file_name)
     if (ret < 0)
     {
         printf("i2c: Failed to set i2c device address 0x%x\n",i2c_addr);
-        return -1;
+        close(fd);
+        return NULL;
     }
 
     printf("i2c: set i2c device address success\n");
@@ -119,312 +142,515 @@ int i2c_open_tps65987(unsigned char i2c_addr,char *i2c_file_name)
     * use I2C_TIMEOUT default setting, which is HZ, that means 1 second
     */
 
-    return 0;
+    p_transport = tps65987_i2cdev_transport(fd);
+    if(p_transport == NULL)
+    {
+        close(fd);
+    }
+
+    return p_transport;
 }
 
-static int i2c_write(int fd, unsigned char dev_addr, unsigned char *val, unsigned char len)
-{
-    int ret;
-    int i;
 
-    struct i2c_rdwr_ioctl_data data;
+int i2c_open_tps65987(unsigned char i2c_addr,char *i2c_file_name)
+{
+    s_TPS_transport *p_transport;
 
-    struct i2c_msg messages;
+    p_transport = tps65987_i2c_open(i2c_addr, i2c_file_name);
+    if(p_transport == NULL)
+    {
+        return -1;
+    }
 
+    tps65987_set_transport(p_transport);
 
-    messages.addr = dev_addr;  //device address
-    messages.flags = 0;    //write
-    messages.len = len;
-    messages.buf = val;  //data
+    return 0;
+}
 
-    data.msgs = &messages;
-    data.nmsgs = 1;
 
-    ret = ioctl(fd, I2C_RDWR, &data);
+s_TPS_dev *tps65987_dev_create(const char *name, s_TPS_transport *p_transport, unsigned char i2c_addr)
+{
+    s_TPS_dev *p_dev;
 
-    if(ret < 0)
+    p_dev = calloc(1, sizeof(*p_dev));
+    if(p_dev == NULL)
     {
-        printf("write ioctl err %d\n",ret);
-        return ret;
+        return NULL;
     }
 
-    printf("i2c write buf = ");
-    for(i=0; i< len; i++)
-    {
-        printf("%02x ",val[i]);
-    }
-    printf("\n");
+    snprintf(p_dev->name, sizeof(p_dev->name), "%s", name);
+    p_dev->i2c_addr = i2c_addr;
+    p_dev->transport = p_transport;
 
-    return 0;
+    tps65987_latency_init(&p_dev->latency);
+    atomic_init(&p_dev->phase, UPGRADE_PHASE_NUM);
+    p_dev->journal.fd = -1;
+
+    return p_dev;
 }
 
 
-static int i2c_read(int fd, unsigned char addr, unsigned char reg, unsigned char *val, unsigned char len)
+/*
+* the transport belongs to the bus and is not closed here
+*/
+void tps65987_dev_destroy(s_TPS_dev *p_dev)
 {
-    int ret;
-    int i;
-
-    struct i2c_rdwr_ioctl_data data;
-    struct i2c_msg messages[2];
+    free(p_dev);
+}
 
-    messages[0].addr = addr;  //device address
-    messages[0].flags = 0;    //write
-    messages[0].len = 1;
-    messages[0].buf = &reg;  //reg address
 
-    messages[1].addr = addr;       //device address
-    messages[1].flags = I2C_M_RD;  //read
-    messages[1].len = len;
-    messages[1].buf = val;
+/*
+* the controller at I2C_ADDR on the transport set by i2c_open_tps65987() /
+* tps65987_set_transport(), used by the single-controller calls
+*/
+s_TPS_dev *tps65987_default_dev(void)
+{
+    if(!default_dev_init)
+    {
+        snprintf(default_dev.name, sizeof(default_dev.name), "default");
+        tps65987_latency_init(&default_dev.latency);
+        atomic_init(&default_dev.phase, UPGRADE_PHASE_NUM);
+        default_dev.journal.fd = -1;
+        default_dev_init = 1;
+    }
 
-    data.msgs = messages;
-    data.nmsgs = 2;
+    default_dev.i2c_addr = I2C_ADDR;
+    default_dev.transport = tps65987_get_transport();
 
-    ret = ioctl(fd, I2C_RDWR, &data);
+    return &default_dev;
+}
 
-    if(ret < 0)
-    {
-        printf("read ioctl err %d\n",ret);
+static int reg_write(s_TPS_transport *p_transport, unsigned char dev_addr, unsigned char reg, unsigned char *val, unsigned char data_len)
+{
+    s_TPS_xact xact;
 
-        return ret;
-    }
+    tps65987_xact_init(&xact, p_transport, dev_addr);
+    tps65987_xact_write(&xact, reg, val, data_len);
 
-    printf("i2c read buf = ");
-    for(i = 0; i < len; i++)
+    if(tps65987_xact_run(&xact) != 0)
     {
-        printf("%02x ",val[i]);
+        return -1;
     }
-    printf("\n");
 
     return 0;
 }
 
 
-int tps65987_i2c_write(unsigned char dev_addr, unsigned char reg, unsigned char *val, unsigned char data_len)
+static int reg_read(s_TPS_transport *p_transport, unsigned char addr, unsigned char reg, unsigned char *val, unsigned char data_len)
 {
-    unsigned char buf[80] = {0};
-    int i;
+    s_TPS_xact xact;
 
-    int ret;
+    tps65987_xact_init(&xact, p_transport, addr);
+    tps65987_xact_read(&xact, reg, val, data_len);
 
-    if(data_len + 2 >= 80)
+    if(tps65987_xact_run(&xact) != 0)
     {
-        printf("data_len_exceed\n");
         return -1;
     }
 
-    buf[0] = reg;
-    buf[1] = data_len;
+    return 0;
+}
+
+
+int tps65987_dev_write(s_TPS_dev *p_dev, unsigned char reg, unsigned char *val, unsigned char data_len)
+{
+    return reg_write(p_dev->transport, p_dev->i2c_addr, reg, val, data_len);
+}
+
+
+int tps65987_dev_read(s_TPS_dev *p_dev, unsigned char reg, unsigned char *val, unsigned char data_len)
+{
+    return reg_read(p_dev->transport, p_dev->i2c_addr, reg, val, data_len);
+}
+
+
+int tps65987_i2c_write(unsigned char dev_addr, unsigned char reg, unsigned char *val, unsigned char data_len)
+{
+    return reg_write(tps65987_default_dev()->transport, dev_addr, reg, val, data_len);
+}
+
+
+int tps65987_i2c_read(unsigned char addr, unsigned char reg, unsigned char *val, unsigned char data_len)
+{
+    return reg_read(tps65987_default_dev()->transport, addr, reg, val, data_len);
+}
+
+
+/*
+* 4CC record: cmd, u32 us until complete; status 0 done, 1 fail, -1 unrecognized / timeout,
+* 2 sent (written to CMD1, not complete yet)
+*/
+static void trace_4CC_Cmd(s_TPS_dev *p_dev, unsigned char *cmd_ptr, int status, unsigned int elapsed)
+{
+    unsigned char data[8];
+
+    memcpy(data, cmd_ptr, 4);
+    data[4] = elapsed & 0xff;
+    data[5] = (elapsed >> 8) & 0xff;
+    data[6] = (elapsed >> 16) & 0xff;
+    data[7] = (elapsed >> 24) & 0xff;
 
-    for(i = 0; i<data_len; i++)
+    if(status == 0 || status == 2)
     {
-        buf[2+i] = val[i];
+        TPS_TRACE_XFER(TRACE_OP_4CC, p_dev->i2c_addr, REG_CMD1, 4, status, data, sizeof(data));
     }
-
-    if(i2c_write(fd, dev_addr, buf, data_len+2) == 0)
+    else
     {
-        return 0;
+        TPS_TRACE_ERROR(TRACE_OP_4CC, p_dev->i2c_addr, REG_CMD1, 4, status, data, sizeof(data));
     }
-
-    return -1;
 }
 
 
-int tps65987_i2c_read(unsigned char addr, unsigned char reg, unsigned char *val, unsigned char data_len)
+/*
+* One transaction: the 4CC Cmd Used Data (if any, either as data or as a
+* prebuilt REG_DATA1 frame) and the 4CC Cmd itself. With p_status the first
+* poll of CMD1, and of DATA1 if cmd_data_out_ptr is given, is appended as well,
+* for commands which usually complete before the transaction is over.
+*/
+static int tps65987_send_4CC_Cmd(s_TPS_dev *p_dev, unsigned char *cmd_ptr, unsigned char *cmd_data_ptr, unsigned char cmd_data_length,
+                                 unsigned char *frame, unsigned char frame_len,
+                                 unsigned char *p_status, unsigned char *cmd_data_out_ptr, unsigned char cmd_data_out_length)
 {
-    unsigned char buf[80] = {0};
-    int i;
+    s_TPS_xact xact;
+
+    tps65987_xact_init(&xact, p_dev->transport, p_dev->i2c_addr);
 
-    if(data_len + 1 >= 80)
+    //first write 4CC Cmd Used Data(if any)
+    if(frame != NULL)
     {
-        printf("data_len_exceed\n");
-        return -1;
+        tps65987_xact_write_frame(&xact, frame, frame_len);
     }
+    else if(cmd_data_ptr != NULL)
+    {
+        tps65987_xact_write(&xact, REG_DATA1, cmd_data_ptr, cmd_data_length);
+    }
+
+    trace_4CC_Cmd(p_dev, cmd_ptr, 2, 0);
+
+    //write 4CC Cmd
+    tps65987_xact_write(&xact, REG_CMD1, cmd_ptr, 4);
 
-    if(i2c_read(fd, addr, reg, buf, data_len+1) == 0)
+    if(p_status != NULL)
     {
-        printf("read reg 0x%x = ",reg);
-        for(i = 0; i < data_len; i++)
+        tps65987_xact_read(&xact, REG_CMD1, p_status, 4);
+
+        if(cmd_data_out_ptr != NULL)
         {
-            val[i] = buf[1+i];
-            printf("%02x ",val[i]);
+            tps65987_xact_read(&xact, REG_DATA1, cmd_data_out_ptr, cmd_data_out_length);
         }
-        printf("\n");
+    }
 
-        return 0;
+    if(tps65987_xact_run(&xact) != 0)
+    {
+        printf("write 4CC Cmd err \n");
+        return -1;
     }
 
-    return -1;
+    return 0;
 }
 
 
-static int tps65987_send_4CC_Cmd(unsigned char *cmd_ptr, unsigned char *cmd_data_ptr, unsigned char cmd_data_length)
+/*
+* CMD1 contents: 0 done, 1 fail, -1 unrecognized, 2 still running
+*/
+static int tps65987_4CC_Cmd_status(unsigned char *buf)
 {
-    int ret;
-    int i;
+    unsigned char Cmd_exec_success[4] = {0,0,0,0};
 
-    unsigned char val[4] = {0};
+    unsigned char Cmd_exec_fail[4] = {'C','M','D',' '};
+    unsigned char Cmd_unrecognized[4] = {'!','C','M','D'};
 
-    //first write 4CC Cmd Used Data(if any)
-    if(cmd_data_ptr != NULL)
+    if(memcmp(buf,Cmd_exec_success,4) == 0)
     {
-        ret = tps65987_i2c_write(I2C_ADDR, 0x09, cmd_data_ptr, cmd_data_length);
-
-        if(ret != 0)
-        {
-            printf("write 4CC Cmd Used Data err \n");
-            return -1;
-        }
+        return 0;
     }
 
-    val[0] = cmd_ptr[0];
-    val[1] = cmd_ptr[1];
-    val[2] = cmd_ptr[2];
-    val[3] = cmd_ptr[3];
+    if(memcmp(buf,Cmd_exec_fail,4) == 0)
+    {
+        return 1;
+    }
 
-    printf("send 4CC Cmd : ");
-    for(i=0; i<4; i++)
+    if(memcmp(buf,Cmd_unrecognized,4) == 0)
     {
-        printf("%c",val[i]);
+        return -1;
     }
-    printf("\n");
 
-    //write 4CC Cmd
-    return tps65987_i2c_write(I2C_ADDR, 0x08, val, 4);
+    return 2;
 }
 
 
-static int tps65987_check_4CC_Cmd_executed()
+/*
+* Poll CMD1 (0x08) until the 4CC command completes.
+* The first poll is at the learned latency of this command, later polls back
+* off exponentially up to LATENCY_MAX_POLL_US, and the command is given up at
+* its deadline (see tps65987_latency.c).
+* Every poll is one transaction which also reads DATA1 (if cmd_data_out_ptr is
+* given), so the output is there as soon as the command is done. It goes to
+* cmd_data_out_ptr only then: before that DATA1 still holds the input.
+*/
+static int tps65987_check_4CC_Cmd_executed(s_TPS_dev *p_dev, unsigned char *cmd_ptr, unsigned char *cmd_data_out_ptr, unsigned char cmd_data_out_length)
 {
     int i;
 
     unsigned char buf[4] = {0,1,2,3}; //just a random value
+    unsigned char data[256];
 
-    unsigned char Cmd_exec_success[4] = {0,0,0,0};
+    s_TPS_cmd_latency *p_lat = tps65987_latency_get(&p_dev->latency, cmd_ptr);
+    s_TPS_xact xact;
 
-    unsigned char Cmd_exec_fail[4] = {'C','M','D',' '};
-    unsigned char Cmd_unrecognized[4] = {'!','C','M','D'};
+    unsigned long long start = tps65987_now_us();
+    unsigned int elapsed = 0;
+    unsigned int wait;
+    unsigned int step;
+    int status;
+    int bus_err = 0;
+
+    wait = tps65987_latency_first_poll(p_lat);
+
+    step = tps65987_latency_median(p_lat) / 8;
+    if(step < LATENCY_MIN_POLL_US)
+    {
+        step = LATENCY_MIN_POLL_US;
+    }
 
-    for(i = 0; i< 50; i++)
+    for(i = 0; ; i++)
     {
-        usleep(10000);
+        if(elapsed + wait > p_lat->deadline_us)
+        {
+            wait = p_lat->deadline_us - elapsed;
+        }
 
-        tps65987_i2c_read(I2C_ADDR, 0x08, buf, 4);
+        tps65987_sleep_us(wait);
 
-        if(memcmp(buf,Cmd_exec_success,4) == 0)
+        //the sample is when the poll went out, not when its answer came back
+        elapsed = tps65987_now_us() - start;
+
+        tps65987_xact_init(&xact, p_dev->transport, p_dev->i2c_addr);
+        tps65987_xact_read(&xact, REG_CMD1, buf, 4);
+        if(cmd_data_out_ptr != NULL)
+        {
+            tps65987_xact_read(&xact, REG_DATA1, data, cmd_data_out_length);
+        }
+
+        status = 2;
+        bus_err = tps65987_xact_run(&xact) != 0;
+        if(!bus_err)
         {
-            printf("4CC Cmd executed, %d\n", i);
+            status = tps65987_4CC_Cmd_status(buf);
+        }
+
+        if(status == 0)
+        {
+            if(cmd_data_out_ptr != NULL)
+            {
+                memcpy(cmd_data_out_ptr, data, cmd_data_out_length);
+            }
+
+            tps65987_latency_add(p_lat, elapsed);
+            trace_4CC_Cmd(p_dev, cmd_ptr, 0, elapsed);
             return 0;
         }
 
-        if(memcmp(buf,Cmd_exec_fail,4) == 0)
+        if(status == 1)
         {
-            printf("4CC Cmd exec fail, %d\n", i);
+            tps65987_latency_add(p_lat, elapsed);
+            trace_4CC_Cmd(p_dev, cmd_ptr, 1, elapsed);
+            printf("4CC Cmd exec fail, %d, %uus\n", i, elapsed);
+            p_dev->last_error = TPS_ERR_REJECT;
             return 1;
         }
 
-        if(memcmp(buf,Cmd_unrecognized,4) == 0)
+        if(status == -1)
         {
+            trace_4CC_Cmd(p_dev, cmd_ptr, -1, elapsed);
             printf("4CC Cmd unrecognized, %d\n", i);
+            p_dev->last_error = TPS_ERR_UNRECOGNIZED;
             return -1;
         }
+
+        if(elapsed >= p_lat->deadline_us)
+        {
+            break;
+        }
+
+        wait = step;
+
+        step *= 2;
+        if(step > LATENCY_MAX_POLL_US)
+        {
+            step = LATENCY_MAX_POLL_US;
+        }
     }
 
-    printf("4CC Cmd exec timeout, %d\n", i);
-    return -1;
+    tps65987_latency_timeout(p_lat);
+    trace_4CC_Cmd(p_dev, cmd_ptr, -1, elapsed);
 
-}
+    printf("4CC Cmd exec timeout, %d, %uus\n", i, elapsed);
 
+    //a controller that stopped answering isn't just slow
+    p_dev->last_error = bus_err ? TPS_ERR_BUS : TPS_ERR_TIMEOUT;
+    return -1;
 
-static int tps65987_read_4CC_Cmd_exec_output(unsigned char *cmd_data_ptr, unsigned char cmd_data_length)
-{
-    return tps65987_i2c_read(I2C_ADDR, 0x09, cmd_data_ptr, cmd_data_length);
 }
 
 
-int tps65987_exec_4CC_Cmd(unsigned char *cmd_ptr, unsigned char *cmd_data_in_ptr, unsigned char cmd_data_in_length, unsigned char *cmd_data_out_ptr, unsigned char cmd_data_out_length)
+static int tps65987_run_4CC_Cmd(s_TPS_dev *p_dev, unsigned char *cmd_ptr, unsigned char *cmd_data_in_ptr, unsigned char cmd_data_in_length,
+                                unsigned char *frame, unsigned char frame_len,
+                                unsigned char *cmd_data_out_ptr, unsigned char cmd_data_out_length)
 {
+    s_TPS_cmd_latency *p_lat;
+    unsigned char status[4] = {0,1,2,3};
+    unsigned char *p_status = NULL;
+    unsigned char data[256];
 
-    if(tps65987_send_4CC_Cmd(cmd_ptr, cmd_data_in_ptr, cmd_data_in_length) != 0)
-    {
-        printf("send_4CC_Cmd err\n");
-        return -1;
-    }
+    p_dev->last_error = TPS_ERR_NONE;
 
     if( strcmp(cmd_ptr,"Gaid") == 0 || strcmp(cmd_ptr,"GAID") == 0 )
     {
         //Technically this command never completes since the processor restarts
-    }
-    else
-    {
-        if(tps65987_check_4CC_Cmd_executed() != 0)
+        if(tps65987_send_4CC_Cmd(p_dev, cmd_ptr, cmd_data_in_ptr, cmd_data_in_length, frame, frame_len, NULL, NULL, 0) != 0)
+        {
+            printf("send_4CC_Cmd err\n");
+            p_dev->last_error = TPS_ERR_BUS;
+            return -1;
+        }
+
+        if(cmd_data_out_ptr != NULL && tps65987_dev_read(p_dev, REG_DATA1, cmd_data_out_ptr, cmd_data_out_length) != 0)
         {
-            printf("4CC_Cmd exec err\n");
+            printf("read 4CC_Cmd exec output err\n");
+            p_dev->last_error = TPS_ERR_BUS;
             return -1;
         }
+
+        return 0;
+    }
+
+    //commands that are usually done by the time the bus turns around get their first poll in the same transaction
+    p_lat = tps65987_latency_get(&p_dev->latency, cmd_ptr);
+    if(tps65987_latency_first_poll(p_lat) <= LATENCY_MIN_POLL_US)
+    {
+        p_status = status;
     }
 
+    if(tps65987_send_4CC_Cmd(p_dev, cmd_ptr, cmd_data_in_ptr, cmd_data_in_length, frame, frame_len, p_status,
+                             cmd_data_out_ptr != NULL ? data : NULL, cmd_data_out_length) != 0)
+    {
+        printf("send_4CC_Cmd err\n");
+        p_dev->last_error = TPS_ERR_BUS;
+        return -1;
+    }
 
-    if(cmd_data_out_ptr != NULL)
+    if(p_status != NULL && tps65987_4CC_Cmd_status(status) == 0)
     {
-        if(tps65987_read_4CC_Cmd_exec_output(cmd_data_out_ptr, cmd_data_out_length) != 0)
+        if(cmd_data_out_ptr != NULL)
         {
-            printf("read 4CC_Cmd exec output err\n");
-            return -1;
+            memcpy(cmd_data_out_ptr, data, cmd_data_out_length);
         }
+
+        tps65987_latency_add(p_lat, 0);
+        trace_4CC_Cmd(p_dev, cmd_ptr, 0, 0);
+        return 0;
+    }
+
+    if(tps65987_check_4CC_Cmd_executed(p_dev, cmd_ptr, cmd_data_out_ptr, cmd_data_out_length) != 0)
+    {
+        printf("4CC_Cmd exec err\n");
+        return -1;
     }
 
     return 0;
 }
 
 
-int tps65987_host_patch_bundle(void)
+int tps65987_dev_exec_4CC_Cmd(s_TPS_dev *p_dev, unsigned char *cmd_ptr, unsigned char *cmd_data_in_ptr, unsigned char cmd_data_in_length, unsigned char *cmd_data_out_ptr, unsigned char cmd_data_out_length)
 {
-    unsigned char buf[64] = {0};
-
-    tps65987_i2c_read(I2C_ADDR, 0x14, buf, 11);
-    tps65987_i2c_read(I2C_ADDR, 0x15, buf, 11);
-
-    tps65987_send_4CC_Cmd("PTCq", 0, 0);
-    tps65987_check_4CC_Cmd_executed();
+    return tps65987_run_4CC_Cmd(p_dev, cmd_ptr, cmd_data_in_ptr, cmd_data_in_length, NULL, 0, cmd_data_out_ptr, cmd_data_out_length);
+}
 
-    //test unvalid 4CC Cmd
-    tps65987_send_4CC_Cmd("ABCD", 0, 0);
-    tps65987_check_4CC_Cmd_executed();
 
-    tps65987_send_4CC_Cmd("PTCr", 0, 0);
-    tps65987_check_4CC_Cmd_executed();
+/*
+* same as tps65987_dev_exec_4CC_Cmd() with the DATA1 write already built:
+* frame = REG_DATA1, byte count, data
+*/
+int tps65987_dev_exec_4CC_Frame(s_TPS_dev *p_dev, unsigned char *cmd_ptr, unsigned char *frame, unsigned char frame_len, unsigned char *cmd_data_out_ptr, unsigned char cmd_data_out_length)
+{
+    return tps65987_run_4CC_Cmd(p_dev, cmd_ptr, NULL, 0, frame, frame_len, cmd_data_out_ptr, cmd_data_out_length);
+}
 
-    tps65987_send_4CC_Cmd("Gaid", 0, 0);
-    tps65987_check_4CC_Cmd_executed();
 
-    tps65987_i2c_read(I2C_ADDR, 0x14, buf, 11);
-    tps65987_i2c_read(I2C_ADDR, 0x15, buf, 11);
+int tps65987_exec_4CC_Cmd(unsigned char *cmd_ptr, unsigned char *cmd_data_in_ptr, unsigned char cmd_data_in_length, unsigned char *cmd_data_out_ptr, unsigned char cmd_data_out_length)
+{
+    return tps65987_dev_exec_4CC_Cmd(tps65987_default_dev(), cmd_ptr, cmd_data_in_ptr, cmd_data_in_length, cmd_data_out_ptr, cmd_data_out_length);
+}
 
-    tps65987_send_4CC_Cmd("PTCs", 0, 0);
-    tps65987_check_4CC_Cmd_executed();
 
-    tps65987_i2c_read(I2C_ADDR, 0x14, buf, 11);
-    tps65987_i2c_read(I2C_ADDR, 0x15, buf, 11);
+int tps65987_host_patch_bundle(char *patch_file_name)
+{
+    return tps65987_dev_host_patch(tps65987_default_dev(), patch_file_name);
 }
 
 /*
 * function for flash upgrade
 */
-static int PreOpsForFlashUpdate(void);
-static int StartFlashUpdate(char *ota_file_name);
-static int UpdateAndVerifyRegion(unsigned char region_number, char *ota_file_name);
+static int PreOpsForFlashUpdate(s_TPS_dev *p_dev);
+static int DisablePort(s_TPS_dev *p_dev);
+static int WaitPortDisabled(s_TPS_dev *p_dev);
+static void PortBackUp(s_TPS_dev *p_dev);
+static int SwitchToUpdatedRegion(s_TPS_dev *p_dev);
+static int SaveFallbackSector(s_TPS_dev *p_dev);
+static int RestoreFallbackSector(s_TPS_dev *p_dev);
+static int IsBootedFrom(s_TPS_dev *p_dev, unsigned char region);
+static int PlanFlashUpdate(s_TPS_dev *p_dev, const s_TPS_image *p_image);
+static int StartFlashUpdate(s_TPS_dev *p_dev, const s_TPS_image *p_image);
+static int UpdateAndVerifyRegion(s_TPS_dev *p_dev, unsigned char region_number, const s_TPS_image *p_image);
+static int CompareRegionSectors(s_TPS_dev *p_dev, const s_TPS_image *p_image, unsigned char region_number,
+                                unsigned int regAddr, int num_sectors);
+static void SetSectorMap(s_TPS_dev *p_dev, unsigned char region_number, unsigned int regAddr, const s_TPS_image *p_image);
+static void ClearSectorMap(s_TPS_dev *p_dev, unsigned char region_number, unsigned int sector);
+static int EraseDirtySectors(s_TPS_dev *p_dev, unsigned int regAddr, int num_sectors);
+static int IsBlankChunk(unsigned char *buf, int len);
+static int IsChunkWritten(s_TPS_dev *p_dev, const s_TPS_image *p_image, unsigned int regAddr, unsigned int chunk);
 
 
-static int PreOpsForFlashUpdate(void)
+/*
+* FLrr, FLem, FLad, FLvy: sent again after a bus error or "CMD ", a few times
+* and with the same backoff as a chunk; running them twice is harmless
+*/
+static int ExecFlashCmd(s_TPS_dev *p_dev, unsigned char *cmd_ptr, unsigned char *cmd_data_in_ptr, unsigned char cmd_data_in_length,
+                        unsigned char *cmd_data_out_ptr, unsigned char cmd_data_out_length)
 {
-    unsigned char buf[64];
-    int ret;
+    unsigned int backoff_us = FLASH_RETRY_BACKOFF_US;
+    int retry;
+
+    for(retry = 0; ; retry++)
+    {
+        if(tps65987_dev_exec_4CC_Cmd(p_dev, cmd_ptr, cmd_data_in_ptr, cmd_data_in_length, cmd_data_out_ptr, cmd_data_out_length) == 0)
+        {
+            return 0;
+        }
+
+        p_dev->upgrade_stats.errors[p_dev->last_error]++;
+
+        if((p_dev->last_error != TPS_ERR_BUS && p_dev->last_error != TPS_ERR_REJECT) || retry == FLASH_CMD_RETRIES)
+        {
+            return -1;
+        }
+
+        printf("4CC_Cmd %.4s: %s, retry %d\n", cmd_ptr, tps65987_error_name(p_dev->last_error), retry + 1);
+
+        tps65987_sleep_us(backoff_us);
+        backoff_us *= 2;
+
+        p_dev->upgrade_stats.retried_cmds++;
+    }
+}
 
-    s_TPS_bootflag *p_bootflags = NULL;
-    s_TPS_portconfig *p_portconfig = NULL;
 
-    tps65987_i2c_read(I2C_ADDR, REG_Version, buf, 4);
+static int PreOpsForFlashUpdate(s_TPS_dev *p_dev)
+{
+    unsigned char buf[64];
+
+    tps65987_dev_read(p_dev, REG_Version, buf, 4);
 
     printf("tps65987 check version\n");
 
@@ -434,41 +660,50 @@ static int PreOpsForFlashUpdate(void)
     * boot didn't succeed
     * - Note #2: Flash-update shall be attempted on the inactive region first
     */
-    tps65987_i2c_read(I2C_ADDR, REG_BootFlags, buf, 12);
-
-    p_bootflags = (s_TPS_bootflag *)&buf[0];
+    tps65987_dev_read(p_dev, REG_BootFlags, buf, 12);
 
-    printf("TPS_bootflag = 0x%08x\n", *((unsigned int *)p_bootflags));
-    printf("test TPS_bootflag %x\n", p_bootflags->SpiFlashPresent);
+    printf("TPS_bootflag = 0x%08x\n", tps65987_field_get(buf, 0, 32));
+    printf("test TPS_bootflag %x\n", tps65987_boot_flags_spi_flash_present(buf));
 
-    if(p_bootflags->PatchHeaderErr != 0)
+    if(tps65987_boot_flags_patch_header_error(buf) != 0 && !p_dev->flash_upgrade_para.resume)
     {
         printf("PatchHeaderErr\n");
         return -1;
     }
 
+    /*
+    * An interrupted upgrade may have left the region it was copying to
+    * unbootable, the journal knows which one was active
+    */
+    if(p_dev->flash_upgrade_para.resume)
+    {
+        p_dev->flash_upgrade_para.active_region = p_dev->journal.rec.active_region;
+        p_dev->flash_upgrade_para.inactive_region = !p_dev->journal.rec.active_region;
+
+        printf("resume: active region %d, pass %d\n", p_dev->flash_upgrade_para.active_region, p_dev->journal.rec.region_pass);
+    }
     /*
     * Note #2
     * Region1 = 0 indicates that device didn't attempt 'Region1',
     * which implicitly means that the content at Region0 is valid/active
     */
-    if(p_bootflags->Region1 == 0)
+    else if(tps65987_boot_flags_region_1(buf) == 0)
     {
-        flash_upgrade_para.active_region = REGION_0;
-        flash_upgrade_para.inactive_region = REGION_1;
+        p_dev->flash_upgrade_para.active_region = REGION_0;
+        p_dev->flash_upgrade_para.inactive_region = REGION_1;
 
-        printf("flash_upgrade_para inactive_region is REGION_1, %d\n", flash_upgrade_para.inactive_region);
+        printf("flash_upgrade_para inactive_region is REGION_1, %d\n", p_dev->flash_upgrade_para.inactive_region);
     }
-    else if ( (p_bootflags->Region1 == 1) && \
-              (p_bootflags->Region0 == 1) && \
-              ((p_bootflags->Region1CrcFail == 0) && \
-               (p_bootflags->Region1FlashErr == 0) && \
-               (p_bootflags->Region1Invalid == 0)) )
+    else if ( (tps65987_boot_flags_region_1(buf) == 1) && \
+              (tps65987_boot_flags_region_0(buf) == 1) && \
+              ((tps65987_boot_flags_region_1_crc_fail(buf) == 0) && \
+               (tps65987_boot_flags_region_1_flash_error(buf) == 0) && \
+               (tps65987_boot_flags_region_1_invalid(buf) == 0)) )
     {
-        flash_upgrade_para.active_region = REGION_1;
-        flash_upgrade_para.inactive_region = REGION_0;
+        p_dev->flash_upgrade_para.active_region = REGION_1;
+        p_dev->flash_upgrade_para.inactive_region = REGION_0;
 
-        printf("flash_upgrade_para inactive_region is REGION_0, %d\n", flash_upgrade_para.inactive_region);
+        printf("flash_upgrade_para inactive_region is REGION_0, %d\n", p_dev->flash_upgrade_para.inactive_region);
     }
     else
     {
@@ -477,65 +712,504 @@ static int PreOpsForFlashUpdate(void)
 
         //need further debug
         /*printf("force upgrade REGION_0\n");
-        flash_upgrade_para.active_region = REGION_1;
-        flash_upgrade_para.inactive_region = REGION_0;*/
+        p_dev->flash_upgrade_para.active_region = REGION_1;
+        p_dev->flash_upgrade_para.inactive_region = REGION_0;*/
     }
 
     /*
-    * Keep the port disabled during the flash-update
+    * Staged: the port stays up until SwitchToUpdatedRegion()
     */
-    tps65987_i2c_read(I2C_ADDR, REG_PORTCONFIG, buf, 8);
+    if(p_dev->flash_upgrade_para.upgrade_flags & UPGRADE_FLAG_STAGED)
+    {
+        printf("staged upgrade, TYPE-C PORT stays enabled\n");
+        return 0;
+    }
 
-    p_portconfig = (s_TPS_portconfig *)&buf[0];
+    return DisablePort(p_dev);
+}
 
-    printf("TPS_portconfig = 0x%04x\n", *((unsigned int *)p_portconfig));
-    printf("test TPS_portconfig %x\n", p_portconfig->TypeCStateMachine);
 
-    p_portconfig->TypeCStateMachine = DISABLE_PORT;
+/*
+* Keep the port disabled during the flash-update, it comes back with the
+* GAID reset. -1 if PORTCONFIG can't be read or written or the port doesn't
+* go down in time; the port configuration is then written back.
+*/
+static int DisablePort(s_TPS_dev *p_dev)
+{
+    unsigned char saved[TPS_REG_PORT_CONFIGURATION_LEN];
+    unsigned char buf[TPS_REG_PORT_CONFIGURATION_LEN];
 
-    tps65987_i2c_write(I2C_ADDR, REG_PORTCONFIG, buf, 8);
+    if(tps65987_dev_read(p_dev, REG_PORTCONFIG, buf, TPS_REG_PORT_CONFIGURATION_LEN) != 0)
+    {
+        printf("fail to read TPS_portconfig\n");
+        return -1;
+    }
 
-    printf("DISABLE TYPE-C PORT\n");
+    memcpy(saved, buf, sizeof(saved));
 
-    sleep(3);
-    tps65987_i2c_read(I2C_ADDR, REG_PORTCONFIG, buf, 8); //just for check
+    printf("TPS_portconfig = 0x%04x\n", tps65987_field_get(buf, 0, 32));
+    printf("test TPS_portconfig %x\n", tps65987_port_configuration_port_configuration(buf));
 
-    return 0;
-}
+    tps65987_set_port_configuration_port_configuration(buf, DISABLE_PORT);
 
+    p_dev->flash_upgrade_para.port_down_start_us = tps65987_now_us();
 
-static int StartFlashUpdate(char *ota_file_name)
-{
-    int retVal;
+    if(tps65987_dev_write(p_dev, REG_PORTCONFIG, buf, TPS_REG_PORT_CONFIGURATION_LEN) != 0)
+    {
+        printf("fail to DISABLE TYPE-C PORT\n");
+    }
+    else
+    {
+        printf("DISABLE TYPE-C PORT\n");
 
-    printf("\n\rActive Region is [%d] - Region being updated is [%d]\n\r",
-           flash_upgrade_para.active_region, flash_upgrade_para.inactive_region);
+        if(WaitPortDisabled(p_dev) == 0)
+        {
+            return 0;
+        }
 
-    /*
-    * Region-0 is currently active, hence update Region-1
-    */
-    retVal = UpdateAndVerifyRegion(flash_upgrade_para.inactive_region,ota_file_name);
-    if(retVal != 0)
-    {
-        printf("Region[%d] update failed.! Next boot will happen from Region[%d]\n\r",\
-               flash_upgrade_para.inactive_region, flash_upgrade_para.active_region);
-        retVal = -1;
-        goto error;
+        printf("port still not disabled after %dms\n", PORT_DISABLE_TIMEOUT_MS);
     }
 
-    /*
+    tps65987_dev_write(p_dev, REG_PORTCONFIG, saved, TPS_REG_PORT_CONFIGURATION_LEN);
+    PortBackUp(p_dev);
+
+    return -1;
+}
+
+
+/*
+* Poll PORTCONFIG and Status until the state machine is disabled and
+* nothing is connected any more
+*/
+static int WaitPortDisabled(s_TPS_dev *p_dev)
+{
+    unsigned char portconfig[TPS_REG_PORT_CONFIGURATION_LEN];
+    unsigned char status[TPS_REG_STATUS_LEN];
+    s_TPS_xact xact;
+
+    unsigned long long start = tps65987_now_us();
+    unsigned long long deadline = start + PORT_DISABLE_TIMEOUT_MS * 1000ULL;
+    unsigned int wait_us = READY_POLL_MIN_US;
+
+    for(;;)
+    {
+        tps65987_xact_init(&xact, p_dev->transport, p_dev->i2c_addr);
+        tps65987_xact_read(&xact, REG_PORTCONFIG, portconfig, 2);
+        tps65987_xact_read(&xact, REG_Status, status, 4);
+
+        if(tps65987_xact_run(&xact) == 0 && tps65987_port_configuration_port_configuration(portconfig) == DISABLE_PORT &&
+           !tps65987_status_plug_present(status) && tps65987_status_conn_state(status) == 0)
+        {
+            p_dev->upgrade_stats.port_disable_us += tps65987_now_us() - start;
+            printf("port disabled after %lluus\n", tps65987_now_us() - start);
+            return 0;
+        }
+
+        if(tps65987_now_us() >= deadline)
+        {
+            p_dev->upgrade_stats.port_disable_us += tps65987_now_us() - start;
+            return -1;
+        }
+
+        tps65987_sleep_us(wait_us);
+        wait_us = wait_us * 2 < READY_POLL_MAX_US ? wait_us * 2 : READY_POLL_MAX_US;
+    }
+}
+
+
+/*
+* after the GAID reset, the port is enabled again
+*/
+static void PortBackUp(s_TPS_dev *p_dev)
+{
+    if(p_dev->flash_upgrade_para.port_down_start_us != 0)
+    {
+        p_dev->upgrade_stats.port_down_us += tps65987_now_us() - p_dev->flash_upgrade_para.port_down_start_us;
+        p_dev->flash_upgrade_para.port_down_start_us = 0;
+    }
+}
+
+
+/*
+* Make the controller boot the updated region. Staged, the port is still up
+* and is only disabled now. The boot loader tries Region-0 first, so if that
+* is the active one its first sector is saved and erased; the copy to it
+* (pass 1) erases and rewrites it anyway. GAID brings the port back up.
+* If BootFlags don't show a clean boot of the updated region, the sector is
+* written back and the old image booted again.
+*/
+static int SwitchToUpdatedRegion(s_TPS_dev *p_dev)
+{
+    s_TPS_flem flemInData = {0};
+
+    unsigned char outdata[64];
+
+    unsigned long long start = tps65987_now_us();
+
+    p_dev->flash_upgrade_para.fallback_saved = 0;
+
+    //with the port still up
+    if(p_dev->flash_upgrade_para.active_region == REGION_0 && SaveFallbackSector(p_dev) != 0)
+    {
+        return -1;
+    }
+
+    if(p_dev->flash_upgrade_para.port_down_start_us == 0 && DisablePort(p_dev) != 0)
+    {
+        return -1;
+    }
+
+    if(p_dev->flash_upgrade_para.active_region == REGION_0)
+    {
+        flemInData.flashaddr = p_dev->flash_upgrade_para.region_addr[REGION_0];
+        flemInData.numof4ksector = 1;
+
+        ClearSectorMap(p_dev, REGION_0, 0);
+
+        if(ExecFlashCmd(p_dev, "FLem", (unsigned char *)&flemInData, 5, outdata, 1) != 0 || outdata[0] != 0)
+        {
+            printf("Region[0] invalidate FAILED.!\n\r");
+            goto rollback;
+        }
+    }
+
+    printf("switch over to Region[%d]\n", p_dev->flash_upgrade_para.inactive_region);
+
+    tps65987_dev_reset(p_dev);
+
+    if(!IsBootedFrom(p_dev, p_dev->flash_upgrade_para.inactive_region))
+    {
+        printf("Region[%d] didn't boot.!\n\r", p_dev->flash_upgrade_para.inactive_region);
+        goto rollback;
+    }
+
+    p_dev->flash_upgrade_para.switched = 1;
+    PortBackUp(p_dev);
+
+    p_dev->upgrade_stats.phase_us[PHASE_RESET] += tps65987_now_us() - start;
+
+    return 0;
+
+rollback:
+    if(p_dev->flash_upgrade_para.fallback_saved && RestoreFallbackSector(p_dev) != 0)
+    {
+        printf("Region[0] restore FAILED.!\n\r");
+    }
+
+    printf("back to Region[%d]\n", p_dev->flash_upgrade_para.active_region);
+
+    tps65987_dev_reset(p_dev);
+
+    PortBackUp(p_dev);
+
+    p_dev->upgrade_stats.phase_us[PHASE_RESET] += tps65987_now_us() - start;
+
+    return -1;
+}
+
+
+/*
+* FLrd the first sector of Region-0 before SwitchToUpdatedRegion() erases it
+*/
+static int SaveFallbackSector(s_TPS_dev *p_dev)
+{
+    s_TPS_flrd flrdInData = {0};
+
+    unsigned int off;
+
+    for(off = 0; off < FLASH_SECTOR_SIZE; off += FLASH_READ_CHUNK_SIZE)
+    {
+        flrdInData.flashaddr = p_dev->flash_upgrade_para.region_addr[REGION_0] + off;
+
+        if(tps65987_dev_exec_4CC_Cmd(p_dev, "FLrd", (unsigned char *)&flrdInData, 4,
+                                     &p_dev->flash_upgrade_para.fallback_sector[off], FLASH_READ_CHUNK_SIZE) != 0)
+        {
+            printf("4CC_Cmd FLrd FAILED.!\n\r");
+            return -1;
+        }
+    }
+
+    p_dev->flash_upgrade_para.fallback_saved = 1;
+
+    return 0;
+}
+
+
+static int RestoreFallbackSector(s_TPS_dev *p_dev)
+{
+    s_TPS_flem flemInData = {0};
+    s_TPS_flad fladInData = {0};
+
+    unsigned char frame[IMAGE_FRAME_SIZE];
+    unsigned char outdata[64];
+
+    unsigned int off;
+
+    flemInData.flashaddr = p_dev->flash_upgrade_para.region_addr[REGION_0];
+    flemInData.numof4ksector = 1;
+
+    if(ExecFlashCmd(p_dev, "FLem", (unsigned char *)&flemInData, 5, outdata, 1) != 0 || outdata[0] != 0)
+    {
+        return -1;
+    }
+
+    fladInData.flashaddr = p_dev->flash_upgrade_para.region_addr[REGION_0];
+
+    if(ExecFlashCmd(p_dev, "FLad", (unsigned char *)&fladInData, 4, outdata, 1) != 0)
+    {
+        return -1;
+    }
+
+    frame[0] = REG_DATA1;
+    frame[1] = FLASH_WRITE_CHUNK_SIZE;
+
+    for(off = 0; off < FLASH_SECTOR_SIZE; off += FLASH_WRITE_CHUNK_SIZE)
+    {
+        memcpy(&frame[IMAGE_FRAME_HDR_SIZE], &p_dev->flash_upgrade_para.fallback_sector[off], FLASH_WRITE_CHUNK_SIZE);
+
+        if(tps65987_dev_exec_4CC_Frame(p_dev, "FLwd", frame, IMAGE_FRAME_SIZE, outdata, 1) != 0 || outdata[0] != 0)
+        {
+            return -1;
+        }
+    }
+
+    printf("Region[0] first sector restored\n");
+
+    return 0;
+}
+
+
+/*
+* after GAID: runs the application, and BootFlags (0x2D) show that it came
+* from 'region' without a flash or CRC error
+*/
+static int IsBootedFrom(s_TPS_dev *p_dev, unsigned char region)
+{
+    unsigned char mode[4];
+    unsigned char buf[64];
+
+    if(tps65987_dev_read(p_dev, REG_MODE, mode, 4) != 0 || tps65987_dev_read(p_dev, REG_BootFlags, buf, 12) != 0)
+    {
+        return 0;
+    }
+
+    printf("TPS_bootflag = 0x%08x, mode %.4s\n", tps65987_field_get(buf, 0, 32), mode);
+
+    if(memcmp(mode, "APP ", 4) != 0)
+    {
+        return 0;
+    }
+
+    //Region1 set: Region-0 was tried and didn't boot
+    if(region == REGION_0)
+    {
+        return tps65987_boot_flags_region_0(buf) && !tps65987_boot_flags_region_1(buf) &&
+               !tps65987_boot_flags_region_0_invalid(buf) && !tps65987_boot_flags_region_0_flash_error(buf) &&
+               !tps65987_boot_flags_region_0_crc_fail(buf);
+    }
+
+    return tps65987_boot_flags_region_1(buf) && !tps65987_boot_flags_region_1_invalid(buf) &&
+           !tps65987_boot_flags_region_1_flash_error(buf) && !tps65987_boot_flags_region_1_crc_fail(buf);
+}
+
+
+/*
+* Locate both regions (FLrr) and size the erase by the image: every 4k sector
+* up to the end of the image or of its patch bundle, whichever is further.
+* That has to fit in the region, which ends where the other region starts;
+* the upper region is taken to be as large as the lower one.
+*/
+static int PlanFlashUpdate(s_TPS_dev *p_dev, const s_TPS_image *p_image)
+{
+    unsigned char regionnum;
+
+    unsigned char outdata[64];
+
+    unsigned int *region_addr = p_dev->flash_upgrade_para.region_addr;
+    unsigned int region_size;
+    unsigned int image_end;
+    int num_sectors;
+    int region;
+
+    for(region = REGION_0; region <= REGION_1; region++)
+    {
+        regionnum = region;
+
+        if(ExecFlashCmd(p_dev, "FLrr", &regionnum, 1, outdata, 4) != 0)
+        {
+            printf("4CC_Cmd FLrr FAILED.!\n\r");
+            return -1;
+        }
+
+        region_addr[region] = (outdata[3] << 24) | (outdata[2] << 16) | (outdata[1] << 8) | outdata[0];
+
+        printf("Region[%d] @ 0x%08x\n", region, region_addr[region]);
+    }
+
+    region_size = region_addr[REGION_1] > region_addr[REGION_0] ?
+                  region_addr[REGION_1] - region_addr[REGION_0] : region_addr[REGION_0] - region_addr[REGION_1];
+
+    image_end = p_image->size > p_image->bundle_end ? p_image->size : p_image->bundle_end;
+    num_sectors = (image_end + FLASH_SECTOR_SIZE - 1) / FLASH_SECTOR_SIZE;
+
+    if(region_size < FLASH_SECTOR_SIZE || num_sectors * FLASH_SECTOR_SIZE > region_size || num_sectors > FLASH_MAX_SECTORS)
+    {
+        printf("image needs [%d] 4k sectors, regions @ 0x%x / 0x%x only hold %u bytes\n\r",
+               num_sectors, region_addr[REGION_0], region_addr[REGION_1], region_size);
+        return -1;
+    }
+
+    p_dev->flash_upgrade_para.region_size = region_size;
+    p_dev->flash_upgrade_para.num_sectors = num_sectors;
+
+    printf("image %u bytes (patch bundle ends @ 0x%x): [%d] 4k sectors of a 0x%x byte region\n",
+           p_image->size, p_image->bundle_end, num_sectors, region_size);
+
+    return 0;
+}
+
+
+/*
+* the journal says the first pass is through: check that the region still
+* verifies and ends with the last chunk of the image
+*/
+static int IsRegionWritten(s_TPS_dev *p_dev, const s_TPS_image *p_image, unsigned int regAddr)
+{
+    s_TPS_flvy flvyInData = {0};
+    unsigned char outdata[64];
+
+    flvyInData.flashaddr = regAddr;
+
+    if(ExecFlashCmd(p_dev, "FLvy", (unsigned char *)&flvyInData, 4, outdata, 1) != 0 || outdata[0] != 0)
+    {
+        printf("resume: Region @ 0x%x doesn't verify\n", regAddr);
+        return 0;
+    }
+
+    return IsChunkWritten(p_dev, p_image, regAddr, p_image->num_chunks - 1);
+}
+
+
+static int StartFlashUpdate(s_TPS_dev *p_dev, const s_TPS_image *p_image)
+{
+    int retVal;
+
+    unsigned long long phase_start;
+
+    printf("\n\rActive Region is [%d] - Region being updated is [%d]\n\r",
+           p_dev->flash_upgrade_para.active_region, p_dev->flash_upgrade_para.inactive_region);
+
+    p_dev->flash_upgrade_para.region_pass = 0;
+    p_dev->journal.rec.active_region = p_dev->flash_upgrade_para.active_region;
+
+    phase_start = tps65987_now_us();
+
+    retVal = PlanFlashUpdate(p_dev, p_image);
+
+    UpgradePhaseDone(p_dev, PHASE_FLRR, &phase_start);
+
+    if(retVal != 0)
+    {
+        return -1;
+    }
+
+    /*
+    * Region-0 is currently active, hence update Region-1
+    * (unless that is already done and verified, see the journal)
+    */
+    if(p_dev->flash_upgrade_para.resume && p_dev->journal.rec.region_pass == 1 &&
+       IsRegionWritten(p_dev, p_image, p_dev->flash_upgrade_para.region_addr[p_dev->flash_upgrade_para.inactive_region]))
+    {
+        printf("resume: Region[%d] already updated\n", p_dev->flash_upgrade_para.inactive_region);
+        atomic_store(&p_dev->total_bytes, p_image->size * 2);
+        atomic_store(&p_dev->progress_bytes, p_image->size);
+        retVal = 0;
+    }
+    else
+    {
+        retVal = UpdateAndVerifyRegion(p_dev, p_dev->flash_upgrade_para.inactive_region, p_image);
+    }
+
+    if(retVal != 0)
+    {
+        printf("Region[%d] update failed.! Next boot will happen from Region[%d]\n\r",\
+               p_dev->flash_upgrade_para.inactive_region, p_dev->flash_upgrade_para.active_region);
+        retVal = -1;
+        goto error;
+    }
+
+    /*
     * Region-1 is successfully updated.
     * To maintain a redundant copy for a fail-safe flash-update, copy the same
     * content at Region-0
     */
     printf("Region-%d is successfully updated.To maintain a redundant copy for a fail-safe flash-update, \
-    copy the same content at Region-%d",flash_upgrade_para.inactive_region,flash_upgrade_para.active_region);
+    copy the same content at Region-%d",p_dev->flash_upgrade_para.inactive_region,p_dev->flash_upgrade_para.active_region);
+
+    p_dev->flash_upgrade_para.region_pass = 1;
+    phase_start = tps65987_now_us();
+
+    /*
+    * Deferred: run the new image right away, the copy waits for
+    * tps65987_dev_copy_region(); the journal only records the second pass
+    * once the switch over is through
+    */
+    if((p_dev->flash_upgrade_para.upgrade_flags & UPGRADE_FLAG_DEFERRED) &&
+       !(p_dev->flash_upgrade_para.resume && p_dev->journal.rec.region_pass == 1))
+    {
+        if(SwitchToUpdatedRegion(p_dev) != 0)
+        {
+            printf("switch over failed.! Next boot will happen from Region[%d]\n\r", p_dev->flash_upgrade_para.active_region);
+            return -1;
+        }
+
+        p_dev->journal.rec.region_pass = 1;
+        p_dev->journal.rec.write_offset = JOURNAL_NOT_STARTED;
+        tps65987_journal_write(&p_dev->journal);
+
+        printf("Region-%d runs the new image, copy to Region-%d deferred\n",
+               p_dev->flash_upgrade_para.inactive_region, p_dev->flash_upgrade_para.active_region);
+
+        p_dev->flash_upgrade_para.copy_pending = 1;
+        return 0;
+    }
+
+    //from here on an interruption only costs the second pass
+    if(!(p_dev->flash_upgrade_para.resume && p_dev->journal.rec.region_pass == 1))
+    {
+        p_dev->journal.rec.region_pass = 1;
+        p_dev->journal.rec.write_offset = JOURNAL_NOT_STARTED;
+        tps65987_journal_write(&p_dev->journal);
+    }
+
+    /*
+    * Staged: run the new image before the copy, unless the copy was
+    * already under way when the upgrade got interrupted
+    */
+    if((p_dev->flash_upgrade_para.upgrade_flags & (UPGRADE_FLAG_STAGED | UPGRADE_FLAG_DEFERRED)) == UPGRADE_FLAG_STAGED &&
+       !(p_dev->flash_upgrade_para.resume && p_dev->journal.rec.write_offset != JOURNAL_NOT_STARTED))
+    {
+        if(SwitchToUpdatedRegion(p_dev) != 0)
+        {
+            printf("switch over failed.! Next boot will happen from Region[%d]\n\r", p_dev->flash_upgrade_para.active_region);
+            retVal = -1;
+            goto error;
+        }
 
-    retVal = UpdateAndVerifyRegion(flash_upgrade_para.active_region, ota_file_name);
+        phase_start = tps65987_now_us();
+    }
+    else if(p_dev->flash_upgrade_para.upgrade_flags & (UPGRADE_FLAG_STAGED | UPGRADE_FLAG_DEFERRED))
+    {
+        p_dev->flash_upgrade_para.switched = 1;
+    }
+
+    retVal = UpdateAndVerifyRegion(p_dev, p_dev->flash_upgrade_para.active_region, p_image);
+
+    UpgradePhaseDone(p_dev, PHASE_SECOND_REGION, &phase_start);
     if(retVal != 0)
     {
         printf("Region[%d] update failed.! Next boot will happen from Region[%d]\n\r",\
-               flash_upgrade_para.active_region, flash_upgrade_para.inactive_region);
+               p_dev->flash_upgrade_para.active_region, p_dev->flash_upgrade_para.inactive_region);
         retVal = -1;
         goto error;
     }
@@ -546,533 +1220,1336 @@ error:
 }
 
 
-static int UpdateAndVerifyRegion(unsigned char region_number, char *ota_file_name)
+static int IsBlankChunk(unsigned char *buf, int len)
+{
+    int i;
+
+    for(i = 0; i < len; i++)
+    {
+        if(buf[i] != FLASH_ERASED_VALUE)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+
+/*
+* the sector map lives next to the journal, no journal no map
+*/
+static int SectorMapFile(s_TPS_dev *p_dev, char *file_name, unsigned int size)
+{
+    if(p_dev->journal_file[0] == 0)
+    {
+        return -1;
+    }
+
+    snprintf(file_name, size, "%s%s", p_dev->journal_file, SECTOR_MAP_SUFFIX);
+
+    return 0;
+}
+
+
+/*
+* Region 'region_number' holds p_image from now on, or with p_image NULL is
+* about to change and holds nothing known
+*/
+static void SetSectorMap(s_TPS_dev *p_dev, unsigned char region_number, unsigned int regAddr, const s_TPS_image *p_image)
+{
+    s_TPS_sector_map map;
+    s_TPS_sector_map_region *p_region;
+    char file_name[sizeof(p_dev->journal_file) + sizeof(SECTOR_MAP_SUFFIX)];
+    unsigned int sector;
+
+    if(region_number >= SECTOR_MAP_REGIONS || SectorMapFile(p_dev, file_name, sizeof(file_name)) != 0)
+    {
+        return;
+    }
+
+    tps65987_sector_map_load(&map, file_name);
+
+    p_region = &map.region[region_number];
+    p_region->region_addr = regAddr;
+    p_region->num_sectors = 0;
+
+    if(p_image != NULL)
+    {
+        p_region->num_sectors = (p_image->size + FLASH_SECTOR_SIZE - 1) / FLASH_SECTOR_SIZE;
+        if(p_region->num_sectors > JOURNAL_MAX_SECTORS)
+        {
+            p_region->num_sectors = 0;
+        }
+
+        for(sector = 0; sector < p_region->num_sectors; sector++)
+        {
+            p_region->digest[sector] = tps65987_sector_digest(p_image->data, p_image->size, sector);
+        }
+    }
+
+    tps65987_sector_map_save(&map, file_name);
+}
+
+
+/*
+* one sector of the region is about to be erased, the rest stays known
+*/
+static void ClearSectorMap(s_TPS_dev *p_dev, unsigned char region_number, unsigned int sector)
+{
+    s_TPS_sector_map map;
+    char file_name[sizeof(p_dev->journal_file) + sizeof(SECTOR_MAP_SUFFIX)];
+
+    if(region_number >= SECTOR_MAP_REGIONS || sector >= JOURNAL_MAX_SECTORS ||
+       SectorMapFile(p_dev, file_name, sizeof(file_name)) != 0 || tps65987_sector_map_load(&map, file_name) != 0)
+    {
+        return;
+    }
+
+    map.region[region_number].digest[sector] = SECTOR_MAP_UNKNOWN;
+
+    tps65987_sector_map_save(&map, file_name);
+}
+
+
+/*
+* Mark the 4k sectors of the image which differ from what the sector map says
+* the region holds. A sector the map has unchanged is confirmed with
+* SECTOR_MAP_PROBES FLrd spread over it; if one doesn't match, the map is
+* stale. What the probes miss, FLvy catches (see UpdateAndVerifyRegion()).
+* return 0 if the whole image could be compared, -1 if there is no usable map
+* or any readback failed
+*/
+static int CompareRegionSectors(s_TPS_dev *p_dev, const s_TPS_image *p_image, unsigned char region_number,
+                                unsigned int regAddr, int num_sectors)
+{
+    unsigned char outdata[FLASH_READ_CHUNK_SIZE];
+    unsigned char expected[FLASH_READ_CHUNK_SIZE];
+
+    s_TPS_flrd flrdInData = {0};
+    s_TPS_sector_map map;
+    s_TPS_sector_map_region *p_region;
+    char file_name[sizeof(p_dev->journal_file) + sizeof(SECTOR_MAP_SUFFIX)];
+
+    int sector;
+    int probe;
+    unsigned int pos;
+    unsigned int i;
+
+    if(region_number >= SECTOR_MAP_REGIONS || SectorMapFile(p_dev, file_name, sizeof(file_name)) != 0 ||
+       tps65987_sector_map_load(&map, file_name) != 0)
+    {
+        printf("no sector map\n");
+        return -1;
+    }
+
+    p_region = &map.region[region_number];
+    if(p_region->num_sectors == 0 || p_region->region_addr != regAddr)
+    {
+        printf("sector map: Region[%d] @ 0x%x unknown\n", region_number, regAddr);
+        return -1;
+    }
+
+    for(sector = 0; sector < num_sectors; sector++)
+    {
+        p_dev->flash_upgrade_para.dirty_sector[sector] =
+            sector >= (int)p_region->num_sectors ||
+            p_region->digest[sector] != tps65987_sector_digest(p_image->data, p_image->size, sector);
+
+        if(p_dev->flash_upgrade_para.dirty_sector[sector])
+        {
+            printf("sector %d @ 0x%x changed\n", sector, regAddr + sector * FLASH_SECTOR_SIZE);
+            continue;
+        }
+
+        for(probe = 0; probe < SECTOR_MAP_PROBES; probe++)
+        {
+            pos = sector * FLASH_SECTOR_SIZE +
+                  probe * ((FLASH_SECTOR_SIZE - FLASH_READ_CHUNK_SIZE) / FLASH_READ_CHUNK_SIZE / (SECTOR_MAP_PROBES - 1)) *
+                  FLASH_READ_CHUNK_SIZE;
+
+            for(i = 0; i < FLASH_READ_CHUNK_SIZE; i++)
+            {
+                expected[i] = pos + i < p_image->size ? p_image->data[pos + i] : FLASH_ERASED_VALUE;
+            }
+
+            flrdInData.flashaddr = regAddr + pos;
+            if(tps65987_dev_exec_4CC_Cmd(p_dev, "FLrd", (unsigned char *)&flrdInData, 4, outdata, FLASH_READ_CHUNK_SIZE) != 0)
+            {
+                printf("4CC_Cmd FLrd FAILED @ 0x%x.!\n\r", flrdInData.flashaddr);
+                return -1;
+            }
+
+            if(memcmp(outdata, expected, FLASH_READ_CHUNK_SIZE) != 0)
+            {
+                printf("sector map: sector %d @ 0x%x doesn't hold what it says, stale\n", sector, flrdInData.flashaddr);
+                return -1;
+            }
+        }
+
+        printf("sector %d @ 0x%x unchanged\n", sector, regAddr + sector * FLASH_SECTOR_SIZE);
+    }
+
+    return 0;
+}
+
+
+/*
+* Erase every run of consecutive dirty sectors, with one FLem per run or, for
+* runs longer than FLASH_ERASE_BATCH_SECTORS, with as few equally sized
+* FLem batches as fit
+*/
+static int EraseDirtySectors(s_TPS_dev *p_dev, unsigned int regAddr, int num_sectors)
+{
+    unsigned char outdata[64];
+
+    s_TPS_flem flemInData = {0};
+
+    int start;
+    int end;
+    int batches;
+    int batch;
+    int first;
+    int count;
+
+    for(start = 0; start < num_sectors; start = end)
+    {
+        if(!p_dev->flash_upgrade_para.dirty_sector[start])
+        {
+            end = start + 1;
+            continue;
+        }
+
+        for(end = start; end < num_sectors && p_dev->flash_upgrade_para.dirty_sector[end]; end++);
+
+        batches = (end - start + FLASH_ERASE_BATCH_SECTORS - 1) / FLASH_ERASE_BATCH_SECTORS;
+
+        for(batch = 0; batch < batches; batch++)
+        {
+            first = start + (end - start) * batch / batches;
+            count = start + (end - start) * (batch + 1) / batches - first;
+
+            flemInData.flashaddr = regAddr + first * FLASH_SECTOR_SIZE;
+            flemInData.numof4ksector = count;
+
+            if(ExecFlashCmd(p_dev, "FLem", (unsigned char *)&flemInData, 5, outdata, 1) != 0)
+            {
+                printf("4CC_Cmd FLem FAILED.!\n\r");
+                return -1;
+            }
+
+            if(outdata[0] != 0)
+            {
+                printf("Flash Erase FAILED.! 0x%x\n\r",outdata[0]);
+                return -1;
+            }
+
+            printf("Flash Erase Success.! [%d] 4k sectors @ 0x%x\n\r", flemInData.numof4ksector, flemInData.flashaddr);
+        }
+    }
+
+    return 0;
+}
+
+
+/*
+* FLrd the chunk back and compare it with its frame data, which is padded
+* with 0xFF like it was written
+*/
+static int IsChunkWritten(s_TPS_dev *p_dev, const s_TPS_image *p_image, unsigned int regAddr, unsigned int chunk)
+{
+    s_TPS_flrd flrdInData = {0};
+
+    unsigned char outdata[FLASH_READ_CHUNK_SIZE];
+    unsigned char *chunk_data;
+    unsigned int off;
+
+    chunk_data = tps65987_image_frame(p_image, chunk) + 2;
+
+    for(off = 0; off < FLASH_WRITE_CHUNK_SIZE; off += FLASH_READ_CHUNK_SIZE)
+    {
+        flrdInData.flashaddr = regAddr + chunk * FLASH_WRITE_CHUNK_SIZE + off;
+
+        if(tps65987_dev_exec_4CC_Cmd(p_dev, "FLrd", (unsigned char *)&flrdInData, 4, outdata, FLASH_READ_CHUNK_SIZE) != 0 ||
+           memcmp(outdata, &chunk_data[off], FLASH_READ_CHUNK_SIZE) != 0)
+        {
+            printf("resume: readback @ 0x%x differs\n", flrdInData.flashaddr);
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+
+/*
+* Can the pass the journal describes go on at its write_offset? It has to be
+* this pass of this region, and the chunk before write_offset has to read
+* back as written. Chunks after it may have been written before the
+* interruption as well; FLwd of the same data again is harmless on NOR flash.
+*/
+static int CanResumeRegion(s_TPS_dev *p_dev, const s_TPS_image *p_image, unsigned int regAddr, int num_sectors)
+{
+    s_TPS_journal_rec *p_rec = &p_dev->journal.rec;
+
+    if(!p_dev->flash_upgrade_para.resume || p_rec->region_pass != p_dev->flash_upgrade_para.region_pass ||
+       p_rec->write_offset == JOURNAL_NOT_STARTED || p_rec->region_addr != regAddr || p_rec->num_sectors != num_sectors ||
+       p_rec->write_offset % FLASH_WRITE_CHUNK_SIZE != 0 || p_rec->write_offset > p_image->num_chunks * FLASH_WRITE_CHUNK_SIZE)
+    {
+        return 0;
+    }
+
+    if(p_rec->write_offset == 0)
+    {
+        return 1;
+    }
+
+    return IsChunkWritten(p_dev, p_image, regAddr, p_rec->write_offset / FLASH_WRITE_CHUNK_SIZE - 1);
+}
+
+
+/*
+* FLad if needed, then FLwd of the chunk at write_offset; 0 or -1 with the
+* reason in last_error
+*/
+static int WriteChunk(s_TPS_dev *p_dev, const s_TPS_image *p_image, unsigned int regAddr, unsigned int chunk)
+{
+    s_TPS_flad fladInData = {0};
+
+    unsigned char outdata[64];
+
+    if(p_dev->flash_upgrade_para.need_flad)
+    {
+        /*
+        * Set the start address for the next write
+        */
+        fladInData.flashaddr = regAddr + p_dev->flash_upgrade_para.write_offset;
+
+        if(tps65987_dev_exec_4CC_Cmd(p_dev, "FLad", (unsigned char *)&fladInData, 4, outdata, 1) != 0)
+        {
+            printf("4CC_Cmd FLad FAILED.! %s\n\r", tps65987_error_name(p_dev->last_error));
+            return -1;
+        }
+
+        p_dev->flash_upgrade_para.need_flad = 0;
+    }
+
+    /*
+    * Execute FLwd with the prebuilt frame of this chunk, the last
+    * one is padded to 64 bytes with 0xFF
+    */
+    if(tps65987_dev_exec_4CC_Frame(p_dev, "FLwd", tps65987_image_frame(p_image, chunk), IMAGE_FRAME_SIZE, outdata, 1) != 0)
+    {
+        printf("4CC_Cmd FLwd FAILED.! %s\n\r", tps65987_error_name(p_dev->last_error));
+        return -1;
+    }
+
+    /*
+    * 'outdata[1]' will contain the command's return code
+    */
+    if(outdata[0] != 0)
+    {
+        printf("Flash Write FAILED.! 0x%x\n\r", outdata[0]);
+        p_dev->last_error = TPS_ERR_FLASH;
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/*
+* Write a chunk, and if that fails write it again from its own address a few
+* times: programming the same data twice is harmless on NOR flash. If it still
+* fails, erase its sector again (once per sector and pass) so the caller can
+* rewrite the sector from the start.
+* 0: written, 1: sector erased again, rewind to its start, -1: give up
+*/
+static int WriteChunkWithRetry(s_TPS_dev *p_dev, const s_TPS_image *p_image, unsigned int regAddr, unsigned int chunk)
+{
+    s_TPS_flem flemInData = {0};
+
+    unsigned char outdata[64];
+
+    unsigned int backoff_us = FLASH_RETRY_BACKOFF_US;
+    unsigned int sector;
+    int retry;
+
+    for(retry = 0; ; retry++)
+    {
+        if(WriteChunk(p_dev, p_image, regAddr, chunk) == 0)
+        {
+            return 0;
+        }
+
+        p_dev->upgrade_stats.errors[p_dev->last_error]++;
+
+        //the controller doesn't know the command, or nothing answers at all
+        if(p_dev->last_error == TPS_ERR_UNRECOGNIZED || retry == FLASH_CHUNK_RETRIES)
+        {
+            break;
+        }
+
+        printf("chunk [%u] @ 0x%x: retry %d\n", chunk, regAddr + p_dev->flash_upgrade_para.write_offset, retry + 1);
+
+        tps65987_sleep_us(backoff_us);
+        backoff_us *= 2;
+
+        p_dev->upgrade_stats.retried_chunks++;
+        p_dev->flash_upgrade_para.need_flad = 1;
+    }
+
+    sector = p_dev->flash_upgrade_para.write_offset / FLASH_SECTOR_SIZE;
+
+    //erasing only helps if the controller answers and the flash is the problem
+    if(p_dev->last_error == TPS_ERR_UNRECOGNIZED || p_dev->last_error == TPS_ERR_BUS || sector >= FLASH_MAX_SECTORS ||
+       p_dev->flash_upgrade_para.reerased[sector] >= FLASH_SECTOR_RETRIES)
+    {
+        return -1;
+    }
+
+    p_dev->flash_upgrade_para.reerased[sector]++;
+
+    //an interruption from here on has to start over at the sector
+    p_dev->journal.rec.write_offset = sector * FLASH_SECTOR_SIZE;
+    tps65987_journal_write(&p_dev->journal);
+
+    flemInData.flashaddr = regAddr + sector * FLASH_SECTOR_SIZE;
+    flemInData.numof4ksector = 1;
+
+    if(ExecFlashCmd(p_dev, "FLem", (unsigned char *)&flemInData, 5, outdata, 1) != 0 || outdata[0] != 0)
+    {
+        printf("sector @ 0x%x: erase again FAILED.!\n\r", flemInData.flashaddr);
+        return -1;
+    }
+
+    printf("sector @ 0x%x erased again, rewriting it\n", flemInData.flashaddr);
+
+    p_dev->upgrade_stats.reerased_sectors++;
+
+    return 1;
+}
+
+
+/*
+* erase the dirty sectors and record them in the journal, the write starts at
+* offset 0
+*/
+static int EraseForWrite(s_TPS_dev *p_dev, unsigned int regAddr, int num_sectors)
+{
+    if(EraseDirtySectors(p_dev, regAddr, num_sectors) != 0)
+    {
+        return -1;
+    }
+
+    p_dev->journal.rec.region_pass = p_dev->flash_upgrade_para.region_pass;
+    p_dev->journal.rec.region_addr = regAddr;
+    p_dev->journal.rec.num_sectors = num_sectors;
+    p_dev->journal.rec.write_offset = 0;
+    memcpy(p_dev->journal.rec.erased, p_dev->flash_upgrade_para.dirty_sector, num_sectors);
+    tps65987_journal_write(&p_dev->journal);
+
+    return 0;
+}
+
+
+static int UpdateAndVerifyRegion(s_TPS_dev *p_dev, unsigned char region_number, const s_TPS_image *p_image)
+{
+    unsigned int chunk;
+    unsigned int len;
+
+    int i;
+
+    s_TPS_flvy flvyInData = {0};
+
+    unsigned char outdata[64];
+
+    int retVal = -1;
+
+    unsigned int regAddr = 0;
+
+    int num_sectors;
+    int num_dirty;
+    int resume;
+    unsigned int rewind;
+
+    unsigned long long phase_start = tps65987_now_us();
+
+    /*
+    * the location of the region 'region_number', see PlanFlashUpdate()
+    */
+    regAddr = p_dev->flash_upgrade_para.region_addr[region_number];
+
+    printf("regAddr = 0x%08x\n", regAddr);
+
+    if(p_dev->flash_upgrade_para.region_pass == 0)
+    {
+        //both regions get the whole image
+        atomic_store(&p_dev->total_bytes, p_image->size * 2);
+    }
+
+    /*
+    * Erase the #'num_sectors' 4k sectors the image covers at address 'regAddr'
+    * of the sFLASH, sized by PlanFlashUpdate()
+    */
+    num_sectors = p_dev->flash_upgrade_para.num_sectors;
+    memset(p_dev->flash_upgrade_para.dirty_sector, 1, sizeof(p_dev->flash_upgrade_para.dirty_sector));
+
+    resume = CanResumeRegion(p_dev, p_image, regAddr, num_sectors);
+    p_dev->flash_upgrade_para.resume = 0;
+
+    if(resume)
+    {
+        /*
+        * Resume: what was erased is in the journal, nothing to read back or erase
+        */
+        memcpy(p_dev->flash_upgrade_para.dirty_sector, p_dev->journal.rec.erased, num_sectors);
+
+        printf("resume: Region[%d] from offset 0x%x\n", region_number, p_dev->journal.rec.write_offset);
+    }
+    else if(p_dev->flash_upgrade_para.upgrade_flags & UPGRADE_FLAG_DELTA)
+    {
+        /*
+        * Delta mode: only erase the sectors which changed since the last verified write
+        */
+        if(CompareRegionSectors(p_dev, p_image, region_number, regAddr, num_sectors) != 0)
+        {
+            printf("Region[%d] not comparable, fall back to full write\n", region_number);
+            memset(p_dev->flash_upgrade_para.dirty_sector, 1, sizeof(p_dev->flash_upgrade_para.dirty_sector));
+        }
+    }
+
+    UpgradePhaseDone(p_dev, PHASE_READBACK, &phase_start);
+
+    num_dirty = 0;
+    for(i = 0; i < num_sectors; i++)
+    {
+        num_dirty += p_dev->flash_upgrade_para.dirty_sector[i];
+    }
+
+    if(!resume)
+    {
+        SetSectorMap(p_dev, region_number, regAddr, NULL);
+
+        if(EraseForWrite(p_dev, regAddr, num_sectors) != 0)
+        {
+            return -1;
+        }
+    }
+
+    UpgradePhaseDone(p_dev, PHASE_FLEM, &phase_start);
+
+    printf("Updating [%d] of [%d] 4k chunks starting @ 0x%x \n\r", num_dirty, num_sectors, regAddr);
+
+    /*
+    * The write address is set lazily (FLad) before the first chunk that is
+    * actually written, and again after any chunk that was skipped
+    */
+    p_dev->flash_upgrade_para.write_offset = resume ? p_dev->journal.rec.write_offset : 0;
+    p_dev->flash_upgrade_para.need_flad = 1;
+    p_dev->flash_upgrade_para.written_chunks = 0;
+    p_dev->flash_upgrade_para.skipped_chunks = 0;
+    memset(p_dev->flash_upgrade_para.reerased, 0, sizeof(p_dev->flash_upgrade_para.reerased));
+
+    p_dev->flash_upgrade_para.flash_upgrade_finish = 0;
+    p_dev->flash_upgrade_para.flash_upgrade_state = OPEN_FILE;
+
+    chunk = 0;
+
+    while(!p_dev->flash_upgrade_para.flash_upgrade_finish)
+    {
+        switch(p_dev->flash_upgrade_para.flash_upgrade_state)
+        {
+            case OPEN_FILE:
+                //the image is loaded and its FLwd frames built by tps65987_image_load()
+                chunk = p_dev->flash_upgrade_para.write_offset / FLASH_WRITE_CHUNK_SIZE;
+
+                if(chunk != 0)
+                {
+                    atomic_fetch_add(&p_dev->progress_bytes, chunk * FLASH_WRITE_CHUNK_SIZE < p_image->size ?
+                                     chunk * FLASH_WRITE_CHUNK_SIZE : p_image->size);
+                }
+
+                p_dev->flash_upgrade_para.flash_upgrade_state = READ_FILE;
+                break;
+
+            case READ_FILE:
+                if(chunk == p_image->num_chunks)
+                {
+                    printf("[%u] chunks written, [%u] blank chunks skipped\n",
+                           p_dev->flash_upgrade_para.written_chunks, p_dev->flash_upgrade_para.skipped_chunks);
+
+                    p_dev->upgrade_stats.written_chunks += p_dev->flash_upgrade_para.written_chunks;
+                    p_dev->upgrade_stats.skipped_chunks += p_dev->flash_upgrade_para.skipped_chunks;
+                    UpgradePhaseDone(p_dev, PHASE_WRITE, &phase_start);
+
+                    p_dev->flash_upgrade_para.flash_upgrade_state = VERIFY_IF_VALID;
+                    break;
+                }
+
+                len = tps65987_image_chunk_len(p_image, chunk);
+                chunk++;
+
+                /*
+                * sector unchanged, nothing was erased there so leave it alone
+                */
+                if(p_dev->flash_upgrade_para.write_offset / FLASH_SECTOR_SIZE < num_sectors &&
+                   !p_dev->flash_upgrade_para.dirty_sector[p_dev->flash_upgrade_para.write_offset / FLASH_SECTOR_SIZE])
+                {
+                    p_dev->flash_upgrade_para.write_offset += FLASH_WRITE_CHUNK_SIZE;
+                    p_dev->flash_upgrade_para.need_flad = 1;
+                    atomic_fetch_add(&p_dev->progress_bytes, len);
+                    break;
+                }
+
+                /*
+                * sparse: the sector was just erased, so an all-0xFF chunk is already there
+                */
+                if((p_dev->flash_upgrade_para.upgrade_flags & UPGRADE_FLAG_SPARSE) &&
+                   p_dev->flash_upgrade_para.write_offset / FLASH_SECTOR_SIZE < num_sectors &&
+                   IsBlankChunk(tps65987_image_chunk(p_image, chunk - 1), len))
+                {
+                    p_dev->flash_upgrade_para.write_offset += FLASH_WRITE_CHUNK_SIZE;
+                    p_dev->flash_upgrade_para.need_flad = 1;
+                    atomic_fetch_add(&p_dev->progress_bytes, len);
+                    p_dev->flash_upgrade_para.skipped_chunks++;
+                    break;
+                }
+
+                retVal = WriteChunkWithRetry(p_dev, p_image, regAddr, chunk - 1);
+
+                if(retVal < 0)
+                {
+                    return -1;
+                }
+
+                if(retVal > 0)
+                {
+                    /*
+                    * The sector was erased again, write it from its start
+                    */
+                    rewind = p_dev->flash_upgrade_para.write_offset % FLASH_SECTOR_SIZE;
+
+                    p_dev->flash_upgrade_para.write_offset -= rewind;
+                    p_dev->flash_upgrade_para.need_flad = 1;
+                    chunk = p_dev->flash_upgrade_para.write_offset / FLASH_WRITE_CHUNK_SIZE;
+                    atomic_fetch_sub(&p_dev->progress_bytes, rewind);
+                    break;
+                }
+
+                p_dev->flash_upgrade_para.write_offset += FLASH_WRITE_CHUNK_SIZE;
+                p_dev->flash_upgrade_para.written_chunks++;
+                p_dev->upgrade_stats.payload_bytes += len;
+                atomic_fetch_add(&p_dev->progress_bytes, len);
+
+                if(++p_dev->journal.unsynced == JOURNAL_SYNC_CHUNKS)
+                {
+                    p_dev->journal.rec.write_offset = p_dev->flash_upgrade_para.write_offset;
+                    tps65987_journal_write(&p_dev->journal);
+                }
+                break;
+
+            case VERIFY_IF_VALID:
+                /*
+                * Write is through. Now verify if the content/copy is valid
+                */
+                flvyInData.flashaddr = regAddr;
+                retVal = ExecFlashCmd(p_dev, "FLvy", (unsigned char *)&flvyInData, 4, outdata, 1);
+
+                if(retVal != 0 || outdata[0] != 0)
+                {
+                    if(num_dirty == num_sectors)
+                    {
+                        printf("Flash Verify FAILED.!\n\r");
+                        return -1;
+                    }
+
+                    /*
+                    * Only some sectors were written (delta or resume) and the
+                    * ones left alone don't hold what was assumed: erase and
+                    * write the whole region once
+                    */
+                    printf("Flash Verify FAILED after writing [%d] of [%d] sectors, full write\n\r", num_dirty, num_sectors);
+
+                    memset(p_dev->flash_upgrade_para.dirty_sector, 1, sizeof(p_dev->flash_upgrade_para.dirty_sector));
+                    num_dirty = num_sectors;
+
+                    SetSectorMap(p_dev, region_number, regAddr, NULL);
+
+                    if(EraseForWrite(p_dev, regAddr, num_sectors) != 0)
+                    {
+                        return -1;
+                    }
+
+                    atomic_fetch_sub(&p_dev->progress_bytes, p_image->size);
+                    p_dev->upgrade_stats.full_rewrites++;
+
+                    p_dev->flash_upgrade_para.write_offset = 0;
+                    p_dev->flash_upgrade_para.need_flad = 1;
+                    p_dev->flash_upgrade_para.written_chunks = 0;
+                    p_dev->flash_upgrade_para.skipped_chunks = 0;
+                    memset(p_dev->flash_upgrade_para.reerased, 0, sizeof(p_dev->flash_upgrade_para.reerased));
+                    chunk = 0;
+
+                    p_dev->flash_upgrade_para.flash_upgrade_state = READ_FILE;
+                    break;
+                }
+
+                SetSectorMap(p_dev, region_number, regAddr, p_image);
+
+                UpgradePhaseDone(p_dev, PHASE_FLVY, &phase_start);
+
+                p_dev->flash_upgrade_para.flash_upgrade_state = CLOSE_FILE;
+                break;
+
+            case CLOSE_FILE:
+                p_dev->flash_upgrade_para.flash_upgrade_state = OPEN_FILE;
+                p_dev->flash_upgrade_para.flash_upgrade_finish = 1;
+                break;
+        }
+
+    }
+
+    return 0;
+}
+
+const char *tps65987_error_name(enum TPS_ERROR error)
+{
+    static const char *names[TPS_ERR_NUM] =
+    {
+        "none", "bus", "timeout", "reject", "unrecognized", "flash",
+    };
+
+    if(error < 0 || error >= TPS_ERR_NUM)
+    {
+        return "?";
+    }
+
+    return names[error];
+}
+
+
+/*
+* After GAID: poll CMD1, MODE and Version until the controller answers and
+* has left the boot loader. CMD1 still reads GAID while the old firmware
+* hasn't reset yet. 0 in APP mode, 1 in any other (e.g. PTCH: nothing valid
+* to boot), -1 if it didn't come back within RESET_TIMEOUT_MS.
+*/
+static int WaitBooted(s_TPS_dev *p_dev)
+{
+    unsigned char cmd[4];
+    unsigned char mode[4];
+    unsigned char version[4];
+    s_TPS_xact xact;
+
+    unsigned long long start = tps65987_now_us();
+    unsigned long long deadline = start + RESET_TIMEOUT_MS * 1000ULL;
+    unsigned int wait_us = READY_POLL_MIN_US;
+
+    for(;;)
+    {
+        tps65987_sleep_us(wait_us);
+        wait_us = wait_us * 2 < READY_POLL_MAX_US ? wait_us * 2 : READY_POLL_MAX_US;
+
+        tps65987_xact_init(&xact, p_dev->transport, p_dev->i2c_addr);
+        tps65987_xact_read(&xact, REG_CMD1, cmd, 4);
+        tps65987_xact_read(&xact, REG_MODE, mode, 4);
+        tps65987_xact_read(&xact, REG_Version, version, 4);
+
+        if(tps65987_xact_run(&xact) == 0 && memcmp(cmd, "GAID", 4) != 0 && memcmp(cmd, "Gaid", 4) != 0 &&
+           memcmp(mode, "BOOT", 4) != 0)
+        {
+            p_dev->upgrade_stats.boot_us += tps65987_now_us() - start;
+            printf("%.4s mode, version 0x%08x after %lluus\n", mode,
+                   version[0] | (version[1] << 8) | (version[2] << 16) | ((unsigned int)version[3] << 24), tps65987_now_us() - start);
+
+            return memcmp(mode, "APP ", 4) == 0 ? 0 : 1;
+        }
+
+        if(tps65987_now_us() >= deadline)
+        {
+            p_dev->upgrade_stats.boot_us += tps65987_now_us() - start;
+            return -1;
+        }
+    }
+}
+
+
+int tps65987_dev_reset(s_TPS_dev *p_dev)
+{
+    unsigned char buf[64] = {0};
+
+    int retVal = 0;
+
+    /*
+    * Execute GAID, and wait for reset to complete
+    */
+    printf("Send GAID and Waiting for device to reset\n\r");
+    tps65987_dev_exec_4CC_Cmd(p_dev, "GAID", NULL, 0, NULL, 0);
+
+    tps65987_source_caps_cache_invalidate(&p_dev->source_caps);
+
+    if(WaitBooted(p_dev) < 0)
+    {
+        printf("device not back %dms after GAID\n\r", RESET_TIMEOUT_MS);
+        retVal = -1;
+    }
+
+    tps65987_dev_read(p_dev, REG_BootFlags, buf, 12);
+
+    return retVal;
+}
+
+
+int ResetPDController()
+{
+    return tps65987_dev_reset(tps65987_default_dev());
+}
+
+
+void tps65987_dev_set_upgrade_flags(s_TPS_dev *p_dev, unsigned int flags)
+{
+    p_dev->flash_upgrade_para.upgrade_flags = flags;
+}
+
+
+const s_TPS_upgrade_stats *tps65987_dev_get_upgrade_stats(s_TPS_dev *p_dev)
+{
+    return &p_dev->upgrade_stats;
+}
+
+
+/*
+* where tps65987_dev_flash_upgrade() keeps its progress, NULL: nowhere
+*/
+void tps65987_dev_set_journal(s_TPS_dev *p_dev, const char *file_name)
+{
+    snprintf(p_dev->journal_file, sizeof(p_dev->journal_file), "%s", file_name ? file_name : "");
+}
+
+
+void tps65987_set_upgrade_flags(unsigned int flags)
+{
+    tps65987_dev_set_upgrade_flags(tps65987_default_dev(), flags);
+}
+
+
+const s_TPS_upgrade_stats *tps65987_get_upgrade_stats(void)
+{
+    return tps65987_dev_get_upgrade_stats(tps65987_default_dev());
+}
+
+
+void tps65987_set_journal(const char *file_name)
+{
+    tps65987_dev_set_journal(tps65987_default_dev(), file_name);
+}
+
+
+const char *tps65987_upgrade_phase_name(int phase)
+{
+    if(phase == UPGRADE_PHASE_NUM)
+    {
+        return "done";
+    }
+
+    if(phase < 0 || phase > UPGRADE_PHASE_NUM)
+    {
+        return "unknown";
+    }
+
+    return upgrade_phase_names[phase];
+}
+
+
+/*
+* With a journal file set, pick up an interrupted upgrade of the same image
+* or start a new journal for this one
+*/
+static void OpenJournal(s_TPS_dev *p_dev, const s_TPS_image *p_image)
+{
+    s_TPS_journal_rec *p_rec = &p_dev->journal.rec;
+    unsigned long long digest;
+
+    p_dev->flash_upgrade_para.resume = 0;
+    p_dev->journal.fd = -1;
+
+    //without a journal file the record still says what is being written, see tps65987_dev_copy_region()
+    digest = tps65987_journal_digest(p_image->data, p_image->size);
+
+    if(p_dev->journal_file[0] != 0 && tps65987_journal_open(&p_dev->journal, p_dev->journal_file) == 1 &&
+       p_rec->image_digest == digest && p_rec->image_size == p_image->size &&
+       p_rec->upgrade_flags == p_dev->flash_upgrade_para.upgrade_flags)
+    {
+        printf("journal %s: resume pass %d @ 0x%x\n", p_dev->journal_file, p_rec->region_pass, p_rec->write_offset);
+        p_dev->flash_upgrade_para.resume = 1;
+        return;
+    }
+
+    memset(p_rec, 0, sizeof(*p_rec));
+    p_rec->image_digest = digest;
+    p_rec->image_size = p_image->size;
+    p_rec->upgrade_flags = p_dev->flash_upgrade_para.upgrade_flags;
+    p_rec->write_offset = JOURNAL_NOT_STARTED;
+}
+
+
+int tps65987_dev_flash_upgrade(s_TPS_dev *p_dev, char *ota_file_name)
 {
-    FILE *fp;
-
-    unsigned char buf[64];
-    int ret;
-
-    int i;
+    int retVal;
 
-    s_TPS_flrr flrrInData = {0};
-    s_TPS_flem flemInData = {0};
-    s_TPS_flad fladInData = {0};
-    s_TPS_flvy flvyInData = {0};
+    s_TPS_image image;
 
-    unsigned char outdata[64];
+    unsigned long long start = tps65987_now_us();
+    unsigned long long phase_start = start;
 
-    int idx = -1;
-    int retVal = -1;
+    memset(&p_dev->upgrade_stats, 0, sizeof(p_dev->upgrade_stats));
+    p_dev->flash_upgrade_para.region_pass = 0;
+    p_dev->flash_upgrade_para.port_down_start_us = 0;
+    p_dev->flash_upgrade_para.switched = 0;
+    p_dev->flash_upgrade_para.copy_pending = 0;
 
-    unsigned int regAddr = 0;
+    atomic_store(&p_dev->phase, PHASE_PRE_OPS);
+    atomic_store(&p_dev->progress_bytes, 0);
+    atomic_store(&p_dev->total_bytes, 0);
 
     /*
-    * should first check whether the upgrade bin file is exist
+    * load and check the image before the port is touched
     */
-    fp = fopen(ota_file_name,"rb");
-    if(fp == NULL)
+    if(tps65987_image_load(&image, ota_file_name) != 0)
     {
-        printf("fail to open tps65987 upgrade bin file\n");
+        printf("upgrade image %s rejected\n\r", ota_file_name);
+        atomic_store(&p_dev->phase, UPGRADE_PHASE_NUM);
         return -1;
     }
 
-    printf("open tps65987 upgrade bin file success\n");
+    OpenJournal(p_dev, &image);
 
-    /*
-    * Get the location of the region 'region_number'
-    */
-    flrrInData.regionnum = region_number;
-    retVal = tps65987_exec_4CC_Cmd("FLrr", (unsigned char *)&flrrInData, 1, outdata, 4);
+    retVal = PreOpsForFlashUpdate(p_dev);
+
+    UpgradePhaseDone(p_dev, PHASE_PRE_OPS, &phase_start);
 
     if(retVal != 0)
     {
-        printf("4CC_Cmd FLrr FAILED.!\n\r");
+        printf("Pre Ops For FlashUpdate fail\n\r");
+        p_dev->upgrade_stats.total_us = tps65987_now_us() - start;
+        atomic_store(&p_dev->phase, UPGRADE_PHASE_NUM);
+        tps65987_journal_close(&p_dev->journal);
+        tps65987_image_free(&image);
         return -1;
     }
 
-    regAddr = (outdata[3] << 24) | (outdata[2] << 16) | (outdata[1] << 8) | outdata[0];
+    retVal = StartFlashUpdate(p_dev, &image);
 
-    printf("regAddr = 0x%08x\n", regAddr);
-
-    /*
-    * Erase #'numof4ksector' sectors at address 'regAddr' of the sFLASH
-    * - Note: The below snippet assumes that the total number of 4kB segments
-    * required to hold the maximum size of the patch-bundle is 4.
-    * Ensure its validity for the TPS6598x being used for your
-    * application.
-    */
-    flemInData.flashaddr = regAddr;
-    flemInData.numof4ksector = 4;
-    retVal = tps65987_exec_4CC_Cmd("FLem", (unsigned char *)&flemInData, 5, outdata, 1);
+    tps65987_image_free(&image);
 
-    if(retVal != 0)
+    if(retVal == 0)
     {
-        printf("4CC_Cmd FLem FAILED.!\n\r");
-        return -1;
-    }
+        retVal = 0;
+        printf("FlashUpdate success\n\r");
 
-    if(outdata[0] != 0)
-    {
-        printf("Flash Erase FAILED.! 0x%x\n\r",outdata[0]);
-        return -1;
+        if(p_dev->flash_upgrade_para.copy_pending)
+        {
+            //the journal stays open for the copy
+            snprintf(p_dev->image_file, sizeof(p_dev->image_file), "%s", ota_file_name);
+        }
+        else if(p_dev->journal.fd >= 0)
+        {
+            tps65987_journal_remove(&p_dev->journal, p_dev->journal_file);
+        }
     }
+    else
+    {
+        retVal = -1;
+        printf("FlashUpdate fail\n\r");
 
-    printf("Flash Erase Success.! 0x%x\n\r",outdata[0]);
+        //kept for the next attempt
+        tps65987_journal_close(&p_dev->journal);
+    }
 
     /*
-    * Set the start address for the next write
+    * Staged: the new image already runs and the port is up, or the port
+    * was never disabled; nothing to reset
     */
-    fladInData.flashaddr = regAddr;
-    retVal = tps65987_exec_4CC_Cmd("FLad", (unsigned char *)&fladInData, 4, outdata, 1);
-
-    if(retVal != 0)
+    if(p_dev->flash_upgrade_para.port_down_start_us != 0)
     {
-        printf("4CC_Cmd FLad FAILED.!\n\r");
-        return -1;
-    }
-
-    printf("Updating [%d] 4k chunks starting @ 0x%x \n\r", flemInData.numof4ksector, regAddr);
+        phase_start = tps65987_now_us();
 
-    flash_upgrade_para.flash_upgrade_finish = 0;
-    flash_upgrade_para.flash_upgrade_state = OPEN_FILE;
+        tps65987_dev_reset(p_dev);
 
-    while(!flash_upgrade_para.flash_upgrade_finish)
+        PortBackUp(p_dev);
+        UpgradePhaseDone(p_dev, PHASE_RESET, &phase_start);
+    }
+    else
     {
-        switch(flash_upgrade_para.flash_upgrade_state)
-        {
-            case OPEN_FILE:
-                //already opened
-                /*fp = fopen("/tmp/low-region-flash.bin","rb");
-                if(fp == NULL)
-                {
-                    printf("fail to open tps65987 upgrade bin file\n");
-                    return 1;
-                }
+        atomic_store(&p_dev->phase, UPGRADE_PHASE_NUM);
+    }
 
-                printf("open tps65987 upgrade bin file success\n");*/
+    p_dev->upgrade_stats.total_us = tps65987_now_us() - start;
 
-                flash_upgrade_para.flash_upgrade_state = READ_FILE;
-                break;
+    return retVal;
+}
 
-            case READ_FILE:
-                ret = fread(buf,1,64,fp);
 
-                if(feof(fp))
-                {
-                    printf("read file finish %d:\n", ret);
+/*
+* Deferred (UPGRADE_FLAG_DEFERRED): copy the image to the region the
+* controller booted from before, once the new image runs. The image file is
+* read again and must still be the one the upgrade wrote, else the copy is
+* refused. 0 if there is nothing to copy.
+*/
+int tps65987_dev_copy_region(s_TPS_dev *p_dev)
+{
+    s_TPS_image image;
 
-                    flash_upgrade_para.flash_upgrade_state = VERIFY_IF_VALID;
-                    break;
-                }
+    unsigned long long phase_start = tps65987_now_us();
 
-                printf("read %d data from file:", ret);
-                for(i=0; i<ret; i++)
-                {
-                    printf("%02x",buf[i]);
-                }
-                printf("\n");
+    int retVal;
 
-                /*
-                * Execute FLwd with PATCH_BUNDLE_SIZE bytes of patch-data
-                * in each iteration
-                */
-                retVal = tps65987_exec_4CC_Cmd("FLwd", buf, ret, outdata, 1);
+    if(!p_dev->flash_upgrade_para.copy_pending)
+    {
+        return 0;
+    }
 
-                if(retVal != 0)
-                {
-                    printf("4CC_Cmd FLwd FAILED.!\n\r");
-                    fclose(fp);
-                    return -1;
-                }
+    p_dev->flash_upgrade_para.copy_pending = 0;
 
-                /*
-                * 'outdata[1]' will contain the command's return code
-                */
-                if(outdata[0] != 0)
-                {
-                    printf("Flash Write FAILED.!\n\r");
-                    fclose(fp);
-                    return -1;
-                }
+    if(tps65987_image_load(&image, p_dev->image_file) != 0)
+    {
+        printf("deferred copy: image %s rejected\n\r", p_dev->image_file);
+        tps65987_journal_close(&p_dev->journal);
+        return -1;
+    }
 
-                usleep(100000);
+    //replaced since the upgrade: it never ran, keep it out of the fallback region
+    if(image.size != p_dev->journal.rec.image_size ||
+       tps65987_journal_digest(image.data, image.size) != p_dev->journal.rec.image_digest)
+    {
+        printf("deferred copy: %s is not the image the upgrade wrote, no copy\n\r", p_dev->image_file);
+        tps65987_image_free(&image);
+        tps65987_journal_close(&p_dev->journal);
+        return -1;
+    }
 
-                break;
+    atomic_store(&p_dev->phase, PHASE_SECOND_REGION);
 
-            case VERIFY_IF_VALID:
-                /*
-                * Write is through. Now verify if the content/copy is valid
-                */
-                flvyInData.flashaddr = regAddr;
-                retVal = tps65987_exec_4CC_Cmd("FLvy", (unsigned char *)&flvyInData, 4, outdata, 1);
+    p_dev->flash_upgrade_para.region_pass = 1;
+    p_dev->flash_upgrade_para.resume = 0;
 
-                if(outdata[0] != 0)
-                {
-                    printf("Flash Verify FAILED.!\n\r");
-                    fclose(fp);
-                    return -1;
-                }
+    retVal = UpdateAndVerifyRegion(p_dev, p_dev->flash_upgrade_para.active_region, &image);
 
-                flash_upgrade_para.flash_upgrade_state = CLOSE_FILE;
-                break;
+    UpgradePhaseDone(p_dev, PHASE_SECOND_REGION, &phase_start);
+    atomic_store(&p_dev->phase, UPGRADE_PHASE_NUM);
 
-            case CLOSE_FILE:
-                fclose(fp);
-                printf("close tps65987 upgrade bin file\n");
+    tps65987_image_free(&image);
 
-                flash_upgrade_para.flash_upgrade_state = OPEN_FILE;
-                flash_upgrade_para.flash_upgrade_finish = 1;
-                break;
-        }
+    if(retVal != 0)
+    {
+        printf("Region[%d] copy failed.! The controller runs Region[%d]\n\r",
+               p_dev->flash_upgrade_para.active_region, p_dev->flash_upgrade_para.inactive_region);
 
+        //kept for the next attempt
+        tps65987_journal_close(&p_dev->journal);
+        return -1;
     }
 
-    return 0;
-}
-
-int ResetPDController()
-{
-    unsigned char buf[64] = {0};
-
-    /*
-    * Execute GAID, and wait for reset to complete
-    */
-    printf("Send GAID and Waiting for device to reset\n\r");
-    tps65987_exec_4CC_Cmd("GAID", NULL, 0, NULL, 0);
+    printf("Region[%d] copy done\n", p_dev->flash_upgrade_para.active_region);
 
-    usleep(1000000);
-
-    //read Mode
-    tps65987_i2c_read(I2C_ADDR, REG_MODE, buf, 4);
-
-    tps65987_i2c_read(I2C_ADDR, REG_Version, buf, 4);
-
-    tps65987_i2c_read(I2C_ADDR, REG_BootFlags, buf, 12);
+    if(p_dev->journal.fd >= 0)
+    {
+        tps65987_journal_remove(&p_dev->journal, p_dev->journal_file);
+    }
 
     return 0;
 }
 
 
-int tps65987_ext_flash_upgrade(char *ota_file_name)
+/*
+* Boot a controller that found nothing valid in its flash (MODE "PTCH") from
+* the patch bundle of an upgrade image, without touching the flash: PTCs,
+* the bundle through DATA1 with one PTCd per 64 bytes, PTCc. The image is
+* loaded and its frames built before the first PTCd. 1 if the controller
+* isn't waiting for a patch.
+*/
+int tps65987_dev_host_patch(s_TPS_dev *p_dev, char *patch_file_name)
 {
-    int retVal;
+    s_TPS_image image;
+
+    unsigned char mode[4];
+    unsigned char bootflags[TPS_REG_BOOT_FLAGS_LEN];
+    unsigned char outdata[64];
+
+    unsigned long long start;
+    unsigned int chunk;
+    unsigned int len;
+    int retVal = -1;
 
-    if(PreOpsForFlashUpdate() != 0)
+    if(tps65987_dev_read(p_dev, REG_MODE, mode, 4) != 0)
     {
-        printf("Pre Ops For FlashUpdate fail\n\r");
         return -1;
     }
 
-    if(StartFlashUpdate(ota_file_name) == 0)
+    if(memcmp(mode, "PTCH", 4) != 0)
     {
-        retVal = 0;
-        printf("FlashUpdate success\n\r");
+        printf("%.4s mode, no patch download\n", mode);
+        return 1;
     }
-    else
+
+    if(tps65987_image_load(&image, patch_file_name) != 0)
     {
-        retVal = -1;
-        printf("FlashUpdate fail\n\r");
+        printf("patch image %s rejected\n\r", patch_file_name);
+        return -1;
     }
 
-    ResetPDController();
-
-    return retVal;
-}
-
+    start = tps65987_now_us();
+    p_dev->upgrade_stats.patch_bytes = 0;
 
-int tps65987_get_Status(s_TPS_status *p_tps_status)
-{
-    unsigned char buf[64] = {0};
+    if(tps65987_dev_exec_4CC_Cmd(p_dev, "PTCs", NULL, 0, outdata, 1) != 0 || outdata[0] != 0)
+    {
+        printf("4CC_Cmd PTCs FAILED.! %s\n\r", tps65987_error_name(p_dev->last_error));
+        goto done;
+    }
 
-    if(tps65987_i2c_read(I2C_ADDR, REG_Status, (unsigned char*)p_tps_status, 8) == 0)
+    for(chunk = image.bundle_offset / FLASH_WRITE_CHUNK_SIZE; chunk * FLASH_WRITE_CHUNK_SIZE < image.bundle_end; chunk++)
     {
-        printf("get tps65987 Status: \n");
-        printf("PlugPresent: %d\n", p_tps_status->PlugPresent);
-        printf("ConnState: %d\n", p_tps_status->ConnState);
-        printf("PlugOrientation: %d\n", p_tps_status->PlugOrientation);
-        printf("PortRole: ");
-        switch(p_tps_status->PortRole)
-        {
-            case 0:
-                printf("Sink, %d\n", p_tps_status->PortRole);
-                break;
+        len = image.bundle_end - chunk * FLASH_WRITE_CHUNK_SIZE;
 
-            case 1:
-                printf("Source, %d\n", p_tps_status->PortRole);
-                break;
+        //the prebuilt frame, unless the bundle ends inside this chunk
+        if(len >= FLASH_WRITE_CHUNK_SIZE)
+        {
+            len = FLASH_WRITE_CHUNK_SIZE;
+            retVal = tps65987_dev_exec_4CC_Frame(p_dev, "PTCd", tps65987_image_frame(&image, chunk), IMAGE_FRAME_SIZE, outdata, 1);
         }
-
-        printf("DataRole: %d\n", p_tps_status->DataRole);
-        switch(p_tps_status->DataRole)
+        else
         {
-            case 0:
-                printf("UFP, %d\n", p_tps_status->DataRole);
-                break;
+            retVal = tps65987_dev_exec_4CC_Cmd(p_dev, "PTCd", tps65987_image_chunk(&image, chunk), len, outdata, 1);
+        }
 
-            case 1:
-                printf("DFP, %d\n", p_tps_status->DataRole);
-                break;
+        if(retVal != 0 || outdata[0] != 0)
+        {
+            printf("4CC_Cmd PTCd @ 0x%x FAILED.! %s 0x%x\n\r", chunk * FLASH_WRITE_CHUNK_SIZE,
+                   tps65987_error_name(p_dev->last_error), outdata[0]);
+            tps65987_dev_exec_4CC_Cmd(p_dev, "PTCr", NULL, 0, NULL, 0);
+            retVal = -1;
+            goto done;
         }
 
-        printf("VbusStatus: %d\n", p_tps_status->VbusStatus);
-        printf("UsbHostPresent: %d\n", p_tps_status->UsbHostPresent);
-        printf("HighVoltageWarning: %d\n", p_tps_status->HighVoltageWarning);
-        printf("LowVoltageWarning: %d\n", p_tps_status->LowVoltageWarning);
+        p_dev->upgrade_stats.patch_bytes += len;
+    }
 
-        return 0;
+    retVal = -1;
+
+    if(tps65987_dev_exec_4CC_Cmd(p_dev, "PTCc", NULL, 0, outdata, 1) != 0 || outdata[0] != 0)
+    {
+        printf("4CC_Cmd PTCc FAILED.! %s 0x%x\n\r", tps65987_error_name(p_dev->last_error), outdata[0]);
+    }
+    else if(tps65987_dev_read(p_dev, REG_MODE, mode, 4) != 0 ||
+            tps65987_dev_read(p_dev, REG_BootFlags, bootflags, sizeof(bootflags)) != 0)
+    {
+        printf("no answer after PTCc\n\r");
+    }
+    else if(memcmp(mode, "APP ", 4) != 0 || tps65987_boot_flags_patch_header_error(bootflags) ||
+            tps65987_boot_flags_patch_download_error(bootflags))
+    {
+        printf("patch not running: %.4s mode, TPS_bootflag = 0x%08x\n\r", mode, tps65987_field_get(bootflags, 0, 32));
+    }
+    else
+    {
+        retVal = 0;
     }
 
-    return -1;
-}
+done:
+    p_dev->upgrade_stats.patch_us = tps65987_now_us() - start;
 
+    printf("host patch %s, %u bytes in %lluus\n", retVal == 0 ? "done" : "failed",
+           p_dev->upgrade_stats.patch_bytes, p_dev->upgrade_stats.patch_us);
 
-int tps65987_get_PortRole(void)
-{
-    s_TPS_status tps_status = {0};
+    tps65987_image_free(&image);
 
-    s_TPS_status *p_tps_status = NULL;
+    return retVal;
+}
 
-    p_tps_status = &tps_status;
 
-    if(tps65987_i2c_read(I2C_ADDR, REG_Status, (unsigned char*)p_tps_status, 8) == 0)
-    {
-        printf("get tps65987 Status: \n");
-        printf("PlugPresent: %d\n", p_tps_status->PlugPresent);
-        printf("ConnState: %d\n", p_tps_status->ConnState);
-        printf("PlugOrientation: %d\n", p_tps_status->PlugOrientation);
-        printf("PortRole: ");
-        switch(p_tps_status->PortRole)
-        {
-            case 0:
-                printf("Sink, %d\n", p_tps_status->PortRole);
-                break;
+int tps65987_copy_region(void)
+{
+    return tps65987_dev_copy_region(tps65987_default_dev());
+}
 
-            case 1:
-                printf("Source, %d\n", p_tps_status->PortRole);
-                break;
-        }
 
-        printf("DataRole: %d\n", p_tps_status->DataRole);
-        switch(p_tps_status->DataRole)
-        {
-            case 0:
-                printf("UFP, %d\n", p_tps_status->DataRole);
-                break;
+int tps65987_ext_flash_upgrade(char *ota_file_name)
+{
+    return tps65987_dev_flash_upgrade(tps65987_default_dev(), ota_file_name);
+}
 
-            case 1:
-                printf("DFP, %d\n", p_tps_status->DataRole);
-                break;
-        }
 
-        printf("VbusStatus: %d\n", p_tps_status->VbusStatus);
-        printf("UsbHostPresent: %d\n", p_tps_status->UsbHostPresent);
-        printf("HighVoltageWarning: %d\n", p_tps_status->HighVoltageWarning);
-        printf("LowVoltageWarning: %d\n", p_tps_status->LowVoltageWarning);
+/*
+* Status register (TPS_REG_STATUS_LEN bytes into p_status), printed field
+* by field
+*/
+static void PrintStatus(const unsigned char *p_status)
+{
+    printf("get tps65987 Status: \n");
+    printf("PlugPresent: %d\n", tps65987_status_plug_present(p_status));
+    printf("ConnState: %d\n", tps65987_status_conn_state(p_status));
+    printf("PlugOrientation: %d\n", tps65987_status_plug_orientation(p_status));
+    printf("PortRole: ");
+    switch(tps65987_status_port_role(p_status))
+    {
+        case SINK:
+            printf("Sink, %d\n", SINK);
+            break;
 
-        //return PortRole
-        switch(p_tps_status->PortRole)
-        {
-            case 0:
-                printf("Sink, %d\n\n", p_tps_status->PortRole);
-                return SINK;
+        case SOURCE:
+            printf("Source, %d\n", SOURCE);
+            break;
+    }
 
-            case 1:
-                printf("Source, %d\n\n", p_tps_status->PortRole);
-                return SOURCE;
+    printf("DataRole: %d\n", tps65987_status_data_role(p_status));
+    switch(tps65987_status_data_role(p_status))
+    {
+        case 0:
+            printf("UFP, 0\n");
+            break;
 
-            default:
-                printf("value err, %d\n\n", p_tps_status->PortRole);
-                return -1;
-        }
+        case 1:
+            printf("DFP, 1\n");
+            break;
     }
 
-    return -1;
+    printf("VbusStatus: %d\n", tps65987_status_vbus_status(p_status));
+    printf("UsbHostPresent: %d\n", tps65987_status_usb_host_present(p_status));
+    printf("HighVoltageWarning: %d\n", tps65987_status_high_voltage_warning(p_status));
+    printf("LowVoltageWarning: %d\n", tps65987_status_low_voltage_warning(p_status));
 }
 
 
-int tps65987_get_RXSourceNumValidPDOs(void)
+int tps65987_get_Status(unsigned char *p_status)
 {
-    unsigned char buf[64] = {0};
-
-    unsigned char valid_PDO_num = 0;
-
-    if(tps65987_i2c_read(I2C_ADDR, REG_RX_Source_Capabilities, buf, 29) != 0)
+    if(tps65987_i2c_read(I2C_ADDR, REG_Status, p_status, TPS_REG_STATUS_LEN) != 0)
     {
-        printf("get RXSourceNumValidPDOs err \n");
         return -1;
     }
 
-    valid_PDO_num = buf[0] & 0x03;
-
-    printf("get RXSourceNumValidPDOs = %d\n\n", valid_PDO_num);
+    PrintStatus(p_status);
 
-    return valid_PDO_num;
+    return 0;
 }
 
 
-int tps65987_get_TypeC_Current(void)
+int tps65987_get_PortRole(void)
 {
-    s_TPS_Power_Status tps_power_status = {0};
-
-    s_TPS_Power_Status *p_tps_power_status = NULL;
+    unsigned char status[TPS_REG_STATUS_LEN] = {0};
 
-    p_tps_power_status = &tps_power_status;
-
-    if(tps65987_i2c_read(I2C_ADDR, REG_Power_Status, (unsigned char*)p_tps_power_status, 2) == 0)
+    if(tps65987_get_Status(status) != 0)
     {
-        printf("get tps65987 Power Status: \n");
-        printf("PowerConnection: %d\n", p_tps_power_status->PowerConnection);
-        printf("SourceSink: ");
-        switch(p_tps_power_status->SourceSink)
-        {
-            case 0:
-                printf("PD Controller as source, %d\n", p_tps_power_status->SourceSink);
-                break;
-
-            case 1:
-                printf("PD Controller as sink, %d\n", p_tps_power_status->SourceSink);
-                break;
-        }
-
-        printf("TypeC_Current: ");
-        switch(p_tps_power_status->TypeC_Current)
-        {
-            case USB_Default_Current:
-                printf("USB Default Current, %d\n", p_tps_power_status->TypeC_Current);
-                break;
-
-            case C_1d5A_Current:
-                printf("1.5A, %d\n", p_tps_power_status->TypeC_Current);
-                break;
-
-            case C_3A_Current:
-                printf("3A, %d\n", p_tps_power_status->TypeC_Current);
-                break;
-
-            case PD_contract_negotiated:
-                printf("PD contract negotiated, %d\n", p_tps_power_status->TypeC_Current);
-                break;
-        }
-
-        printf("Charger Detect Status: %d\n", p_tps_power_status->Charger_Detect_Status);
-        printf("Charger_AdvertiseStatus: %d\n\n", p_tps_power_status->Charger_AdvertiseStatus);
+        return -1;
+    }
 
-        //return TypeC_Current
-        return p_tps_power_status->TypeC_Current;
+    //return PortRole
+    switch(tps65987_status_port_role(status))
+    {
+        case SINK:
+            printf("Sink, %d\n\n", SINK);
+            return SINK;
 
+        case SOURCE:
+            printf("Source, %d\n\n", SOURCE);
+            return SOURCE;
     }
 
     return -1;
 }
 
-int main(int argc, char* argv[])
-{
-    //FILE *fp;
-    int i,j;
-    unsigned char reg = 0;
-
-    unsigned char buf[64] = {0};
-    unsigned char buf_2[64] = {0};
-    unsigned char val[64] = {0};
-    unsigned char customeruse1[64] = {0};
-    unsigned char customeruse[64] ={0};
-
-    s_TPS_status tps_status = {0};
 
-    int tps_port_role;
-    memset(val, 0x55, sizeof(val));
-
-    printf("start run tps65987-ota\n");
-    freopen("/data/tps65987-log.txt", "w", stdout);
+/*
+* The decoded source caps: from memory while a status monitor keeps them
+* current (it updates them on every new source caps and plug
+* event), otherwise with one read of RX_Source_Capabilities
+*/
+int tps65987_dev_get_source_caps(s_TPS_dev *p_dev, s_TPS_source_caps *p_caps)
+{
+    unsigned char buf[SOURCE_CAPS_LEN];
 
-    if(argc > 1)
+    if(tps65987_source_caps_cache_read(&p_dev->source_caps, p_caps) == 0)
     {
-        for(i = 0; i < argc; i++)
-        {
-            printf("Argument %d is %s\n", i, argv[i]);
-        }
-
-        if(strcmp(argv[1],"0x38") == 0)
-        {
-            I2C_ADDR = 0x38;
-        }
-        else if(strcmp(argv[1],"0x20") == 0)
-        {
-            I2C_ADDR = 0x20;
-        }
+        return 0;
     }
 
-    printf("used i2c address is 0x%x\n",I2C_ADDR);
-
-    check_endian();
-
-    if(i2c_open_tps65987(I2C_ADDR,argv[2]) != 0)
+    if(tps65987_dev_read(p_dev, REG_RX_Source_Capabilities, buf, SOURCE_CAPS_LEN) != 0)
     {
         return -1;
     }
 
-    //test read
-    tps65987_i2c_read(I2C_ADDR, 0x00, buf, 4);
-    tps65987_i2c_read(I2C_ADDR, 0x05, buf, 16);
-    tps65987_i2c_read(I2C_ADDR, 0x0f, buf, 4);
+    tps65987_source_caps_decode(buf, p_caps);
 
-    tps65987_i2c_read(I2C_ADDR, 0x06, customeruse1, sizeof(customeruse1));
-    sprintf(customeruse,"%s%02x%s",OTA_FILE_NAME,customeruse1[0],OTA_FILE_NAME1);
-    printf("ota-file is %s\n",argv[3]);
-    printf("local-file is %s\n",customeruse);
+    return 0;
+}
 
-    printf("ota-file size is %ld\n",strlen(argv[3]));
-    printf("local-file size is %ld\n",strlen(customeruse));
 
-    printf("result is %d\n", strcmp(argv[3],customeruse));
-    if(strcmp(argv[3],customeruse) <= 0)
+int tps65987_get_RXSourceNumValidPDOs(void)
+{
+    s_TPS_source_caps caps;
+
+    if(tps65987_dev_get_source_caps(tps65987_default_dev(), &caps) != 0)
     {
-       printf("version is old,version is %s\n",argv[3]);
-       return -1;
+        printf("get RXSourceNumValidPDOs err \n");
+        return -1;
     }
-    strcpy(customeruse,argv[3]);
-    printf("Have new version,version is %s\n",argv[3]);
-
-    //test read and write
-    val[0] = 0x04;
-    tps65987_i2c_write(I2C_ADDR, 0x70, &val[0], 1);
-    usleep(10000);
-    tps65987_i2c_read(I2C_ADDR, 0x70, buf, 1);
 
-    //tps65987_host_patch_bundle();
+    printf("get RXSourceNumValidPDOs = %d\n\n", caps.num_pdos);
 
-    tps65987_ext_flash_upgrade(customeruse);
+    return caps.num_pdos;
+}
 
-    tps65987_i2c_read(I2C_ADDR, REG_Version, buf, 4);
-    tps65987_i2c_read(I2C_ADDR, REG_BootFlags, buf, 12);
 
-    //buf[0] = 0x01;
-    //tps65987_exec_4CC_Cmd("FLrr", buf, 1, buf_2, 4);
+int tps65987_get_TypeC_Current(void)
+{
+    unsigned char power_status[TPS_REG_POWER_STATUS_LEN] = {0};
 
-    //buf[0] = 0x00;
-    //tps65987_exec_4CC_Cmd("FLrr", buf, 1, buf_2, 4);
+    unsigned int current;
 
-    //ResetPDController();
+    if(tps65987_i2c_read(I2C_ADDR, REG_Power_Status, power_status, TPS_REG_POWER_STATUS_LEN) != 0)
+    {
+        return -1;
+    }
 
-    tps65987_get_Status(&tps_status);
+    current = tps65987_power_status_type_c_current(power_status);
 
-    /*while(1)
+    printf("get tps65987 Power Status: \n");
+    printf("PowerConnection: %d\n", tps65987_power_status_power_connection(power_status));
+    printf("SourceSink: ");
+    switch(tps65987_power_status_source_or_sink(power_status))
     {
-        tps_port_role = tps65987_get_PortRole();
+        case 0:
+            printf("PD Controller as source, 0\n");
+            break;
 
-        //tps65987_get_Status(&tps_status);
+        case 1:
+            printf("PD Controller as sink, 1\n");
+            break;
+    }
 
-        tps65987_get_TypeC_Current();
+    printf("TypeC_Current: ");
+    switch(current)
+    {
+        case USB_Default_Current:
+            printf("USB Default Current, %d\n", current);
+            break;
 
-        sleep(8);
-    }*/
-    freopen("/dev/tty","w",stdout);
-    printf("end tps65987-ota\n");
-    close(fd);
+        case C_1d5A_Current:
+            printf("1.5A, %d\n", current);
+            break;
 
-    return 0;
-}
+        case C_3A_Current:
+            printf("3A, %d\n", current);
+            break;
 
+        case PD_contract_negotiated:
+            printf("PD contract negotiated, %d\n", current);
+            break;
+    }
 
+    printf("Charger Detect Status: %d\n", tps65987_power_status_charger_detect_status(power_status));
+    printf("Charger_AdvertiseStatus: %d\n\n", tps65987_power_status_charger_advertise_status(power_status));
 
+    //return TypeC_Current
+    return current;
+}
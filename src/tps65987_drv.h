@@ -6,94 +6,53 @@
 *  @copyright
 */
 
+#ifndef TPS65987_DRV_H
+#define TPS65987_DRV_H
+
 #include<stdio.h>
 #include<stdlib.h>
+#include<stdatomic.h>
+
+#include "tps65987_transport.h"
+#include "tps65987_latency.h"
+#include "tps65987_journal.h"
+#include "tps65987_pdo.h"
+#include "tps65987_regmap.h"
 
 #define  REG_MODE                       0x03
+#define  REG_CMD1                       0x08
+#define  REG_DATA1                      0x09
 #define  REG_Version                    0x0F
+#define  REG_INT_EVENT1                 0x14
+#define  REG_INT_EVENT2                 0x15
+#define  REG_INT_MASK1                  0x16
+#define  REG_INT_MASK2                  0x17
+#define  REG_INT_CLEAR1                 0x18
+#define  REG_INT_CLEAR2                 0x19
 #define  REG_Status                     0x1A
 #define  REG_PORTCONFIG                 0x28
 #define  REG_BootFlags                  0x2D
 #define  REG_RX_Source_Capabilities     0x30
 #define  REG_Power_Status               0x3F
 
+/*
+* INT_EVENT1/2 (one per i2c port, both 11 bytes): bit numbers
+*/
+#define  INT_EVENT_LEN                  11
 
-
-typedef struct
-{
-    unsigned int  PatchHeaderErr        :1;
-    unsigned int  Reserved0             :1;
-    unsigned int  DeadBatteryFlag       :1;
-    unsigned int  SpiFlashPresent       :1;
-    unsigned int  Region0               :1;
-    unsigned int  Region1               :1;
-    unsigned int  Region0Invalid        :1;
-    unsigned int  Region1Invalid        :1;
-
-    unsigned int  Region0FlashErr       :1;
-    unsigned int  Region1FlashErr       :1;
-    unsigned int  PatchDownloadErr      :1;
-    unsigned int  Reserved1             :1;
-    unsigned int  Region0CrcFail        :1;
-    unsigned int  Region1CrcFail        :1;
-    unsigned int  CustomerOTPInvalid    :1;
-    unsigned int  Reserved2             :1;
-
-    unsigned int  Reserved3             :1;
-    unsigned int  PP1Switch             :1;
-    unsigned int  PP2Switch             :1;
-    unsigned int  PP3Switch             :1;
-    unsigned int  PP4Switch             :1;
-    unsigned int  Reserved4             :11;
-} s_TPS_bootflag;
-
-
-typedef struct
-{
-    unsigned int  TypeCStateMachine         :2;
-    unsigned int  Reserved0                 :1;
-    unsigned int  ReceptacleType            :3;
-    unsigned int  AudioAccessorySupport     :1;
-    unsigned int  DebugAccessorySupport     :1;
-
-    unsigned int  SupportTypeCOptions       :2;
-    unsigned int  Reserved1                 :1;
-    unsigned int  VCONNsupported            :2;
-    unsigned int  USB3rate                  :2;
-    unsigned int  Reserved2                 :1;
-
-} s_TPS_portconfig;
+#define  INT_HARD_RESET                 1
+#define  INT_PLUG_EVENT                 3
+#define  INT_PR_SWAP_COMPLETE           4
+#define  INT_DR_SWAP_COMPLETE           5
+#define  INT_POWER_STATUS_UPDATE        9
+#define  INT_DATA_STATUS_UPDATE         10
+#define  INT_NEW_CONTRACT_AS_CONS       12
+#define  INT_NEW_CONTRACT_AS_PROV       13
+#define  INT_SOURCE_CAP_MSG_RCVD        14
+#define  INT_STATUS_UPDATE              26
 
 
-typedef struct
-{
-    unsigned int  PlugPresent               :1;
-    unsigned int  ConnState                 :3;
-    unsigned int  PlugOrientation           :1;
-    unsigned int  PortRole                  :1;
-    unsigned int  DataRole                  :1;
-
-    unsigned int  Reserved0                 :13;
-    unsigned int  VbusStatus                :2;
-    unsigned int  UsbHostPresent            :2;
-    unsigned int  ActingAsLegacy            :2;
-    unsigned int  Reserved1                 :1;
-    unsigned int  BIST                      :1;
-    unsigned int  HighVoltageWarning        :1;
-    unsigned int  LowVoltageWarning         :1;
-    unsigned int  Ack_Timeout               :1;
-    unsigned int  Reserved2                 :1;
-
-    //Bytes 5-6:
-    unsigned int  AMStatus                  :2;
-    unsigned int  Reserved3                 :14;
-
-    //Bytes 7-8:
-    unsigned int  Reserved4                 :16;
-
-} s_TPS_status;
-
-enum
+typedef enum
 {
     SINK = 0,
     SOURCE = 1,
@@ -101,19 +60,7 @@ enum
 } TPS_Port_Role;
 
 
-typedef struct
-{
-    unsigned int  PowerConnection           :1;
-    unsigned int  SourceSink                :1;
-    unsigned int  TypeC_Current             :2;
-    unsigned int  Charger_Detect_Status     :4;
-
-    unsigned int  Charger_AdvertiseStatus   :2;
-    unsigned int  Reserved0                 :6;
-
-} s_TPS_Power_Status;
-
-enum
+typedef enum
 {
     USB_Default_Current = 0,
     C_1d5A_Current = 1,
@@ -123,12 +70,6 @@ enum
 } TPS_TypeC_Current_Type;
 
 
-typedef  struct
-{
-    unsigned int  regionnum         :1;
-    unsigned int  Reserved          :7;
-} s_TPS_flrr;
-
 typedef  struct
 {
     unsigned int   flashaddr;
@@ -145,16 +86,264 @@ typedef  struct
     unsigned int   flashaddr;
 } s_TPS_flvy;
 
+typedef  struct
+{
+    unsigned int   flashaddr;
+} s_TPS_flrd;
+
 #define  REGION_0   0
 #define  REGION_1   1
 
 #define  DISABLE_PORT   0x03
 
+#define  FLASH_SECTOR_SIZE          0x1000
+#define  FLASH_WRITE_CHUNK_SIZE     64
+#define  FLASH_READ_CHUNK_SIZE      16
+#define  FLASH_MAX_SECTORS          64
+
+/*
+* FLem runs longer than this are split into equal batches, so every FLem
+* stays well within its poll deadline and takes about as long as the others
+*/
+#define  FLASH_ERASE_BATCH_SECTORS  8
+
+/*
+* delta: FLrd reads spread over a sector, first to last 16 bytes, that
+* confirm the sector map's "unchanged"
+*/
+#define  SECTOR_MAP_PROBES          4
+
+/*
+* upgrade flags, see tps65987_set_upgrade_flags()
+* UPGRADE_FLAG_DELTA: only erase/rewrite the 4k sectors which changed, against the sector
+*                      digests of the last verified write (next to the journal, see
+*                      tps65987_journal.h); without them the whole region is written
+* UPGRADE_FLAG_SPARSE: don't FLwd chunks that are all 0xFF after erase, FLad past them instead
+* UPGRADE_FLAG_STAGED: write the inactive region with the port up, disable it only to switch
+*                      over (GAID) to the new image, then copy to the other region
+* UPGRADE_FLAG_DEFERRED: switch over (GAID) as soon as the inactive region verifies and return;
+*                      the copy to the other region is left to tps65987_dev_copy_region()
+*/
+#define  UPGRADE_FLAG_DELTA         0x01
+#define  UPGRADE_FLAG_SPARSE        0x02
+#define  UPGRADE_FLAG_STAGED        0x04
+#define  UPGRADE_FLAG_DEFERRED      0x08
+
+#define  FLASH_ERASED_VALUE         0xFF
+
+/*
+* A chunk whose FLwd fails is written again, a few times, from its own
+* address; only if that keeps failing its sector is erased again (once) and
+* rewritten from the sector start. The upgrade is given up only after that.
+*/
+#define  FLASH_CHUNK_RETRIES        3
+#define  FLASH_SECTOR_RETRIES       1
+#define  FLASH_CMD_RETRIES          3       //FLrr, FLem, FLad, FLvy after a bus error or "CMD "
+#define  FLASH_RETRY_BACKOFF_US     2000    //doubled on every retry
+
+/*
+* Waiting for the port to report disabled and for the controller to come
+* back from GAID: poll, starting every READY_POLL_MIN_US and backing off to
+* READY_POLL_MAX_US, until ready or the timeout
+*/
+#define  READY_POLL_MIN_US          1000
+#define  READY_POLL_MAX_US          64000
+#define  PORT_DISABLE_TIMEOUT_MS    3000
+#define  RESET_TIMEOUT_MS           5000
+
+/*
+* patch bundle header: u32 magic, u32, u32 data offset, u32 data length
+*/
+#define  PATCH_BUNDLE_MAGIC         0xACE00001
+#define  PATCH_BUNDLE_HDR_SIZE      16
+
+/*
+* sparse image file, accepted in place of a plain .bin:
+*   "TPSS", u32 image length, u32 number of records,
+*   then per record: u32 offset, u32 length, <length> bytes of data
+* all values little-endian, bytes not covered by a record are 0xFF
+*/
+#define  SPARSE_IMAGE_MAGIC         "TPSS"
+
+
+/*
+* why the last 4CC command of a controller failed, see s_TPS_dev.last_error
+*/
+enum TPS_ERROR
+{
+    TPS_ERR_NONE,
+    TPS_ERR_BUS,            //NACK or bus error
+    TPS_ERR_TIMEOUT,        //CMD1 not cleared within the poll deadline
+    TPS_ERR_REJECT,         //"CMD ": the controller failed the command
+    TPS_ERR_UNRECOGNIZED,   //"!CMD": unknown command, retrying won't help
+    TPS_ERR_FLASH,          //completed, but the flash command reported an error
+
+    TPS_ERR_NUM,
+};
+
+/*
+* upgrade phases, see tps65987_get_upgrade_stats()
+*/
+enum UPGRADE_PHASE
+{
+    PHASE_PRE_OPS,
+    PHASE_FLRR,
+    PHASE_READBACK,
+    PHASE_FLEM,
+    PHASE_WRITE,
+    PHASE_FLVY,
+    PHASE_SECOND_REGION,
+    PHASE_RESET,
+
+    UPGRADE_PHASE_NUM,
+};
+
+/*
+* timing of the last tps65987_dev_flash_upgrade(); FLrr..FLvy are for the first
+* (inactive) region, the copy to the second region is timed as a whole
+*/
+typedef struct
+{
+    unsigned long long  phase_us[UPGRADE_PHASE_NUM];
+    unsigned long long  total_us;
+
+    unsigned long long  port_down_us;       //port disabled until the controller is back from GAID
+    unsigned long long  port_disable_us;    //PORTCONFIG write until the port reports disabled
+    unsigned long long  boot_us;            //GAID until the controller runs its application
+
+    unsigned int        payload_bytes;      //FLwd data, both regions
+    unsigned int        written_chunks;
+    unsigned int        skipped_chunks;
+
+    unsigned int        retried_chunks;     //FLwd written again after an error
+    unsigned int        reerased_sectors;
+    unsigned int        retried_cmds;       //other flash commands sent again, see FLASH_CMD_RETRIES
+    unsigned int        full_rewrites;      //delta/resumed regions written whole after FLvy failed
+    unsigned int        errors[TPS_ERR_NUM];
+
+    unsigned long long  patch_us;           //last tps65987_dev_host_patch(), PTCs..PTCc
+    unsigned int        patch_bytes;
+} s_TPS_upgrade_stats;
+
+
+enum FLASH_UPGRADE_STATE
+{
+    OPEN_FILE,
+    READ_FILE,
+    VERIFY_IF_VALID,
+    CLOSE_FILE,
+};
+
+
+struct FLASH_UPGRADE_PARA
+{
+    enum FLASH_UPGRADE_STATE flash_upgrade_state;
+
+    unsigned char active_region;
+    unsigned char inactive_region;
+
+    unsigned char flash_upgrade_finish;
+
+    unsigned int upgrade_flags;
+
+    unsigned int write_offset;
+    unsigned char need_flad;
+
+    unsigned int written_chunks;
+    unsigned int skipped_chunks;
+
+    unsigned int region_addr[2];    //FLrr
+    unsigned int region_size;
+    int num_sectors;                //4k sectors the image covers
+
+    unsigned char dirty_sector[FLASH_MAX_SECTORS];
+    unsigned char reerased[FLASH_MAX_SECTORS];  //FLem again after failed chunk retries, this pass
+
+    unsigned char region_pass;      //0: inactive region, 1: copy to the active one
+
+    unsigned char resume;           //the journal holds an interrupted upgrade of this image
+
+    unsigned long long port_down_start_us;  //0: port not disabled by the upgrade
+    unsigned char switched;         //staged: GAID done, the updated region is running
+
+    unsigned char fallback_saved;   //first sector of Region-0, erased for the switch over
+    unsigned char fallback_sector[FLASH_SECTOR_SIZE];
+
+    unsigned char copy_pending;     //deferred: the new image runs, the copy is still to do
+};
+
+
+/*
+* One PD controller: its bus, address and everything the driver keeps about
+* it. Controllers on different buses can be driven from different threads;
+* controllers sharing a bus must not be used concurrently.
+*/
+typedef struct
+{
+    char                        name[32];
+    unsigned char               i2c_addr;
+    s_TPS_transport             *transport;
+
+    s_TPS_latency_model         latency;
+    struct FLASH_UPGRADE_PARA   flash_upgrade_para;
+    s_TPS_upgrade_stats         upgrade_stats;
+    enum TPS_ERROR              last_error;         //of the last 4CC command
+
+    s_TPS_source_caps_cache     source_caps;        //see tps65987_dev_get_source_caps()
+
+    char                        journal_file[128];  //"": no journal
+    char                        image_file[256];    //of a deferred copy
+    s_TPS_journal               journal;
+
+    //progress of a running upgrade, may be read from any thread
+    atomic_int                  phase;              //enum UPGRADE_PHASE, UPGRADE_PHASE_NUM when done
+    atomic_uint                 progress_bytes;     //chunks handled, both regions
+    atomic_uint                 total_bytes;
+} s_TPS_dev;
+
+
+extern unsigned int I2C_ADDR;
+
+s_TPS_transport *tps65987_i2c_open(unsigned char i2c_addr, const char *i2c_file_name);
+
+s_TPS_dev *tps65987_dev_create(const char *name, s_TPS_transport *p_transport, unsigned char i2c_addr);
+void tps65987_dev_destroy(s_TPS_dev *p_dev);
+s_TPS_dev *tps65987_default_dev(void);
+
+int tps65987_dev_write(s_TPS_dev *p_dev, unsigned char reg, unsigned char *val, unsigned char data_len);
+int tps65987_dev_read(s_TPS_dev *p_dev, unsigned char reg, unsigned char *val, unsigned char data_len);
+int tps65987_dev_exec_4CC_Cmd(s_TPS_dev *p_dev, unsigned char *cmd_ptr, unsigned char *cmd_data_in_ptr, unsigned char cmd_data_in_length, unsigned char *cmd_data_out_ptr, unsigned char cmd_data_out_length);
+int tps65987_dev_exec_4CC_Frame(s_TPS_dev *p_dev, unsigned char *cmd_ptr, unsigned char *frame, unsigned char frame_len, unsigned char *cmd_data_out_ptr, unsigned char cmd_data_out_length);
+int tps65987_dev_reset(s_TPS_dev *p_dev);
+int tps65987_dev_flash_upgrade(s_TPS_dev *p_dev, char *ota_file_name);
+void tps65987_dev_set_upgrade_flags(s_TPS_dev *p_dev, unsigned int flags);
+const s_TPS_upgrade_stats *tps65987_dev_get_upgrade_stats(s_TPS_dev *p_dev);
+void tps65987_dev_set_journal(s_TPS_dev *p_dev, const char *file_name);
+int tps65987_dev_copy_region(s_TPS_dev *p_dev);
+int tps65987_dev_host_patch(s_TPS_dev *p_dev, char *patch_file_name);
+int tps65987_dev_get_source_caps(s_TPS_dev *p_dev, s_TPS_source_caps *p_caps);
+const char *tps65987_error_name(enum TPS_ERROR error);
+
+/*
+* the calls below work on tps65987_default_dev()
+*/
 
+int check_endian(void);
 int i2c_open_tps65987(unsigned char i2c_addr, char *i2c_file_name);
+int tps65987_i2c_write(unsigned char dev_addr, unsigned char reg, unsigned char *val, unsigned char data_len);
+int tps65987_i2c_read(unsigned char addr, unsigned char reg, unsigned char *val, unsigned char data_len);
+int tps65987_exec_4CC_Cmd(unsigned char *cmd_ptr, unsigned char *cmd_data_in_ptr, unsigned char cmd_data_in_length, unsigned char *cmd_data_out_ptr, unsigned char cmd_data_out_length);
+int tps65987_host_patch_bundle(char *patch_file_name);
 int ResetPDController();
 int tps65987_ext_flash_upgrade(char *ota_file_name);
-int tps65987_get_Status(s_TPS_status *p_tps_status);
+void tps65987_set_upgrade_flags(unsigned int flags);
+const s_TPS_upgrade_stats *tps65987_get_upgrade_stats(void);
+void tps65987_set_journal(const char *file_name);
+int tps65987_copy_region(void);
+const char *tps65987_upgrade_phase_name(int phase);
+int tps65987_get_Status(unsigned char *p_status);
+int tps65987_get_PortRole(void);
 int tps65987_get_RXSourceNumValidPDOs(void);
 int tps65987_get_TypeC_Current(void);
 
+#endif
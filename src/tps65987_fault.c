@@ -0,0 +1,370 @@
+/**
+*  @file      tps65987_fault.c
+*  @brief     tps65987 fault injecting transport
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include<errno.h>
+#include<pthread.h>
+
+#include "tps65987_fault.h"
+#include "tps65987_drv.h"
+#include "tps65987_latency.h"
+
+#define  FAULT_NUM_ADDRS        128
+#define  FAULT_MAX_OPS          8
+
+
+typedef struct
+{
+    s_TPS_transport     transport;
+
+    s_TPS_transport     *bus;
+    s_TPS_fault_config  cfg;
+    unsigned int        seed;
+    pthread_mutex_t     lock;
+
+    unsigned char       cmd[FAULT_NUM_ADDRS][4];    //last 4CC written to CMD1
+
+    s_TPS_fault_stats   stats;
+} s_TPS_fault;
+
+
+/*
+* one register access of a transfer and where its data is
+*/
+typedef struct
+{
+    unsigned char       reg;
+    unsigned char       read;
+    unsigned char       *data;
+    unsigned int        len;
+} s_FAULT_op;
+
+
+void tps65987_fault_default_config(s_TPS_fault_config *p_cfg)
+{
+    memset(p_cfg, 0, sizeof(*p_cfg));
+    p_cfg->seed = 1;
+}
+
+
+int tps65987_fault_parse(const char *spec, s_TPS_fault_config *p_cfg)
+{
+    char buf[256];
+    char *save;
+    char *tok;
+    char *val;
+    char *end;
+
+    if(strlen(spec) >= sizeof(buf))
+    {
+        return -1;
+    }
+
+    strcpy(buf, spec);
+
+    for(tok = strtok_r(buf, ",", &save); tok != NULL; tok = strtok_r(NULL, ",", &save))
+    {
+        val = strchr(tok, '=');
+        if(val == NULL)
+        {
+            printf("fault %s: no value\n", tok);
+            return -1;
+        }
+        *val++ = 0;
+
+        if(strcmp(tok, "seed") == 0)
+        {
+            p_cfg->seed = strtoul(val, NULL, 0);
+            continue;
+        }
+
+        if(strcmp(tok, "nack") == 0)
+        {
+            p_cfg->nack_rate = strtod(val, &end);
+        }
+        else if(strcmp(tok, "io") == 0)
+        {
+            p_cfg->io_error_rate = strtod(val, &end);
+        }
+        else if(strcmp(tok, "delay") == 0)
+        {
+            p_cfg->delay_rate = strtod(val, &end);
+            if(*end == ':')
+            {
+                p_cfg->delay_us = strtoul(end + 1, &end, 0);
+            }
+        }
+        else if(strcmp(tok, "reject") == 0)
+        {
+            p_cfg->cmd_reject_rate = strtod(val, &end);
+        }
+        else if(strcmp(tok, "unknown") == 0)
+        {
+            p_cfg->cmd_unknown_rate = strtod(val, &end);
+        }
+        else if(strcmp(tok, "flwd") == 0)
+        {
+            p_cfg->flwd_fail_rate = strtod(val, &end);
+        }
+        else if(strcmp(tok, "flvy") == 0)
+        {
+            p_cfg->flvy_fail_rate = strtod(val, &end);
+        }
+        else
+        {
+            printf("unknown fault %s\n", tok);
+            return -1;
+        }
+
+        if(end == val || *end != 0)
+        {
+            printf("fault %s: bad value %s\n", tok, val);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+
+/*
+* locked
+*/
+static int Chance(s_TPS_fault *p_fault, double rate)
+{
+    return rate > 0 && rand_r(&p_fault->seed) < rate * ((double)RAND_MAX + 1);
+}
+
+
+/*
+* the register accesses of a transfer as tps65987_xact_*() lays them out:
+* reads are [reg] and one read of the count byte and the data, writes
+* [reg, len] before the data, in the same message or an I2C_M_NOSTART one
+*/
+static int ParseOps(struct i2c_msg *msgs, int nmsgs, s_FAULT_op *ops)
+{
+    s_FAULT_op *p_op;
+    int n = 0;
+    int i;
+
+    for(i = 0; i < nmsgs && n < FAULT_MAX_OPS; i++)
+    {
+        if((msgs[i].flags & I2C_M_RD) || msgs[i].len == 0)
+        {
+            continue;
+        }
+
+        p_op = &ops[n++];
+        p_op->reg = msgs[i].buf[0];
+        p_op->read = msgs[i].len == 1;
+        p_op->data = NULL;
+        p_op->len = 0;
+
+        if(p_op->read)
+        {
+            if(i + 1 < nmsgs && (msgs[i + 1].flags & I2C_M_RD) && msgs[i + 1].len > 1)
+            {
+                p_op->data = &msgs[i + 1].buf[1];
+                p_op->len = msgs[i + 1].len - 1;
+                i++;
+            }
+        }
+        else if(msgs[i].len > 2)
+        {
+            p_op->data = &msgs[i].buf[2];
+            p_op->len = msgs[i].len - 2;
+        }
+        else if(i + 1 < nmsgs && msgs[i + 1].flags == I2C_M_NOSTART)
+        {
+            p_op->data = msgs[i + 1].buf;
+            p_op->len = msgs[i + 1].len;
+            i++;
+        }
+    }
+
+    return n;
+}
+
+
+/*
+* locked, after a transfer that went through
+*/
+static void CorruptReads(s_TPS_fault *p_fault, struct i2c_msg *msgs, int nmsgs)
+{
+    s_FAULT_op ops[FAULT_MAX_OPS];
+    unsigned char *cmd = p_fault->cmd[msgs[0].addr & (FAULT_NUM_ADDRS - 1)];
+    unsigned char *data1 = NULL;
+    int done = 0;
+    int num;
+    int i;
+
+    num = ParseOps(msgs, nmsgs, ops);
+
+    for(i = 0; i < num; i++)
+    {
+        if(ops[i].data == NULL || ops[i].len < 1)
+        {
+            continue;
+        }
+
+        if(!ops[i].read && ops[i].reg == REG_CMD1 && ops[i].len >= 4)
+        {
+            memcpy(cmd, ops[i].data, 4);
+        }
+        else if(ops[i].read && ops[i].reg == REG_DATA1)
+        {
+            data1 = ops[i].data;
+        }
+        else if(ops[i].read && ops[i].reg == REG_CMD1 && ops[i].len >= 4 && memcmp(ops[i].data, "\0\0\0\0", 4) == 0)
+        {
+            if(Chance(p_fault, p_fault->cfg.cmd_reject_rate))
+            {
+                memcpy(ops[i].data, "CMD ", 4);
+                p_fault->stats.cmd_rejects++;
+            }
+            else if(Chance(p_fault, p_fault->cfg.cmd_unknown_rate))
+            {
+                memcpy(ops[i].data, "!CMD", 4);
+                p_fault->stats.cmd_unknowns++;
+            }
+            else
+            {
+                done = 1;
+            }
+        }
+    }
+
+    if(done && data1 != NULL && memcmp(cmd, "FLwd", 4) == 0 && data1[0] == 0 &&
+       Chance(p_fault, p_fault->cfg.flwd_fail_rate))
+    {
+        data1[0] = 1;
+        p_fault->stats.flwd_fails++;
+    }
+    else if(done && data1 != NULL && memcmp(cmd, "FLvy", 4) == 0 && data1[0] == 0 &&
+            Chance(p_fault, p_fault->cfg.flvy_fail_rate))
+    {
+        data1[0] = 1;
+        p_fault->stats.flvy_fails++;
+    }
+}
+
+
+static int fault_transfer(void *priv, struct i2c_msg *msgs, int nmsgs)
+{
+    s_TPS_fault *p_fault = priv;
+    int delay;
+    int nack;
+    int ret;
+
+    pthread_mutex_lock(&p_fault->lock);
+
+    p_fault->stats.transfers++;
+
+    delay = Chance(p_fault, p_fault->cfg.delay_rate);
+    p_fault->stats.delays += delay;
+
+    nack = Chance(p_fault, p_fault->cfg.nack_rate);
+    p_fault->stats.nacks += nack;
+
+    pthread_mutex_unlock(&p_fault->lock);
+
+    if(delay)
+    {
+        tps65987_sleep_us(p_fault->cfg.delay_us);
+    }
+
+    if(nack)
+    {
+        return -ENXIO;
+    }
+
+    ret = tps65987_transfer(p_fault->bus, msgs, nmsgs);
+    if(ret < 0)
+    {
+        return ret;
+    }
+
+    pthread_mutex_lock(&p_fault->lock);
+
+    CorruptReads(p_fault, msgs, nmsgs);
+
+    if(Chance(p_fault, p_fault->cfg.io_error_rate))
+    {
+        p_fault->stats.io_errors++;
+        ret = -EIO;
+    }
+
+    pthread_mutex_unlock(&p_fault->lock);
+
+    return ret;
+}
+
+
+static void fault_close(void *priv)
+{
+    s_TPS_fault *p_fault = priv;
+
+    if(p_fault->bus->close != NULL)
+    {
+        p_fault->bus->close(p_fault->bus->priv);
+    }
+
+    pthread_mutex_destroy(&p_fault->lock);
+    free(p_fault);
+}
+
+
+s_TPS_transport *tps65987_fault_transport(s_TPS_transport *p_bus, const s_TPS_fault_config *p_cfg)
+{
+    s_TPS_fault *p_fault;
+
+    if(p_bus == NULL)
+    {
+        return NULL;
+    }
+
+    p_fault = calloc(1, sizeof(*p_fault));
+    if(p_fault == NULL)
+    {
+        return NULL;
+    }
+
+    p_fault->bus = p_bus;
+    p_fault->cfg = *p_cfg;
+    p_fault->seed = p_cfg->seed;
+    pthread_mutex_init(&p_fault->lock, NULL);
+
+    p_fault->transport.name = "fault";
+    p_fault->transport.caps = p_bus->caps;
+    p_fault->transport.transfer = fault_transfer;
+    p_fault->transport.close = fault_close;
+    p_fault->transport.priv = p_fault;
+
+    return &p_fault->transport;
+}
+
+
+int tps65987_fault_get_stats(s_TPS_transport *p_fault, s_TPS_fault_stats *p_stats)
+{
+    s_TPS_fault *p;
+
+    if(p_fault == NULL || p_fault->transfer != fault_transfer)
+    {
+        return -1;
+    }
+
+    p = p_fault->priv;
+
+    pthread_mutex_lock(&p->lock);
+    *p_stats = p->stats;
+    pthread_mutex_unlock(&p->lock);
+
+    return 0;
+}
@@ -0,0 +1,60 @@
+/**
+*  @file      tps65987_fault.h
+*  @brief     tps65987 fault injecting transport
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#ifndef TPS65987_FAULT_H
+#define TPS65987_FAULT_H
+
+#include "tps65987_transport.h"
+
+/*
+* Wraps a bus and makes it misbehave at the given rates (0..1, per transfer
+* or per completed 4CC command), reproducibly for the same seed:
+* - nack:    the transfer fails before anything is sent
+* - io:      the transfer is sent but the ioctl fails anyway (lost ACK, timeout)
+* - delay:   the transfer starts delay_us late
+* - reject:  a finished 4CC command reads "CMD " from CMD1
+* - unknown: a finished 4CC command reads "!CMD" from CMD1
+* - flwd:    a finished FLwd reads a failed status from DATA1
+* - flvy:    a finished FLvy reads a failed status from DATA1
+*
+* As a string: "nack=0.01,io=0.005,delay=0.05:2000,reject=0.01,unknown=0,flwd=0.02,flvy=0,seed=7"
+*/
+typedef struct
+{
+    unsigned int    seed;
+    double          nack_rate;
+    double          io_error_rate;
+    double          delay_rate;
+    unsigned int    delay_us;
+    double          cmd_reject_rate;
+    double          cmd_unknown_rate;
+    double          flwd_fail_rate;
+    double          flvy_fail_rate;
+} s_TPS_fault_config;
+
+
+typedef struct
+{
+    unsigned long long  transfers;
+    unsigned long long  nacks;
+    unsigned long long  io_errors;
+    unsigned long long  delays;
+    unsigned long long  cmd_rejects;
+    unsigned long long  cmd_unknowns;
+    unsigned long long  flwd_fails;
+    unsigned long long  flvy_fails;
+} s_TPS_fault_stats;
+
+
+void tps65987_fault_default_config(s_TPS_fault_config *p_cfg);
+int tps65987_fault_parse(const char *spec, s_TPS_fault_config *p_cfg);
+
+s_TPS_transport *tps65987_fault_transport(s_TPS_transport *p_bus, const s_TPS_fault_config *p_cfg);
+int tps65987_fault_get_stats(s_TPS_transport *p_fault, s_TPS_fault_stats *p_stats);
+
+#endif
@@ -0,0 +1,265 @@
+/**
+*  @file      tps65987_image.c
+*  @brief     tps65987 flash upgrade image
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include<fcntl.h>
+#include<unistd.h>
+#include<sys/mman.h>
+#include<sys/stat.h>
+
+#include "tps65987_image.h"
+
+#define  IMAGE_MAX_SIZE     (FLASH_MAX_SECTORS * FLASH_SECTOR_SIZE)
+
+
+static unsigned int get_u32(const unsigned char *buf)
+{
+    return buf[0] | (buf[1] << 8) | (buf[2] << 16) | ((unsigned int)buf[3] << 24);
+}
+
+
+/*
+* expand a sparse image (SPARSE_IMAGE_MAGIC), the left out runs are 0xFF
+*/
+static int ExpandSparseImage(s_TPS_image *p_image, const unsigned char *file, unsigned int file_size)
+{
+    unsigned int image_len;
+    unsigned int num_records;
+    unsigned int rec_off;
+    unsigned int rec_len;
+    unsigned int pos;
+    unsigned int i;
+
+    image_len = get_u32(&file[4]);
+    num_records = get_u32(&file[8]);
+
+    printf("sparse upgrade image, %u bytes in %u records\n", image_len, num_records);
+
+    if(image_len == 0 || image_len > IMAGE_MAX_SIZE)
+    {
+        printf("sparse image length %u out of range\n", image_len);
+        return -1;
+    }
+
+    p_image->data = malloc(image_len);
+    if(p_image->data == NULL)
+    {
+        return -1;
+    }
+
+    p_image->size = image_len;
+    memset(p_image->data, FLASH_ERASED_VALUE, image_len);
+
+    pos = 12;
+    for(i = 0; i < num_records; i++)
+    {
+        if(file_size - pos < 8)
+        {
+            goto err;
+        }
+
+        rec_off = get_u32(&file[pos]);
+        rec_len = get_u32(&file[pos + 4]);
+        pos += 8;
+
+        if(rec_off > image_len || rec_len > image_len - rec_off || rec_len > file_size - pos)
+        {
+            printf("sparse record %u out of range, 0x%x + %u\n", i, rec_off, rec_len);
+            goto err;
+        }
+
+        memcpy(&p_image->data[rec_off], &file[pos], rec_len);
+        pos += rec_len;
+    }
+
+    return 0;
+
+err:
+    printf("sparse upgrade image is corrupt\n");
+    free(p_image->data);
+    p_image->data = NULL;
+    return -1;
+}
+
+
+/*
+* The image has to hold a patch bundle, either at its start (low-region-*.bin)
+* or where its leading pointer says (full-region-*.bin), and the bundle's data
+* has to be inside the image
+*/
+static int ValidateImage(s_TPS_image *p_image)
+{
+    unsigned int bundle;
+    unsigned int data_off;
+    unsigned int data_len;
+
+    if(p_image->size < PATCH_BUNDLE_HDR_SIZE || p_image->size > IMAGE_MAX_SIZE)
+    {
+        printf("upgrade image size %u out of range\n", p_image->size);
+        return -1;
+    }
+
+    bundle = 0;
+    if(get_u32(p_image->data) != PATCH_BUNDLE_MAGIC)
+    {
+        bundle = get_u32(p_image->data);
+
+        if(bundle > p_image->size - PATCH_BUNDLE_HDR_SIZE || get_u32(&p_image->data[bundle]) != PATCH_BUNDLE_MAGIC)
+        {
+            printf("no patch bundle in the upgrade image\n");
+            return -1;
+        }
+    }
+
+    data_off = get_u32(&p_image->data[bundle + 8]);
+    data_len = get_u32(&p_image->data[bundle + 12]);
+
+    if(data_off > p_image->size - bundle || data_len > p_image->size - bundle - data_off)
+    {
+        printf("patch bundle @ 0x%x: data 0x%x + %u past the end of the image (%u)\n",
+               bundle, data_off, data_len, p_image->size);
+        return -1;
+    }
+
+    p_image->bundle_offset = bundle;
+    p_image->bundle_end = bundle + data_off + data_len;
+
+    printf("upgrade image %u bytes, patch bundle @ 0x%x, data 0x%x + %u\n",
+           p_image->size, bundle, data_off, data_len);
+
+    return 0;
+}
+
+
+static int BuildFrames(s_TPS_image *p_image)
+{
+    unsigned char *frame;
+    unsigned int i;
+
+    p_image->num_chunks = (p_image->size + FLASH_WRITE_CHUNK_SIZE - 1) / FLASH_WRITE_CHUNK_SIZE;
+
+    p_image->frames = malloc(p_image->num_chunks * IMAGE_FRAME_SIZE);
+    if(p_image->frames == NULL)
+    {
+        return -1;
+    }
+
+    memset(p_image->frames, FLASH_ERASED_VALUE, p_image->num_chunks * IMAGE_FRAME_SIZE);
+
+    for(i = 0; i < p_image->num_chunks; i++)
+    {
+        frame = &p_image->frames[i * IMAGE_FRAME_SIZE];
+
+        frame[0] = REG_DATA1;
+        frame[1] = FLASH_WRITE_CHUNK_SIZE;
+        memcpy(&frame[IMAGE_FRAME_HDR_SIZE], tps65987_image_chunk(p_image, i), tps65987_image_chunk_len(p_image, i));
+    }
+
+    return 0;
+}
+
+
+int tps65987_image_load(s_TPS_image *p_image, const char *file_name)
+{
+    struct stat st;
+    unsigned char *file;
+    int fd;
+
+    memset(p_image, 0, sizeof(*p_image));
+
+    fd = open(file_name, O_RDONLY);
+    if(fd < 0)
+    {
+        printf("fail to open tps65987 upgrade bin file %s\n", file_name);
+        return -1;
+    }
+
+    if(fstat(fd, &st) != 0 || st.st_size == 0 || st.st_size > 2 * IMAGE_MAX_SIZE)
+    {
+        printf("upgrade bin file %s: bad size\n", file_name);
+        close(fd);
+        return -1;
+    }
+
+    file = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if(file == MAP_FAILED)
+    {
+        perror("mmap upgrade bin file");
+        return -1;
+    }
+
+    if(st.st_size >= 12 && memcmp(file, SPARSE_IMAGE_MAGIC, 4) == 0)
+    {
+        if(ExpandSparseImage(p_image, file, st.st_size) != 0)
+        {
+            munmap(file, st.st_size);
+            return -1;
+        }
+
+        munmap(file, st.st_size);
+    }
+    else
+    {
+        p_image->data = file;
+        p_image->size = st.st_size;
+        p_image->map_size = st.st_size;
+    }
+
+    if(ValidateImage(p_image) != 0 || BuildFrames(p_image) != 0)
+    {
+        tps65987_image_free(p_image);
+        return -1;
+    }
+
+    return 0;
+}
+
+
+void tps65987_image_free(s_TPS_image *p_image)
+{
+    if(p_image->map_size != 0)
+    {
+        munmap(p_image->data, p_image->map_size);
+    }
+    else
+    {
+        free(p_image->data);
+    }
+
+    free(p_image->frames);
+
+    memset(p_image, 0, sizeof(*p_image));
+}
+
+
+/*
+* the FLwd frame of 'chunk', ready to be written to the bus as it is
+*/
+unsigned char *tps65987_image_frame(const s_TPS_image *p_image, unsigned int chunk)
+{
+    return &p_image->frames[chunk * IMAGE_FRAME_SIZE];
+}
+
+
+unsigned char *tps65987_image_chunk(const s_TPS_image *p_image, unsigned int chunk)
+{
+    return &p_image->data[chunk * FLASH_WRITE_CHUNK_SIZE];
+}
+
+
+//image bytes in 'chunk', less than 64 only for the last one
+unsigned int tps65987_image_chunk_len(const s_TPS_image *p_image, unsigned int chunk)
+{
+    unsigned int off = chunk * FLASH_WRITE_CHUNK_SIZE;
+
+    return p_image->size - off < FLASH_WRITE_CHUNK_SIZE ? p_image->size - off : FLASH_WRITE_CHUNK_SIZE;
+}
@@ -0,0 +1,48 @@
+/**
+*  @file      tps65987_image.h
+*  @brief     tps65987 flash upgrade image
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#ifndef TPS65987_IMAGE_H
+#define TPS65987_IMAGE_H
+
+#include "tps65987_drv.h"
+
+/*
+* FLwd frame as it goes on the bus: DATA1 register, byte count, 64 bytes.
+* The last chunk of an image that isn't a multiple of 64 is padded with
+* 0xFF, which leaves the erased flash as it is.
+*/
+#define  IMAGE_FRAME_HDR_SIZE       2
+#define  IMAGE_FRAME_SIZE           (IMAGE_FRAME_HDR_SIZE + FLASH_WRITE_CHUNK_SIZE)
+
+/*
+* The upgrade image, loaded and checked once before anything is touched and
+* then used for both regions. A plain .bin is mmap'd, a sparse one expanded
+* into memory.
+*/
+typedef struct
+{
+    unsigned char   *data;
+    unsigned int    size;
+    unsigned int    map_size;       //!= 0: data is mmap'd
+
+    unsigned int    bundle_offset;  //patch bundle header, 0 or behind the leading pointer
+    unsigned int    bundle_end;     //end of the patch bundle data
+
+    unsigned char   *frames;        //num_chunks * IMAGE_FRAME_SIZE
+    unsigned int    num_chunks;
+} s_TPS_image;
+
+
+int tps65987_image_load(s_TPS_image *p_image, const char *file_name);
+void tps65987_image_free(s_TPS_image *p_image);
+
+unsigned char *tps65987_image_frame(const s_TPS_image *p_image, unsigned int chunk);
+unsigned char *tps65987_image_chunk(const s_TPS_image *p_image, unsigned int chunk);
+unsigned int tps65987_image_chunk_len(const s_TPS_image *p_image, unsigned int chunk);
+
+#endif
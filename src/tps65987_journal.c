@@ -0,0 +1,205 @@
+/**
+*  @file      tps65987_journal.c
+*  @brief     tps65987 flash upgrade progress journal
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#include<stdio.h>
+#include<string.h>
+#include<fcntl.h>
+#include<unistd.h>
+#include<stddef.h>
+
+#include "tps65987_journal.h"
+
+
+/*
+* FNV-1a, 64 bit
+*/
+unsigned long long tps65987_journal_digest(const unsigned char *data, unsigned int len)
+{
+    unsigned long long hash = 0xcbf29ce484222325ULL;
+    unsigned int i;
+
+    for(i = 0; i < len; i++)
+    {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+
+unsigned long long tps65987_sector_digest(const unsigned char *image, unsigned int size, unsigned int sector)
+{
+    unsigned long long hash = 0xcbf29ce484222325ULL;
+    unsigned int pos = sector * JOURNAL_SECTOR_SIZE;
+    unsigned int end = pos + JOURNAL_SECTOR_SIZE;
+
+    for(; pos < end; pos++)
+    {
+        hash ^= pos < size ? image[pos] : 0xFF;
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+
+static unsigned int journal_check(const s_TPS_journal_rec *p_rec)
+{
+    unsigned long long hash = tps65987_journal_digest((const unsigned char *)p_rec, offsetof(s_TPS_journal_rec, check));
+
+    return (unsigned int)(hash ^ (hash >> 32));
+}
+
+
+static unsigned int sector_map_check(const s_TPS_sector_map *p_map)
+{
+    unsigned long long hash = tps65987_journal_digest((const unsigned char *)p_map, offsetof(s_TPS_sector_map, check));
+
+    return (unsigned int)(hash ^ (hash >> 32));
+}
+
+
+/*
+* 0 if the file holds an intact map, -1 if there is none (p_map is then
+* all unknown)
+*/
+int tps65987_sector_map_load(s_TPS_sector_map *p_map, const char *file_name)
+{
+    FILE *fp;
+    int ok;
+
+    fp = fopen(file_name, "rb");
+    ok = fp != NULL && fread(p_map, sizeof(*p_map), 1, fp) == 1 && p_map->magic == SECTOR_MAP_MAGIC &&
+         p_map->version == SECTOR_MAP_VERSION && p_map->check == sector_map_check(p_map);
+
+    if(fp != NULL)
+    {
+        fclose(fp);
+    }
+
+    if(!ok)
+    {
+        memset(p_map, 0, sizeof(*p_map));
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/*
+* written whole and synced, a torn write is caught by the check
+*/
+int tps65987_sector_map_save(s_TPS_sector_map *p_map, const char *file_name)
+{
+    int fd;
+    int ret;
+
+    p_map->magic = SECTOR_MAP_MAGIC;
+    p_map->version = SECTOR_MAP_VERSION;
+    p_map->check = sector_map_check(p_map);
+
+    fd = open(file_name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if(fd < 0)
+    {
+        printf("fail to open sector map %s\n", file_name);
+        return -1;
+    }
+
+    ret = write(fd, p_map, sizeof(*p_map)) == sizeof(*p_map) && fdatasync(fd) == 0 ? 0 : -1;
+    close(fd);
+
+    if(ret != 0)
+    {
+        printf("sector map write failed\n");
+    }
+
+    return ret;
+}
+
+
+/*
+* 1 if the file holds an intact record (in p_journal->rec), 0 if it is new
+* or unusable, -1 if it can't be opened
+*/
+int tps65987_journal_open(s_TPS_journal *p_journal, const char *file_name)
+{
+    memset(p_journal, 0, sizeof(*p_journal));
+
+    p_journal->fd = open(file_name, O_RDWR | O_CREAT, 0644);
+    if(p_journal->fd < 0)
+    {
+        printf("fail to open journal %s\n", file_name);
+        return -1;
+    }
+
+    if(pread(p_journal->fd, &p_journal->rec, sizeof(p_journal->rec), 0) != sizeof(p_journal->rec))
+    {
+        memset(&p_journal->rec, 0, sizeof(p_journal->rec));
+        return 0;
+    }
+
+    if(p_journal->rec.magic != JOURNAL_MAGIC || p_journal->rec.version != JOURNAL_VERSION ||
+       p_journal->rec.check != journal_check(&p_journal->rec))
+    {
+        printf("journal %s unusable, ignored\n", file_name);
+        memset(&p_journal->rec, 0, sizeof(p_journal->rec));
+        return 0;
+    }
+
+    return 1;
+}
+
+
+/*
+* the record is small enough to be written in one piece, a torn write is
+* caught by the check on the next open
+*/
+int tps65987_journal_write(s_TPS_journal *p_journal)
+{
+    if(p_journal->fd < 0)
+    {
+        return 0;
+    }
+
+    p_journal->rec.magic = JOURNAL_MAGIC;
+    p_journal->rec.version = JOURNAL_VERSION;
+    p_journal->rec.check = journal_check(&p_journal->rec);
+    p_journal->unsynced = 0;
+
+    if(pwrite(p_journal->fd, &p_journal->rec, sizeof(p_journal->rec), 0) != sizeof(p_journal->rec) ||
+       fdatasync(p_journal->fd) != 0)
+    {
+        printf("journal write failed\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+
+void tps65987_journal_close(s_TPS_journal *p_journal)
+{
+    if(p_journal->fd >= 0)
+    {
+        close(p_journal->fd);
+        p_journal->fd = -1;
+    }
+}
+
+
+/*
+* the upgrade is through, nothing to resume
+*/
+int tps65987_journal_remove(s_TPS_journal *p_journal, const char *file_name)
+{
+    tps65987_journal_close(p_journal);
+
+    return unlink(file_name);
+}
@@ -0,0 +1,103 @@
+/**
+*  @file      tps65987_journal.h
+*  @brief     tps65987 flash upgrade progress journal
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#ifndef TPS65987_JOURNAL_H
+#define TPS65987_JOURNAL_H
+
+#define  JOURNAL_FILE_NAME      "/data/tps65987-journal-%s-%02x.bin"   //per bus (basename) and i2c address
+
+#define  JOURNAL_MAGIC          0x4A535054      //"TPSJ"
+#define  JOURNAL_VERSION        1
+
+#define  JOURNAL_NOT_STARTED    0xFFFFFFFF      //write_offset of a pass that hasn't erased yet
+#define  JOURNAL_SYNC_CHUNKS    16              //FLwd chunks between two journal writes
+#define  JOURNAL_MAX_SECTORS    64              //FLASH_MAX_SECTORS
+#define  JOURNAL_SECTOR_SIZE    0x1000          //FLASH_SECTOR_SIZE
+
+
+/*
+* One fixed size record, rewritten in place and synced:
+* the image, which pass of StartFlashUpdate() is running, what it erased and
+* how far it got. Every chunk before write_offset is in the flash.
+*/
+typedef struct
+{
+    unsigned int        magic;
+    unsigned int        version;
+
+    unsigned long long  image_digest;       //tps65987_journal_digest() of the image
+    unsigned int        image_size;
+    unsigned int        upgrade_flags;
+
+    unsigned char       active_region;
+    unsigned char       region_pass;        //0: inactive region, 1: copy to the active one
+    unsigned char       reserved[2];
+
+    unsigned int        region_addr;
+    unsigned int        num_sectors;
+    unsigned int        write_offset;       //JOURNAL_NOT_STARTED before the pass erased anything
+    unsigned char       erased[JOURNAL_MAX_SECTORS];
+
+    unsigned int        check;              //over everything above
+} s_TPS_journal_rec;
+
+
+typedef struct
+{
+    int                 fd;
+    s_TPS_journal_rec   rec;
+    unsigned int        unsynced;           //chunks since the last write
+} s_TPS_journal;
+
+
+/*
+* What each region holds, kept next to the journal (SECTOR_MAP_SUFFIX) for
+* delta upgrades: the digest of every 4k sector of the image last written and
+* verified there. A region that is being changed has num_sectors 0.
+*/
+#define  SECTOR_MAP_SUFFIX      ".sectors"
+#define  SECTOR_MAP_MAGIC       0x4D535054      //"TPSM"
+#define  SECTOR_MAP_VERSION     1
+#define  SECTOR_MAP_REGIONS     2
+#define  SECTOR_MAP_UNKNOWN     0ULL            //digest of a sector that was erased since
+
+typedef struct
+{
+    unsigned int        region_addr;
+    unsigned int        num_sectors;        //0: unknown
+    unsigned long long  digest[JOURNAL_MAX_SECTORS];
+} s_TPS_sector_map_region;
+
+typedef struct
+{
+    unsigned int            magic;
+    unsigned int            version;
+
+    s_TPS_sector_map_region region[SECTOR_MAP_REGIONS];
+
+    unsigned int            check;          //over everything above
+} s_TPS_sector_map;
+
+
+unsigned long long tps65987_journal_digest(const unsigned char *data, unsigned int len);
+
+/*
+* sector 'sector' of an image as it is in the flash after it's written:
+* erased (0xFF) where the image ends
+*/
+unsigned long long tps65987_sector_digest(const unsigned char *image, unsigned int size, unsigned int sector);
+
+int tps65987_sector_map_load(s_TPS_sector_map *p_map, const char *file_name);
+int tps65987_sector_map_save(s_TPS_sector_map *p_map, const char *file_name);
+
+int tps65987_journal_open(s_TPS_journal *p_journal, const char *file_name);
+int tps65987_journal_write(s_TPS_journal *p_journal);
+void tps65987_journal_close(s_TPS_journal *p_journal);
+int tps65987_journal_remove(s_TPS_journal *p_journal, const char *file_name);
+
+#endif
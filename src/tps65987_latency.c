@@ -0,0 +1,211 @@
+/**
+*  @file      tps65987_latency.c
+*  @brief     tps65987 4CC command latency model
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+/*
+* Every 4CC command keeps the completion times it was seen with. The poll
+* loop in tps65987_check_4CC_Cmd_executed() asks for the first poll time
+* (learned median), backs off from there and gives up at the per-command
+* deadline, instead of sleeping a fixed 10ms before each of 50 polls.
+*/
+
+#include<stdio.h>
+#include<string.h>
+#include<time.h>
+#include<errno.h>
+
+#include "tps65987_latency.h"
+
+static const s_TPS_cmd_latency latency_defaults[LATENCY_NUM_CMDS] =
+{
+    /* cmd     initial_us  deadline_us */
+    { "FLrr",        1000,      500000 },
+    { "FLem",       50000,     4000000 },
+    { "FLad",         500,      500000 },
+    { "FLwd",        1000,      500000 },
+    { "FLrd",         500,      500000 },
+    { "FLvy",       20000,     2000000 },
+    { "PTCd",        1000,      500000 },
+    { "GAID",      100000,     2000000 },
+    { "????",       10000,      500000 },   //any other command
+};
+
+
+void tps65987_latency_init(s_TPS_latency_model *p_model)
+{
+    memcpy(p_model->cmd, latency_defaults, sizeof(p_model->cmd));
+}
+
+
+unsigned long long tps65987_now_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (unsigned long long)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+
+void tps65987_sleep_us(unsigned int us)
+{
+    struct timespec ts;
+
+    ts.tv_sec = us / 1000000;
+    ts.tv_nsec = (us % 1000000) * 1000;
+
+    while(nanosleep(&ts, &ts) != 0 && errno == EINTR);
+}
+
+
+s_TPS_cmd_latency *tps65987_latency_get(s_TPS_latency_model *p_model, const unsigned char *cmd)
+{
+    int i;
+
+    for(i = 0; i < LATENCY_NUM_CMDS - 1; i++)
+    {
+        if(memcmp(p_model->cmd[i].cmd, cmd, 4) == 0)
+        {
+            return &p_model->cmd[i];
+        }
+    }
+
+    return &p_model->cmd[LATENCY_NUM_CMDS - 1];
+}
+
+
+unsigned int tps65987_latency_median(const s_TPS_cmd_latency *p_lat)
+{
+    unsigned int sorted[LATENCY_RECENT_SAMPLES];
+    unsigned int n;
+    unsigned int i, j;
+    unsigned int tmp;
+
+    n = p_lat->samples < LATENCY_RECENT_SAMPLES ? p_lat->samples : LATENCY_RECENT_SAMPLES;
+    if(n == 0)
+    {
+        return p_lat->initial_us;
+    }
+
+    memcpy(sorted, p_lat->recent, n * sizeof(sorted[0]));
+
+    for(i = 1; i < n; i++)
+    {
+        tmp = sorted[i];
+        for(j = i; j > 0 && sorted[j - 1] > tmp; j--)
+        {
+            sorted[j] = sorted[j - 1];
+        }
+        sorted[j] = tmp;
+    }
+
+    return sorted[n / 2];
+}
+
+
+/*
+* Poll a bit before the median: a sample is only ever as short as the first
+* poll, so polling right at the median would never let the model learn
+* that the command got faster.
+*/
+unsigned int tps65987_latency_first_poll(const s_TPS_cmd_latency *p_lat)
+{
+    unsigned int us;
+
+    us = tps65987_latency_median(p_lat) * 3 / 4;
+
+    if(us < LATENCY_MIN_POLL_US)
+    {
+        us = LATENCY_MIN_POLL_US;
+    }
+
+    return us;
+}
+
+
+void tps65987_latency_add(s_TPS_cmd_latency *p_lat, unsigned int us)
+{
+    unsigned int bucket = 0;
+
+    while(bucket < LATENCY_HIST_BUCKETS - 1 && (us >> bucket) != 0)
+    {
+        bucket++;
+    }
+
+    p_lat->hist[bucket]++;
+
+    if(p_lat->samples == 0 || us < p_lat->min_us)
+    {
+        p_lat->min_us = us;
+    }
+
+    if(us > p_lat->max_us)
+    {
+        p_lat->max_us = us;
+    }
+
+    p_lat->samples++;
+    p_lat->total_us += us;
+
+    p_lat->recent[p_lat->recent_idx] = us;
+    p_lat->recent_idx = (p_lat->recent_idx + 1) % LATENCY_RECENT_SAMPLES;
+}
+
+
+void tps65987_latency_timeout(s_TPS_cmd_latency *p_lat)
+{
+    p_lat->timeouts++;
+}
+
+
+void tps65987_latency_reset(s_TPS_latency_model *p_model)
+{
+    tps65987_latency_init(p_model);
+}
+
+
+/*
+* print the observed latency histograms, bucket [n] holds samples in [2^(n-1), 2^n) us
+*/
+void tps65987_latency_dump(const s_TPS_latency_model *p_model, FILE *out)
+{
+    int i, b;
+    const s_TPS_cmd_latency *p_lat;
+
+    for(i = 0; i < LATENCY_NUM_CMDS; i++)
+    {
+        p_lat = &p_model->cmd[i];
+
+        if(p_lat->samples == 0 && p_lat->timeouts == 0)
+        {
+            continue;
+        }
+
+        fprintf(out, "4CC %s: n=%u timeout=%u min=%uus median=%uus mean=%lluus max=%uus\n",
+                p_lat->cmd, p_lat->samples, p_lat->timeouts, p_lat->min_us,
+                tps65987_latency_median(p_lat),
+                p_lat->samples ? p_lat->total_us / p_lat->samples : 0ULL,
+                p_lat->max_us);
+
+        for(b = 0; b < LATENCY_HIST_BUCKETS; b++)
+        {
+            if(p_lat->hist[b] == 0)
+            {
+                continue;
+            }
+
+            if(b == LATENCY_HIST_BUCKETS - 1)
+            {
+                fprintf(out, "   >= %8uus : %u\n", 1u << (b - 1), p_lat->hist[b]);
+            }
+            else
+            {
+                fprintf(out, "    < %8uus : %u\n", 1u << b, p_lat->hist[b]);
+            }
+        }
+    }
+}
@@ -0,0 +1,64 @@
+/**
+*  @file      tps65987_latency.h
+*  @brief     tps65987 4CC command latency model
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#ifndef TPS65987_LATENCY_H
+#define TPS65987_LATENCY_H
+
+#include<stdio.h>
+
+#define  LATENCY_HIST_BUCKETS       24      //log2 buckets in us, last one is >= 2^22 us
+#define  LATENCY_RECENT_SAMPLES     16
+
+#define  LATENCY_MIN_POLL_US        50
+#define  LATENCY_MAX_POLL_US        10000
+
+#define  LATENCY_NUM_CMDS           9       //incl. the entry for any other command
+
+
+typedef struct
+{
+    char                cmd[5];
+
+    unsigned int        initial_us;     //first poll when nothing was learned yet
+    unsigned int        deadline_us;    //give up after this long
+
+    unsigned int        samples;
+    unsigned int        timeouts;
+    unsigned long long  total_us;
+    unsigned int        min_us;
+    unsigned int        max_us;
+
+    unsigned int        hist[LATENCY_HIST_BUCKETS];
+
+    unsigned int        recent[LATENCY_RECENT_SAMPLES];
+    unsigned int        recent_idx;
+} s_TPS_cmd_latency;
+
+
+/*
+* one model per controller, they don't share what they learned
+*/
+typedef struct
+{
+    s_TPS_cmd_latency   cmd[LATENCY_NUM_CMDS];
+} s_TPS_latency_model;
+
+
+unsigned long long tps65987_now_us(void);
+void tps65987_sleep_us(unsigned int us);
+
+void tps65987_latency_init(s_TPS_latency_model *p_model);
+s_TPS_cmd_latency *tps65987_latency_get(s_TPS_latency_model *p_model, const unsigned char *cmd);
+unsigned int tps65987_latency_median(const s_TPS_cmd_latency *p_lat);
+unsigned int tps65987_latency_first_poll(const s_TPS_cmd_latency *p_lat);
+void tps65987_latency_add(s_TPS_cmd_latency *p_lat, unsigned int us);
+void tps65987_latency_timeout(s_TPS_cmd_latency *p_lat);
+void tps65987_latency_reset(s_TPS_latency_model *p_model);
+void tps65987_latency_dump(const s_TPS_latency_model *p_model, FILE *out);
+
+#endif
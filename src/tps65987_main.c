@@ -0,0 +1,801 @@
+/**
+*  @file      tps65987_main.c
+*  @brief     tps65987 ota tool
+*  @author    Link Lin
+*  @date      11 -2019
+*  @copyright
+*/
+
+#include<stdio.h>
+#include<unistd.h>
+#include<string.h>
+#include<stdlib.h>
+#include<fcntl.h>
+
+#include "tps65987_drv.h"
+#include "tps65987_latency.h"
+#include "tps65987_transport.h"
+#include "tps65987_sim.h"
+#include "tps65987_trace.h"
+#include "tps65987_multi.h"
+#include "tps65987_monitor.h"
+#include "tps65987_shm.h"
+#include "tps65987_journal.h"
+#include "tps65987_replay.h"
+#include "tps65987_fault.h"
+#include "tps65987_query.h"
+#include "tps65987_config.h"
+
+#define OTA_FILE_NAME "/data/ota-file/low-region-flash-"
+#define OTA_FILE_NAME1 ".bin"
+
+#define TRACE_FILE_NAME "/data/tps65987-trace.bin"
+
+/*
+* the ota file has to be newer than what the controller runs, both are
+* named by the customer use byte
+*/
+static int is_newer_version(s_TPS_dev *p_dev, char *ota_file_name)
+{
+    unsigned char customeruse[64] = {0};
+    char local_file_name[128];
+
+    if(tps65987_dev_read(p_dev, 0x06, customeruse, sizeof(customeruse)) != 0)
+    {
+        return 0;
+    }
+
+    snprintf(local_file_name, sizeof(local_file_name), "%s%02x%s", OTA_FILE_NAME, customeruse[0], OTA_FILE_NAME1);
+    printf("%s: local-file is %s\n", p_dev->name, local_file_name);
+
+    return strcmp(ota_file_name, local_file_name) > 0;
+}
+
+
+/*
+* an interrupted upgrade resumes from the journal, the simulator forgets its
+* flash on exit so it doesn't get one
+*/
+static void set_journal(s_TPS_dev *p_dev, const char *bus_name)
+{
+    char file_name[128];
+    const char *base = strrchr(bus_name, '/');
+
+    snprintf(file_name, sizeof(file_name), JOURNAL_FILE_NAME, base ? base + 1 : bus_name, p_dev->i2c_addr);
+    tps65987_dev_set_journal(p_dev, file_name);
+}
+
+
+/*
+* a replayed run ends with how well the driver still followed the capture,
+* on stderr as stdout may be gone by then
+*/
+static void close_bus(s_TPS_sim *p_sim)
+{
+    s_TPS_replay_stats stats;
+
+    if(tps65987_replay_get_stats(tps65987_get_transport(), &stats) == 0)
+    {
+        fprintf(stderr, "replay: %llu transfers, %llu matched, %llu skipped, %llu stale, %llu diverged\n",
+                stats.transfers, stats.matched, stats.skipped, stats.stale, stats.diverged);
+    }
+
+    tps65987_close_transport();
+    tps65987_sim_destroy(p_sim);
+}
+
+
+/*
+* "<bus>[@addr],<bus>[@addr],..." with <bus> an i2c device or sim[:<image>],
+* every sim is a bus of its own, the same i2c device is one bus
+*/
+static int multi_upgrade_main(char *spec, char *ota_file_name, unsigned int upgrade_flags)
+{
+    s_TPS_upgrade_job jobs[MULTI_MAX_JOBS];
+    s_TPS_transport *buses[MULTI_MAX_JOBS];
+    char *bus_names[MULTI_MAX_JOBS];
+    s_TPS_sim *sims[MULTI_MAX_JOBS];
+    s_TPS_dev *devs[MULTI_MAX_JOBS];
+
+    s_TPS_sim_config sim_cfg;
+    s_TPS_transport *p_transport;
+
+    int nbuses = 0;
+    int nsims = 0;
+    int ndevs = 0;
+    int njobs = 0;
+    int ret;
+    int i;
+
+    char *entry;
+    char *saveptr = NULL;
+    char *at;
+    unsigned char addr;
+    char dev_name[32];
+
+    for(entry = strtok_r(spec, ",", &saveptr); entry != NULL; entry = strtok_r(NULL, ",", &saveptr))
+    {
+        if(ndevs == MULTI_MAX_JOBS)
+        {
+            printf("too many controllers, max %d\n", MULTI_MAX_JOBS);
+            break;
+        }
+
+        addr = I2C_ADDR;
+        at = strrchr(entry, '@');
+        if(at != NULL)
+        {
+            *at = 0;
+            addr = strtoul(at + 1, NULL, 0);
+        }
+
+        p_transport = NULL;
+
+        if(strncmp(entry, "sim", 3) == 0)
+        {
+            tps65987_sim_default_config(&sim_cfg);
+            sim_cfg.i2c_addr = addr;
+
+            sims[nsims] = tps65987_sim_create(&sim_cfg);
+            if(sims[nsims] == NULL)
+            {
+                continue;
+            }
+
+            if(entry[3] == ':' && tps65987_sim_load_image_file(sims[nsims], &entry[4]) != 0)
+            {
+                printf("fail to load sim image %s\n", &entry[4]);
+            }
+
+            p_transport = tps65987_sim_transport(sims[nsims]);
+            nsims++;
+        }
+        else
+        {
+            for(i = 0; i < nbuses; i++)
+            {
+                if(strcmp(bus_names[i], entry) == 0)
+                {
+                    p_transport = buses[i];
+                }
+            }
+
+            if(p_transport == NULL)
+            {
+                p_transport = tps65987_i2c_open(addr, entry);
+                if(p_transport == NULL)
+                {
+                    continue;
+                }
+
+                bus_names[nbuses] = entry;
+                buses[nbuses++] = p_transport;
+            }
+        }
+
+        if(strncmp(entry, "sim", 3) == 0)
+        {
+            snprintf(dev_name, sizeof(dev_name), "sim%d", nsims - 1);
+        }
+        else
+        {
+            snprintf(dev_name, sizeof(dev_name), "%s", entry);
+        }
+
+        devs[ndevs] = tps65987_dev_create(dev_name, p_transport, addr);
+        if(devs[ndevs] == NULL)
+        {
+            continue;
+        }
+
+        if(strncmp(entry, "sim", 3) != 0)
+        {
+            set_journal(devs[ndevs], entry);
+        }
+
+        if(is_newer_version(devs[ndevs], ota_file_name))
+        {
+            memset(&jobs[njobs], 0, sizeof(jobs[njobs]));
+            jobs[njobs].dev = devs[ndevs];
+            jobs[njobs].ota_file_name = ota_file_name;
+            jobs[njobs].upgrade_flags = upgrade_flags;
+            njobs++;
+        }
+        else
+        {
+            printf("%s@0x%02x: version is old, skipped\n", dev_name, addr);
+        }
+
+        ndevs++;
+    }
+
+    ret = tps65987_multi_upgrade(jobs, njobs, MULTI_REPORT_MS, tps65987_multi_print_progress, stderr);
+
+    for(i = 0; i < ndevs; i++)
+    {
+        tps65987_latency_dump(&devs[i]->latency, stdout);
+        tps65987_dev_destroy(devs[i]);
+    }
+
+    for(i = 0; i < nbuses; i++)
+    {
+        buses[i]->close(buses[i]->priv);
+    }
+
+    for(i = 0; i < nsims; i++)
+    {
+        tps65987_sim_destroy(sims[i]);
+    }
+
+    return ret;
+}
+
+
+/*
+* "monitor [--irq-gpio <n>] [--poll-us <us>] [--duration-ms <ms>] [--shm]":
+* report plug, contract and role changes as the controller raises them,
+* with --shm also publish them for "<addr> shm" and other readers
+*/
+static int monitor_main(s_TPS_dev *p_dev, int argc, char *argv[])
+{
+    s_TPS_monitor mon;
+    s_TPS_monitor_event event;
+    s_TPS_shm_snapshot snapshot;
+    s_TPS_shm *p_shm = NULL;
+    unsigned long long start;
+    unsigned long long now;
+    unsigned int duration_ms = 0;
+    unsigned int poll_us = 0;
+    int irq_gpio = -1;
+    int ret;
+    int i;
+
+    for(i = 4; i < argc; i++)
+    {
+        if(strcmp(argv[i], "--shm") == 0)
+        {
+            p_shm = tps65987_shm_create(p_dev->i2c_addr);
+        }
+
+        if(i + 1 == argc)
+        {
+            break;
+        }
+
+        if(strcmp(argv[i], "--irq-gpio") == 0)
+        {
+            irq_gpio = atoi(argv[++i]);
+        }
+        else if(strcmp(argv[i], "--poll-us") == 0)
+        {
+            poll_us = strtoul(argv[++i], NULL, 0);
+        }
+        else if(strcmp(argv[i], "--duration-ms") == 0)
+        {
+            duration_ms = strtoul(argv[++i], NULL, 0);
+        }
+    }
+
+    if(tps65987_monitor_open(&mon, p_dev, irq_gpio, poll_us) != 0)
+    {
+        fprintf(stderr, "%s: fail to start the monitor\n", p_dev->name);
+        tps65987_shm_close(p_shm);
+        return -1;
+    }
+
+    if(p_shm != NULL)
+    {
+        tps65987_monitor_snapshot(&mon, &snapshot);
+        tps65987_shm_publish(p_shm, &snapshot);
+    }
+
+    start = tps65987_now_us();
+
+    fprintf(stderr, "%s: monitoring, %s\n", p_dev->name, mon.irq_fd >= 0 ? "irq" : "polling");
+
+    for(;;)
+    {
+        now = tps65987_now_us();
+        if(duration_ms != 0 && now - start >= duration_ms * 1000ULL)
+        {
+            break;
+        }
+
+        ret = tps65987_monitor_wait(&mon, duration_ms ? duration_ms - (now - start) / 1000 : MONITOR_IRQ_SAFETY_MS, &event);
+        if(ret < 0)
+        {
+            fprintf(stderr, "%s: bus error\n", p_dev->name);
+            tps65987_sleep_us(MONITOR_IRQ_SAFETY_MS * 1000);
+            continue;
+        }
+
+        if(ret == 0)
+        {
+            continue;
+        }
+
+        if(p_shm != NULL)
+        {
+            tps65987_monitor_snapshot(&mon, &snapshot);
+            tps65987_shm_publish(p_shm, &snapshot);
+        }
+
+        fprintf(stderr, "[%8.3f] %s: events 0x%016llx plug %d conn %d role %s data %s power %d %s current %d\n",
+                (event.time_us - start) / 1000000.0, p_dev->name, event.events,
+                tps65987_status_plug_present(mon.status), tps65987_status_conn_state(mon.status),
+                tps65987_status_port_role(mon.status) ? "source" : "sink",
+                tps65987_status_data_role(mon.status) ? "DFP" : "UFP",
+                tps65987_power_status_power_connection(mon.power_status),
+                tps65987_power_status_source_or_sink(mon.power_status) ? "sink" : "source",
+                tps65987_power_status_type_c_current(mon.power_status));
+    }
+
+    fprintf(stderr, "%s: %llu events, %llu INT_EVENT reads, %llu transfers\n",
+            p_dev->name, mon.events, mon.wakeups, p_dev->transport->transfers);
+
+    tps65987_monitor_close(&mon);
+
+    if(p_shm != NULL)
+    {
+        tps65987_shm_close(p_shm);
+        tps65987_shm_unlink(p_dev->i2c_addr);
+    }
+
+    return 0;
+}
+
+
+/*
+* "config <file> [--dry-run]": write the registers of the configuration that
+* differ from the live ones, instead of flashing a whole image for it. Not
+* kept across a reset or GAID, see tps65987_dev_config_apply().
+*/
+static int config_main(s_TPS_dev *p_dev, int argc, char *argv[])
+{
+    s_TPS_config cfg;
+    s_TPS_config_stats stats;
+    unsigned int flags = 0;
+    int ret;
+
+    if(argc < 5 || tps65987_config_load(argv[4], &cfg) != 0)
+    {
+        fprintf(stderr, "%s: no configuration\n", p_dev->name);
+        return -1;
+    }
+
+    if(argc > 5 && strcmp(argv[5], "--dry-run") == 0)
+    {
+        flags |= CONFIG_FLAG_DRY_RUN;
+    }
+
+    ret = tps65987_dev_config_apply(p_dev, &cfg, flags, &stats);
+
+    fprintf(stderr, "%s: config %s%s, %u registers, %u not writable, %u differ (%u bytes), "
+            "%u bytes written, read %lluus, write %lluus, %llu transfers\n",
+            p_dev->name, ret == 0 ? "ok" : "failed", flags & CONFIG_FLAG_DRY_RUN ? " (dry run)" : "",
+            stats.regs, stats.skipped, stats.changed, stats.changed_bytes, stats.written_bytes,
+            stats.read_us, stats.write_us, stats.transfers);
+
+    if(ret == 0 && stats.changed != 0 && !(flags & CONFIG_FLAG_DRY_RUN))
+    {
+        fprintf(stderr, "%s: changed the running configuration only, a reset or GAID restores the one in flash\n",
+                p_dev->name);
+    }
+
+    return ret;
+}
+
+
+/*
+* "<addr> shm": the state "monitor --shm" publishes, without touching the bus
+*/
+static int shm_main(unsigned char i2c_addr)
+{
+    s_TPS_shm_snapshot snapshot;
+    s_TPS_shm *p_shm;
+    unsigned long long start;
+    unsigned long long elapsed;
+    int i;
+
+    p_shm = tps65987_shm_open(i2c_addr);
+    if(p_shm == NULL || tps65987_shm_read(p_shm, &snapshot) != 0)
+    {
+        fprintf(stderr, "no status published for 0x%02x\n", i2c_addr);
+        tps65987_shm_close(p_shm);
+        return -1;
+    }
+
+    start = tps65987_now_us();
+    for(i = 0; i < 100000; i++)
+    {
+        tps65987_shm_read(p_shm, &snapshot);
+    }
+    elapsed = tps65987_now_us() - start;
+
+    fprintf(stderr, "0x%02x: generation %llu, %.3fs old, read in %lluns\n", snapshot.i2c_addr, snapshot.generation,
+            (tps65987_now_us() - snapshot.timestamp_us) / 1000000.0, elapsed * 1000 / 100000);
+    fprintf(stderr, "plug %d conn %d role %s data %s vbus %d\n",
+            tps65987_status_plug_present(snapshot.status), tps65987_status_conn_state(snapshot.status),
+            tps65987_status_port_role(snapshot.status) ? "source" : "sink",
+            tps65987_status_data_role(snapshot.status) ? "DFP" : "UFP", tps65987_status_vbus_status(snapshot.status));
+    fprintf(stderr, "power %d %s current %d\n", tps65987_power_status_power_connection(snapshot.power_status),
+            tps65987_power_status_source_or_sink(snapshot.power_status) ? "sink" : "source",
+            tps65987_power_status_type_c_current(snapshot.power_status));
+    fprintf(stderr, "portconfig type-c state machine %d, bootflags region0 %d region1 %d\n",
+            tps65987_port_configuration_port_configuration(snapshot.portconfig),
+            tps65987_boot_flags_region_0(snapshot.bootflags), tps65987_boot_flags_region_1(snapshot.bootflags));
+    for(i = 0; i < snapshot.num_source_pdos; i++)
+    {
+        fprintf(stderr, "source pdo %d: 0x%08x\n", i, snapshot.source_pdos[i]);
+    }
+
+    tps65987_shm_close(p_shm);
+
+    return 0;
+}
+
+
+/*
+* "<addr> <bus> version|bootflags|status|power|pdos|all[,...]": one combined
+* read of just those registers, one line of JSON on stdout. Runs before
+* anything else in main(): no log file, no trace, no test accesses.
+*/
+static int query_main(char *addr, char *bus_name, unsigned int what)
+{
+    s_TPS_sim_config sim_cfg;
+    s_TPS_sim *p_sim = NULL;
+    s_TPS_transport *p_transport;
+    s_TPS_query query;
+    s_TPS_dev *p_dev;
+    int fd;
+    int ret;
+
+    if(strncmp(bus_name, "sim", 3) == 0)
+    {
+        tps65987_sim_default_config(&sim_cfg);
+        sim_cfg.i2c_addr = strtoul(addr, NULL, 0);
+
+        p_sim = tps65987_sim_create(&sim_cfg);
+        if(p_sim == NULL || (bus_name[3] == ':' && tps65987_sim_load_image_file(p_sim, &bus_name[4]) != 0))
+        {
+            tps65987_sim_destroy(p_sim);
+            return -1;
+        }
+
+        p_transport = tps65987_sim_transport(p_sim);
+    }
+    else
+    {
+        fd = open(bus_name, O_RDWR);
+        if(fd < 0 || (p_transport = tps65987_i2cdev_transport(fd)) == NULL)
+        {
+            fprintf(stderr, "fail to open %s\n", bus_name);
+            if(fd >= 0)
+            {
+                close(fd);
+            }
+            return -1;
+        }
+    }
+
+    p_dev = tps65987_dev_create("query", p_transport, strtoul(addr, NULL, 0));
+
+    ret = p_dev != NULL ? tps65987_query_read(p_dev, what, &query) : -1;
+
+    if(ret == 0)
+    {
+        tps65987_query_print_json(&query, p_dev->i2c_addr, stdout);
+    }
+    else
+    {
+        printf("{\"addr\":\"%s\",\"error\":\"bus\"}\n", addr);
+    }
+
+    tps65987_dev_destroy(p_dev);
+
+    if(p_sim != NULL)
+    {
+        tps65987_sim_destroy(p_sim);
+    }
+    else
+    {
+        p_transport->close(p_transport->priv);
+        free(p_transport);
+    }
+
+    return ret;
+}
+
+
+int main(int argc, char* argv[])
+{
+    //FILE *fp;
+    int i;
+
+    unsigned char buf[64] = {0};
+    unsigned char val[64] = {0};
+    unsigned char customeruse1[64] = {0};
+    unsigned char customeruse[64] ={0};
+
+    unsigned char tps_status[TPS_REG_STATUS_LEN] = {0};
+
+    unsigned int upgrade_flags = 0;
+    unsigned int plug_toggle_ms = 0;
+    int host_patch = 0;
+    char *record_file_name = NULL;
+    char *fault_spec = NULL;
+    s_TPS_fault_config fault_cfg;
+    s_TPS_transport *p_transport;
+    double replay_scale = 1.0;
+    int ret;
+
+    s_TPS_sim_config sim_cfg;
+    s_TPS_sim *p_sim = NULL;
+    unsigned int query_what;
+    memset(val, 0x55, sizeof(val));
+
+    if(argc == 4 && (query_what = tps65987_query_parse(argv[3])) != 0)
+    {
+        return query_main(argv[1], argv[2], query_what) == 0 ? 0 : 1;
+    }
+
+    printf("start run tps65987-ota\n");
+    freopen("/data/tps65987-log.txt", "w", stdout);
+
+    //decode with tools/tps65987_trace_decode.py
+    if(tps65987_trace_start(TRACE_FILE_NAME) == 0)
+    {
+        atexit(tps65987_trace_stop);
+    }
+
+    if(argc > 1)
+    {
+        for(i = 0; i < argc; i++)
+        {
+            printf("Argument %d is %s\n", i, argv[i]);
+        }
+
+        if(strcmp(argv[1],"0x38") == 0)
+        {
+            I2C_ADDR = 0x38;
+        }
+        else if(strcmp(argv[1],"0x20") == 0)
+        {
+            I2C_ADDR = 0x20;
+        }
+    }
+
+    printf("used i2c address is 0x%x\n",I2C_ADDR);
+
+    check_endian();
+
+    for(i = 4; i < argc; i++)
+    {
+        if(strcmp(argv[i],"--delta") == 0)
+        {
+            upgrade_flags |= UPGRADE_FLAG_DELTA;
+        }
+        else if(strcmp(argv[i],"--sparse") == 0)
+        {
+            upgrade_flags |= UPGRADE_FLAG_SPARSE;
+        }
+        else if(strcmp(argv[i],"--staged") == 0)
+        {
+            upgrade_flags |= UPGRADE_FLAG_STAGED;
+        }
+        else if(strcmp(argv[i],"--host-patch") == 0)
+        {
+            host_patch = 1;
+        }
+        else if(strcmp(argv[i],"--deferred") == 0)
+        {
+            upgrade_flags |= UPGRADE_FLAG_DEFERRED;
+        }
+        else if(strcmp(argv[i],"--sim-plug-toggle-ms") == 0 && i + 1 < argc)
+        {
+            plug_toggle_ms = strtoul(argv[++i], NULL, 0);
+        }
+        else if(strcmp(argv[i],"--record") == 0 && i + 1 < argc)
+        {
+            record_file_name = argv[++i];
+        }
+        else if(strcmp(argv[i],"--faults") == 0 && i + 1 < argc)
+        {
+            fault_spec = argv[++i];
+        }
+        else if(strcmp(argv[i],"--replay-scale") == 0 && i + 1 < argc)
+        {
+            replay_scale = strtod(argv[++i], NULL);
+        }
+    }
+
+    if(argc > 2 && strcmp(argv[2],"shm") == 0)
+    {
+        return shm_main(I2C_ADDR);
+    }
+
+    //everything below wants "<addr> <bus> <ota-file|monitor|config>"
+    if(argc < 4)
+    {
+        fprintf(stderr, "usage: %s <addr> <bus>|sim[:<image>]|replay:<file> <ota-file>|monitor|config <file> [options]\n"
+                "       %s <addr> shm\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    /*
+    * several controllers: "<bus>[@addr],<bus>[@addr],..."
+    */
+    if(strchr(argv[2], ',') != NULL)
+    {
+        return multi_upgrade_main(argv[2], argv[3], upgrade_flags);
+    }
+
+    /*
+    * "sim" or "sim:<image>" instead of the i2c device runs against the simulated
+    * controller, with <image> already in both regions
+    */
+    if(strncmp(argv[2],"sim",3) == 0)
+    {
+        tps65987_sim_default_config(&sim_cfg);
+        sim_cfg.i2c_addr = I2C_ADDR;
+        sim_cfg.plug_toggle_us = plug_toggle_ms * 1000;
+
+        p_sim = tps65987_sim_create(&sim_cfg);
+        if(p_sim == NULL)
+        {
+            return -1;
+        }
+
+        if(argv[2][3] == ':' && tps65987_sim_load_image_file(p_sim, &argv[2][4]) != 0)
+        {
+            printf("fail to load sim image %s\n", &argv[2][4]);
+            return -1;
+        }
+
+        tps65987_set_transport(tps65987_sim_transport(p_sim));
+    }
+    /*
+    * "replay:<capture>" answers from a --record capture instead of a bus,
+    * --replay-scale stretches its timing
+    */
+    else if(strncmp(argv[2],"replay:",7) == 0)
+    {
+        tps65987_set_transport(tps65987_replay_transport(&argv[2][7], replay_scale));
+        if(tps65987_get_transport() == NULL)
+        {
+            printf("fail to load capture %s\n", &argv[2][7]);
+            return -1;
+        }
+    }
+    else if(i2c_open_tps65987(I2C_ADDR,argv[2]) != 0)
+    {
+        return -1;
+    }
+    else
+    {
+        set_journal(tps65987_default_dev(), argv[2]);
+    }
+
+    //--faults: a flaky bus, see tps65987_fault.h
+    if(fault_spec != NULL)
+    {
+        tps65987_fault_default_config(&fault_cfg);
+        if(tps65987_fault_parse(fault_spec, &fault_cfg) != 0)
+        {
+            close_bus(p_sim);
+            return -1;
+        }
+
+        p_transport = tps65987_fault_transport(tps65987_get_transport(), &fault_cfg);
+        if(p_transport == NULL)
+        {
+            printf("fail to set up --faults %s\n", fault_spec);
+            close_bus(p_sim);
+            return -1;
+        }
+
+        tps65987_set_transport(p_transport);
+    }
+
+    //--record: everything on the bus from here on goes to a capture for replay:<capture>
+    if(record_file_name != NULL)
+    {
+        p_transport = tps65987_record_transport(tps65987_get_transport(), record_file_name);
+        if(p_transport == NULL)
+        {
+            close_bus(p_sim);
+            return -1;
+        }
+
+        tps65987_set_transport(p_transport);
+    }
+
+    if(strcmp(argv[3],"monitor") == 0)
+    {
+        ret = monitor_main(tps65987_default_dev(), argc, argv);
+        close_bus(p_sim);
+        return ret;
+    }
+
+    if(strcmp(argv[3],"config") == 0)
+    {
+        ret = config_main(tps65987_default_dev(), argc, argv);
+        close_bus(p_sim);
+        return ret == 0 ? 0 : 1;
+    }
+
+    //test read
+    tps65987_i2c_read(I2C_ADDR, 0x00, buf, 4);
+    tps65987_i2c_read(I2C_ADDR, 0x05, buf, 16);
+    tps65987_i2c_read(I2C_ADDR, 0x0f, buf, 4);
+
+    tps65987_i2c_read(I2C_ADDR, 0x06, customeruse1, sizeof(customeruse1));
+    sprintf(customeruse,"%s%02x%s",OTA_FILE_NAME,customeruse1[0],OTA_FILE_NAME1);
+    printf("ota-file is %s\n",argv[3]);
+    printf("local-file is %s\n",customeruse);
+
+    printf("ota-file size is %ld\n",strlen(argv[3]));
+    printf("local-file size is %ld\n",strlen(customeruse));
+
+    printf("result is %d\n", strcmp(argv[3],customeruse));
+    if(strcmp(argv[3],customeruse) <= 0)
+    {
+       printf("version is old,version is %s\n",argv[3]);
+       return -1;
+    }
+    strcpy(customeruse,argv[3]);
+    printf("Have new version,version is %s\n",argv[3]);
+
+    tps65987_set_upgrade_flags(upgrade_flags);
+
+    //test read and write
+    val[0] = 0x04;
+    tps65987_i2c_write(I2C_ADDR, 0x70, &val[0], 1);
+    usleep(10000);
+    tps65987_i2c_read(I2C_ADDR, 0x70, buf, 1);
+
+    //--host-patch: nothing valid in the flash (PTCH mode), run the image from RAM instead
+    if(host_patch)
+    {
+        ret = tps65987_host_patch_bundle(customeruse);
+
+        freopen("/dev/tty","w",stdout);
+        printf("end tps65987-ota, host patch %s\n", ret == 0 ? "running" : ret > 0 ? "not needed" : "failed");
+        close_bus(p_sim);
+        return ret < 0 ? 1 : 0;
+    }
+
+    ret = tps65987_ext_flash_upgrade(customeruse);
+
+    tps65987_latency_dump(&tps65987_default_dev()->latency, stdout);
+
+    tps65987_i2c_read(I2C_ADDR, REG_Version, buf, 4);
+    tps65987_i2c_read(I2C_ADDR, REG_BootFlags, buf, 12);
+
+    //--deferred: the new version already runs, now the redundant region
+    if(ret == 0)
+    {
+        ret = tps65987_copy_region();
+    }
+
+    //buf[0] = 0x01;
+    //tps65987_exec_4CC_Cmd("FLrr", buf, 1, buf_2, 4);
+
+    //buf[0] = 0x00;
+    //tps65987_exec_4CC_Cmd("FLrr", buf, 1, buf_2, 4);
+
+    //ResetPDController();
+
+    tps65987_get_Status(tps_status);
+
+    //runtime monitoring: "<addr> <bus> monitor", see monitor_main()
+    //nonzero: run again, the journal resumes the upgrade or the copy
+    freopen("/dev/tty","w",stdout);
+    printf("end tps65987-ota, upgrade %s\n", ret == 0 ? "done" : "failed");
+    close_bus(p_sim);
+
+    return ret == 0 ? 0 : 1;
+}
+
+
+
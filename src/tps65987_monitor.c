@@ -0,0 +1,371 @@
+/**
+*  @file      tps65987_monitor.c
+*  @brief     tps65987 event driven status monitor
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#include<stdio.h>
+#include<string.h>
+#include<fcntl.h>
+#include<unistd.h>
+#include<poll.h>
+
+#include "tps65987_monitor.h"
+#include "tps65987_latency.h"
+#include "tps65987_xact.h"
+
+
+/*
+* events the monitor unmasks, and which registers they make stale
+*/
+static const struct
+{
+    unsigned char   bit;
+    unsigned int    changed;
+} monitor_events[] =
+{
+    { INT_HARD_RESET,            MONITOR_CHANGED_ALL },
+    { INT_PLUG_EVENT,            MONITOR_CHANGED_STATUS | MONITOR_CHANGED_POWER_STATUS | MONITOR_CHANGED_SOURCE_CAPS },
+    { INT_PR_SWAP_COMPLETE,      MONITOR_CHANGED_STATUS | MONITOR_CHANGED_POWER_STATUS },
+    { INT_DR_SWAP_COMPLETE,      MONITOR_CHANGED_STATUS },
+    { INT_POWER_STATUS_UPDATE,   MONITOR_CHANGED_POWER_STATUS },
+    { INT_NEW_CONTRACT_AS_CONS,  MONITOR_CHANGED_POWER_STATUS },
+    { INT_NEW_CONTRACT_AS_PROV,  MONITOR_CHANGED_POWER_STATUS },
+    { INT_SOURCE_CAP_MSG_RCVD,   MONITOR_CHANGED_SOURCE_CAPS },
+    { INT_STATUS_UPDATE,         MONITOR_CHANGED_STATUS },
+};
+
+#define  MONITOR_NUM_EVENTS     (sizeof(monitor_events) / sizeof(monitor_events[0]))
+
+
+static int event_set(const unsigned char *event, int bit)
+{
+    return (event[bit / 8] >> (bit % 8)) & 1;
+}
+
+
+static int write_file(const char *file_name, const char *val)
+{
+    int fd;
+    int ret;
+
+    fd = open(file_name, O_WRONLY);
+    if(fd < 0)
+    {
+        return -1;
+    }
+
+    ret = write(fd, val, strlen(val));
+    close(fd);
+
+    return ret < 0 ? -1 : 0;
+}
+
+
+/*
+* sysfs gpio, interrupt on the falling edge of the (active low) IRQ line
+*/
+static int open_irq_gpio(int gpio)
+{
+    char file_name[64];
+    char val[16];
+    int fd;
+
+    snprintf(val, sizeof(val), "%d", gpio);
+    write_file("/sys/class/gpio/export", val);     //fails if already exported
+
+    snprintf(file_name, sizeof(file_name), "/sys/class/gpio/gpio%d/direction", gpio);
+    write_file(file_name, "in");
+
+    snprintf(file_name, sizeof(file_name), "/sys/class/gpio/gpio%d/edge", gpio);
+    if(write_file(file_name, "falling") != 0)
+    {
+        printf("fail to set %s\n", file_name);
+        return -1;
+    }
+
+    snprintf(file_name, sizeof(file_name), "/sys/class/gpio/gpio%d/value", gpio);
+    fd = open(file_name, O_RDONLY);
+    if(fd < 0)
+    {
+        printf("fail to open %s\n", file_name);
+    }
+
+    return fd;
+}
+
+
+/*
+* 1 while the IRQ line is asserted; reading also re-arms poll()
+*/
+static int irq_asserted(int fd)
+{
+    char val = '1';
+
+    lseek(fd, 0, SEEK_SET);
+    if(read(fd, &val, 1) != 1)
+    {
+        return 0;
+    }
+
+    return val == '0';
+}
+
+
+/*
+* read INT_EVENT1/2, clear what is set and re-read the registers it affects,
+* all in two transactions; 1 if there was an event
+*/
+static int monitor_service(s_TPS_monitor *p_mon, unsigned int changed, s_TPS_monitor_event *p_event)
+{
+    unsigned char event[2][INT_EVENT_LEN];
+    s_TPS_xact xact;
+    unsigned int i;
+    int port;
+
+    p_mon->wakeups++;
+
+    tps65987_xact_init(&xact, p_mon->dev->transport, p_mon->dev->i2c_addr);
+    tps65987_xact_read(&xact, REG_INT_EVENT1, event[0], INT_EVENT_LEN);
+    tps65987_xact_read(&xact, REG_INT_EVENT2, event[1], INT_EVENT_LEN);
+
+    if(tps65987_xact_run(&xact) != 0)
+    {
+        return -1;
+    }
+
+    p_event->events = 0;
+    p_event->changed = 0;
+    p_event->time_us = tps65987_now_us();
+
+    for(i = 0; i < 8; i++)
+    {
+        p_event->events |= (unsigned long long)(event[0][i] | event[1][i]) << (i * 8);
+    }
+
+    for(i = 0; i < MONITOR_NUM_EVENTS; i++)
+    {
+        if(event_set(event[0], monitor_events[i].bit) || event_set(event[1], monitor_events[i].bit))
+        {
+            changed |= monitor_events[i].changed;
+        }
+    }
+
+    if(p_event->events == 0 && changed == 0)
+    {
+        return 0;
+    }
+
+    //clear first, so a change after the reads below raises a new event
+    tps65987_xact_init(&xact, p_mon->dev->transport, p_mon->dev->i2c_addr);
+
+    for(port = 0; port < 2; port++)
+    {
+        for(i = 0; i < INT_EVENT_LEN; i++)
+        {
+            if(event[port][i] != 0)
+            {
+                tps65987_xact_write(&xact, port ? REG_INT_CLEAR2 : REG_INT_CLEAR1, event[port], INT_EVENT_LEN);
+                break;
+            }
+        }
+    }
+
+    if(changed & MONITOR_CHANGED_STATUS)
+    {
+        tps65987_xact_read(&xact, REG_Status, p_mon->status, sizeof(p_mon->status));
+    }
+
+    if(changed & MONITOR_CHANGED_POWER_STATUS)
+    {
+        tps65987_xact_read(&xact, REG_Power_Status, p_mon->power_status, sizeof(p_mon->power_status));
+    }
+
+    if(changed & MONITOR_CHANGED_SOURCE_CAPS)
+    {
+        //stale from here until they are read again
+        tps65987_source_caps_cache_invalidate(&p_mon->dev->source_caps);
+        tps65987_xact_read(&xact, REG_RX_Source_Capabilities, p_mon->source_caps, sizeof(p_mon->source_caps));
+    }
+
+    if(changed & MONITOR_CHANGED_PORTCONFIG)
+    {
+        tps65987_xact_read(&xact, REG_PORTCONFIG, p_mon->portconfig, sizeof(p_mon->portconfig));
+    }
+
+    if(changed & MONITOR_CHANGED_BOOTFLAGS)
+    {
+        tps65987_xact_read(&xact, REG_BootFlags, p_mon->bootflags, sizeof(p_mon->bootflags));
+    }
+
+    if(tps65987_xact_run(&xact) != 0)
+    {
+        return -1;
+    }
+
+    if(changed & MONITOR_CHANGED_SOURCE_CAPS)
+    {
+        tps65987_source_caps_cache_update(&p_mon->dev->source_caps, p_mon->source_caps);
+    }
+
+    p_event->changed = changed;
+    p_mon->read_us = p_event->time_us;
+    p_mon->events++;
+
+    return 1;
+}
+
+
+int tps65987_monitor_open(s_TPS_monitor *p_mon, s_TPS_dev *p_dev, int irq_gpio, unsigned int poll_us)
+{
+    unsigned char mask[INT_EVENT_LEN] = {0};
+    s_TPS_monitor_event event;
+    s_TPS_xact xact;
+    unsigned int i;
+
+    memset(p_mon, 0, sizeof(*p_mon));
+
+    p_mon->dev = p_dev;
+    p_mon->irq_fd = -1;
+    p_mon->poll_us = poll_us ? poll_us : MONITOR_POLL_US;
+
+    //only the events we handle assert the IRQ line
+    for(i = 0; i < MONITOR_NUM_EVENTS; i++)
+    {
+        mask[monitor_events[i].bit / 8] |= 1 << (monitor_events[i].bit % 8);
+    }
+
+    tps65987_xact_init(&xact, p_dev->transport, p_dev->i2c_addr);
+    tps65987_xact_write(&xact, REG_INT_MASK1, mask, INT_EVENT_LEN);
+    tps65987_xact_write(&xact, REG_INT_MASK2, mask, INT_EVENT_LEN);
+
+    if(tps65987_xact_run(&xact) != 0)
+    {
+        printf("fail to set INT_MASK\n");
+        return -1;
+    }
+
+    if(irq_gpio >= 0)
+    {
+        p_mon->irq_fd = open_irq_gpio(irq_gpio);
+        if(p_mon->irq_fd < 0)
+        {
+            printf("no irq line, polling every %uus\n", p_mon->poll_us);
+        }
+    }
+
+    //start from a known state, whatever is pending is stale
+    if(monitor_service(p_mon, MONITOR_CHANGED_ALL, &event) < 0)
+    {
+        tps65987_monitor_close(p_mon);
+        return -1;
+    }
+
+    p_mon->events = 0;
+
+    atomic_store(&p_dev->source_caps.tracked, 1);
+
+    return 0;
+}
+
+
+/*
+* 1 with the events in p_event, 0 if nothing happened within timeout_ms, -1 on a bus error
+*/
+int tps65987_monitor_wait(s_TPS_monitor *p_mon, unsigned int timeout_ms, s_TPS_monitor_event *p_event)
+{
+    unsigned long long deadline = tps65987_now_us() + timeout_ms * 1000ULL;
+    unsigned long long now;
+    unsigned long long wait_us;
+    struct pollfd pfd;
+    int ret;
+
+    for(;;)
+    {
+        if(p_mon->irq_fd < 0 || irq_asserted(p_mon->irq_fd))
+        {
+            ret = monitor_service(p_mon, 0, p_event);
+            if(ret != 0)
+            {
+                return ret;
+            }
+        }
+
+        now = tps65987_now_us();
+        if(now >= deadline)
+        {
+            return 0;
+        }
+
+        wait_us = deadline - now;
+
+        if(p_mon->irq_fd < 0)
+        {
+            tps65987_sleep_us(wait_us < p_mon->poll_us ? wait_us : p_mon->poll_us);
+            continue;
+        }
+
+        if(wait_us > MONITOR_IRQ_SAFETY_MS * 1000ULL)
+        {
+            wait_us = MONITOR_IRQ_SAFETY_MS * 1000ULL;
+        }
+
+        pfd.fd = p_mon->irq_fd;
+        pfd.events = POLLPRI | POLLERR;
+        pfd.revents = 0;
+
+        //an edge or the safety timeout, either way look at INT_EVENT
+        poll(&pfd, 1, (wait_us + 999) / 1000);
+
+        ret = monitor_service(p_mon, 0, p_event);
+        if(ret != 0)
+        {
+            return ret;
+        }
+    }
+}
+
+
+/*
+* the state as last read, for tps65987_shm_publish()
+*/
+void tps65987_monitor_snapshot(const s_TPS_monitor *p_mon, s_TPS_shm_snapshot *p_snapshot)
+{
+    s_TPS_source_caps caps;
+    unsigned int i;
+
+    memset(p_snapshot, 0, sizeof(*p_snapshot));
+
+    p_snapshot->timestamp_us = p_mon->read_us;
+    p_snapshot->i2c_addr = p_mon->dev->i2c_addr;
+
+    memcpy(p_snapshot->status, p_mon->status, sizeof(p_snapshot->status));
+    memcpy(p_snapshot->power_status, p_mon->power_status, sizeof(p_snapshot->power_status));
+    memcpy(p_snapshot->portconfig, p_mon->portconfig, sizeof(p_snapshot->portconfig));
+    memcpy(p_snapshot->bootflags, p_mon->bootflags, sizeof(p_snapshot->bootflags));
+
+    tps65987_source_caps_decode(p_mon->source_caps, &caps);
+
+    p_snapshot->num_source_pdos = caps.num_pdos < SHM_MAX_PDOS ? caps.num_pdos : SHM_MAX_PDOS;
+
+    for(i = 0; i < p_snapshot->num_source_pdos; i++)
+    {
+        p_snapshot->source_pdos[i] = caps.pdos[i].raw;
+    }
+}
+
+
+void tps65987_monitor_close(s_TPS_monitor *p_mon)
+{
+    //nobody sees the events any more
+    atomic_store(&p_mon->dev->source_caps.tracked, 0);
+    tps65987_source_caps_cache_invalidate(&p_mon->dev->source_caps);
+
+    if(p_mon->irq_fd >= 0)
+    {
+        close(p_mon->irq_fd);
+        p_mon->irq_fd = -1;
+    }
+}
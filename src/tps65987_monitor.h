@@ -0,0 +1,68 @@
+/**
+*  @file      tps65987_monitor.h
+*  @brief     tps65987 event driven status monitor
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#ifndef TPS65987_MONITOR_H
+#define TPS65987_MONITOR_H
+
+#include "tps65987_drv.h"
+#include "tps65987_regmap.h"
+#include "tps65987_shm.h"
+
+#define  MONITOR_POLL_US            5000    //INT_EVENT poll period without an irq line
+#define  MONITOR_IRQ_SAFETY_MS      1000    //with an irq line, look anyway after this long
+
+/*
+* registers re-read because of an event, see s_TPS_monitor_event.changed
+*/
+#define  MONITOR_CHANGED_STATUS         0x01
+#define  MONITOR_CHANGED_POWER_STATUS   0x02
+#define  MONITOR_CHANGED_SOURCE_CAPS    0x04
+#define  MONITOR_CHANGED_PORTCONFIG     0x08
+#define  MONITOR_CHANGED_BOOTFLAGS      0x10
+#define  MONITOR_CHANGED_ALL            0x1F
+
+
+typedef struct
+{
+    unsigned long long  events;         //INT_EVENT1 | INT_EVENT2, bits 0-63
+    unsigned int        changed;        //MONITOR_CHANGED_*
+    unsigned long long  time_us;        //when the events were read
+} s_TPS_monitor_event;
+
+
+/*
+* Waits on the controller's IRQ line (a sysfs gpio, active low) or, without
+* one, polls INT_EVENT1/2. Events are cleared through INT_CLEAR1/2 and only
+* the registers they affect are read again.
+*/
+typedef struct
+{
+    s_TPS_dev           *dev;
+
+    int                 irq_fd;         //gpio value file, -1: poll
+    unsigned int        poll_us;
+
+    //as read, decoded with the tps65987_regmap.h accessors
+    unsigned char       status[TPS_REG_STATUS_LEN];
+    unsigned char       power_status[TPS_REG_POWER_STATUS_LEN];
+    unsigned char       source_caps[SOURCE_CAPS_LEN];      //tps65987_source_caps_decode()
+    unsigned char       portconfig[TPS_REG_PORT_CONFIGURATION_LEN];
+    unsigned char       bootflags[TPS_REG_BOOT_FLAGS_LEN];
+    unsigned long long  read_us;        //when the registers above were last read
+
+    unsigned long long  wakeups;        //INT_EVENT reads
+    unsigned long long  events;         //INT_EVENT reads with something set
+} s_TPS_monitor;
+
+
+int tps65987_monitor_open(s_TPS_monitor *p_mon, s_TPS_dev *p_dev, int irq_gpio, unsigned int poll_us);
+int tps65987_monitor_wait(s_TPS_monitor *p_mon, unsigned int timeout_ms, s_TPS_monitor_event *p_event);
+void tps65987_monitor_snapshot(const s_TPS_monitor *p_mon, s_TPS_shm_snapshot *p_snapshot);
+void tps65987_monitor_close(s_TPS_monitor *p_mon);
+
+#endif
@@ -0,0 +1,205 @@
+/**
+*  @file      tps65987_multi.c
+*  @brief     upgrade several tps65987 controllers in parallel
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#include<stdio.h>
+#include<string.h>
+#include<pthread.h>
+
+#include "tps65987_multi.h"
+#include "tps65987_latency.h"
+
+typedef struct
+{
+    s_TPS_transport     *transport;
+    s_TPS_upgrade_job   *jobs;
+    int                 njobs;
+    pthread_t           thread;
+    int                 started;
+} s_TPS_bus_worker;
+
+
+/*
+* everything on one bus, in the order given
+*/
+static void *bus_worker(void *arg)
+{
+    s_TPS_bus_worker *p_worker = arg;
+    s_TPS_upgrade_job *p_job;
+    unsigned long long start;
+    int i;
+
+    for(i = 0; i < p_worker->njobs; i++)
+    {
+        p_job = &p_worker->jobs[i];
+
+        if(p_job->dev->transport != p_worker->transport)
+        {
+            continue;
+        }
+
+        start = tps65987_now_us();
+
+        tps65987_dev_set_upgrade_flags(p_job->dev, p_job->upgrade_flags);
+        p_job->result = tps65987_dev_flash_upgrade(p_job->dev, p_job->ota_file_name);
+
+        p_job->elapsed_us = tps65987_now_us() - start;
+        atomic_store(&p_job->done, 1);
+    }
+
+    /*
+    * deferred: every controller on the bus runs its new image, now make
+    * the redundant copies
+    */
+    for(i = 0; i < p_worker->njobs; i++)
+    {
+        p_job = &p_worker->jobs[i];
+
+        if(p_job->dev->transport == p_worker->transport && p_job->result == 0 &&
+           tps65987_dev_copy_region(p_job->dev) != 0)
+        {
+            p_job->result = -1;
+        }
+    }
+
+    return NULL;
+}
+
+
+int tps65987_multi_upgrade(s_TPS_upgrade_job *jobs, int njobs, unsigned int report_ms,
+                           tps65987_progress_cb cb, void *arg)
+{
+    s_TPS_bus_worker workers[MULTI_MAX_JOBS];
+    int nworkers = 0;
+    int i, w;
+    int busy;
+    int ret = 0;
+
+    if(njobs > MULTI_MAX_JOBS)
+    {
+        printf("too many controllers %d, max %d\n", njobs, MULTI_MAX_JOBS);
+        return -1;
+    }
+
+    for(i = 0; i < njobs; i++)
+    {
+        jobs[i].result = -1;
+        jobs[i].elapsed_us = 0;
+        atomic_init(&jobs[i].done, 0);
+
+        for(w = 0; w < nworkers; w++)
+        {
+            if(workers[w].transport == jobs[i].dev->transport)
+            {
+                break;
+            }
+        }
+
+        if(w == nworkers)
+        {
+            workers[w].transport = jobs[i].dev->transport;
+            workers[w].jobs = jobs;
+            workers[w].njobs = njobs;
+            workers[w].started = 0;
+            nworkers++;
+        }
+    }
+
+    for(w = 0; w < nworkers; w++)
+    {
+        if(pthread_create(&workers[w].thread, NULL, bus_worker, &workers[w]) == 0)
+        {
+            workers[w].started = 1;
+        }
+        else
+        {
+            printf("fail to start the worker for bus %s\n", workers[w].transport->name);
+
+            //run it from here instead
+            bus_worker(&workers[w]);
+        }
+    }
+
+    do
+    {
+        busy = 0;
+        for(i = 0; i < njobs; i++)
+        {
+            busy += !atomic_load(&jobs[i].done);
+        }
+
+        if(busy && cb != NULL)
+        {
+            cb(jobs, njobs, arg);
+        }
+
+        if(busy)
+        {
+            tps65987_sleep_us(report_ms * 1000);
+        }
+    } while(busy);
+
+    for(w = 0; w < nworkers; w++)
+    {
+        if(workers[w].started)
+        {
+            pthread_join(workers[w].thread, NULL);
+        }
+    }
+
+    if(cb != NULL)
+    {
+        cb(jobs, njobs, arg);
+    }
+
+    for(i = 0; i < njobs; i++)
+    {
+        if(jobs[i].result != 0)
+        {
+            ret = -1;
+        }
+    }
+
+    return ret;
+}
+
+
+void tps65987_multi_print_progress(s_TPS_upgrade_job *jobs, int njobs, void *arg)
+{
+    FILE *out = arg;
+    s_TPS_dev *p_dev;
+    unsigned int progress;
+    unsigned int total;
+    int phase;
+    int i;
+
+    for(i = 0; i < njobs; i++)
+    {
+        p_dev = jobs[i].dev;
+        progress = atomic_load(&p_dev->progress_bytes);
+        total = atomic_load(&p_dev->total_bytes);
+        phase = atomic_load(&p_dev->phase);
+
+        fprintf(out, "%s%s@0x%02x ", i ? " | " : "", p_dev->name, p_dev->i2c_addr);
+
+        if(atomic_load(&jobs[i].done))
+        {
+            fprintf(out, "%s %llums", jobs[i].result == 0 ? "ok" : "FAILED", jobs[i].elapsed_us / 1000);
+        }
+        else if(phase == UPGRADE_PHASE_NUM)
+        {
+            fprintf(out, "queued");
+        }
+        else
+        {
+            fprintf(out, "%s %u%%", tps65987_upgrade_phase_name(phase), total ? progress * 100 / total : 0);
+        }
+    }
+
+    fprintf(out, "\n");
+    fflush(out);
+}
@@ -0,0 +1,51 @@
+/**
+*  @file      tps65987_multi.h
+*  @brief     upgrade several tps65987 controllers in parallel
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#ifndef TPS65987_MULTI_H
+#define TPS65987_MULTI_H
+
+#include<stdio.h>
+
+#include "tps65987_drv.h"
+
+#define  MULTI_MAX_JOBS         16
+#define  MULTI_REPORT_MS        1000
+
+
+/*
+* one controller to upgrade; result and elapsed_us are filled in
+*/
+typedef struct
+{
+    s_TPS_dev           *dev;
+    char                *ota_file_name;
+    unsigned int        upgrade_flags;
+
+    int                 result;
+    unsigned long long  elapsed_us;
+    atomic_int          done;
+} s_TPS_upgrade_job;
+
+
+typedef void (*tps65987_progress_cb)(s_TPS_upgrade_job *jobs, int njobs, void *arg);
+
+/*
+* Upgrade every job, one worker thread per bus (transport): controllers on
+* different buses run in parallel, controllers sharing a bus one after the
+* other. With UPGRADE_FLAG_DEFERRED a worker makes the redundant copies once
+* every controller on its bus runs the new image; 'done' and elapsed_us
+* don't include them. 'cb' is called every report_ms and once at the end
+* from the calling thread. Returns 0 if every job succeeded.
+*/
+int tps65987_multi_upgrade(s_TPS_upgrade_job *jobs, int njobs, unsigned int report_ms,
+                           tps65987_progress_cb cb, void *arg);
+
+//tps65987_progress_cb printing the state of every controller as one line to (FILE *)arg
+void tps65987_multi_print_progress(s_TPS_upgrade_job *jobs, int njobs, void *arg);
+
+#endif
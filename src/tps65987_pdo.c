@@ -0,0 +1,153 @@
+/**
+*  @file      tps65987_pdo.c
+*  @brief     tps65987 PD power data objects, decoded
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#include<string.h>
+#include<sched.h>
+
+#include "tps65987_pdo.h"
+
+
+/*
+* bits 31:30 supply type; augmented PDOs are PPS if bits 29:28 are 0
+*/
+void tps65987_pdo_decode(unsigned int raw, s_TPS_pdo *p_pdo)
+{
+    memset(p_pdo, 0, sizeof(*p_pdo));
+
+    p_pdo->raw = raw;
+
+    switch(raw >> 30)
+    {
+        case 0:
+            p_pdo->type = PDO_FIXED;
+            p_pdo->flags = (raw >> 24) & 0x3F;
+            p_pdo->max_ma = (raw & 0x3FF) * PDO_CURRENT_UNIT_MA;
+            p_pdo->max_mv = ((raw >> 10) & 0x3FF) * PDO_VOLTAGE_UNIT_MV;
+            p_pdo->min_mv = p_pdo->max_mv;
+            break;
+
+        case 1:
+            p_pdo->type = PDO_BATTERY;
+            p_pdo->max_mw = (raw & 0x3FF) * PDO_POWER_UNIT_MW;
+            p_pdo->min_mv = ((raw >> 10) & 0x3FF) * PDO_VOLTAGE_UNIT_MV;
+            p_pdo->max_mv = ((raw >> 20) & 0x3FF) * PDO_VOLTAGE_UNIT_MV;
+            return;
+
+        case 2:
+            p_pdo->type = PDO_VARIABLE;
+            p_pdo->max_ma = (raw & 0x3FF) * PDO_CURRENT_UNIT_MA;
+            p_pdo->min_mv = ((raw >> 10) & 0x3FF) * PDO_VOLTAGE_UNIT_MV;
+            p_pdo->max_mv = ((raw >> 20) & 0x3FF) * PDO_VOLTAGE_UNIT_MV;
+            break;
+
+        default:
+            if(((raw >> 28) & 0x03) != 0)
+            {
+                p_pdo->type = PDO_UNKNOWN;
+                return;
+            }
+
+            p_pdo->type = PDO_PPS;
+            p_pdo->flags = (raw >> 27) & 0x01;
+            p_pdo->max_ma = (raw & 0x7F) * PDO_PPS_CURRENT_UNIT_MA;
+            p_pdo->min_mv = ((raw >> 8) & 0xFF) * PDO_PPS_VOLTAGE_UNIT_MV;
+            p_pdo->max_mv = ((raw >> 17) & 0xFF) * PDO_PPS_VOLTAGE_UNIT_MV;
+            break;
+    }
+
+    p_pdo->max_mw = (unsigned int)p_pdo->max_mv * p_pdo->max_ma / 1000;
+}
+
+
+/*
+* 'buf' is RX_Source_Capabilities without its byte count, SOURCE_CAPS_LEN bytes
+*/
+void tps65987_source_caps_decode(const unsigned char *buf, s_TPS_source_caps *p_caps)
+{
+    const unsigned char *pdo;
+    unsigned int i;
+
+    p_caps->num_pdos = buf[0] & 0x07;
+
+    for(i = 0; i < p_caps->num_pdos; i++)
+    {
+        pdo = &buf[1 + i * 4];
+        tps65987_pdo_decode(pdo[0] | (pdo[1] << 8) | (pdo[2] << 16) | ((unsigned int)pdo[3] << 24), &p_caps->pdos[i]);
+    }
+}
+
+
+const char *tps65987_pdo_type_name(unsigned char type)
+{
+    static const char *names[] = { "fixed", "battery", "variable", "pps", "unknown" };
+
+    return type < PDO_UNKNOWN ? names[type] : names[PDO_UNKNOWN];
+}
+
+
+/*
+* single writer, like tps65987_shm_publish()
+*/
+void tps65987_source_caps_cache_update(s_TPS_source_caps_cache *p_cache, const unsigned char *buf)
+{
+    unsigned int seq = atomic_load_explicit(&p_cache->seq, memory_order_relaxed);
+
+    atomic_store_explicit(&p_cache->seq, seq | 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    tps65987_source_caps_decode(buf, &p_cache->caps);
+
+    atomic_store_explicit(&p_cache->seq, (seq | 1) + 1, memory_order_release);
+    atomic_store_explicit(&p_cache->valid, 1, memory_order_release);
+}
+
+
+void tps65987_source_caps_cache_invalidate(s_TPS_source_caps_cache *p_cache)
+{
+    atomic_store_explicit(&p_cache->valid, 0, memory_order_release);
+}
+
+
+/*
+* 0 with a consistent copy, -1 if the cache isn't valid
+*/
+int tps65987_source_caps_cache_read(s_TPS_source_caps_cache *p_cache, s_TPS_source_caps *p_caps)
+{
+    unsigned int seq0;
+    unsigned int seq1;
+    int spins = 0;
+
+    for(;;)
+    {
+        if(!atomic_load_explicit(&p_cache->valid, memory_order_acquire))
+        {
+            return -1;
+        }
+
+        seq0 = atomic_load_explicit(&p_cache->seq, memory_order_acquire);
+
+        if(!(seq0 & 1))
+        {
+            memcpy(p_caps, &p_cache->caps, sizeof(*p_caps));
+
+            atomic_thread_fence(memory_order_acquire);
+            seq1 = atomic_load_explicit(&p_cache->seq, memory_order_relaxed);
+
+            if(seq0 == seq1)
+            {
+                return 0;
+            }
+        }
+
+        //the writer was preempted mid-update
+        if(++spins % 64 == 0)
+        {
+            sched_yield();
+        }
+    }
+}
@@ -0,0 +1,89 @@
+/**
+*  @file      tps65987_pdo.h
+*  @brief     tps65987 PD power data objects, decoded
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#ifndef TPS65987_PDO_H
+#define TPS65987_PDO_H
+
+#include<stdatomic.h>
+
+/*
+* scaling of the PDO fields, as cPDOVoltageField / cPDOCurrentField /
+* cPDOPowerField in the .pjt; APDOs (PPS) have their own
+*/
+#define  PDO_VOLTAGE_UNIT_MV        50
+#define  PDO_CURRENT_UNIT_MA        10
+#define  PDO_POWER_UNIT_MW          250
+#define  PDO_PPS_VOLTAGE_UNIT_MV    100
+#define  PDO_PPS_CURRENT_UNIT_MA    50
+
+//RX_Source_Capabilities (0x30): byte 0 bits 2:0 number of PDOs, then the PDOs
+#define  PDO_MAX                    7
+#define  SOURCE_CAPS_LEN            29
+
+enum PDO_TYPE
+{
+    PDO_FIXED,
+    PDO_BATTERY,
+    PDO_VARIABLE,
+    PDO_PPS,
+    PDO_UNKNOWN,        //augmented, but not PPS
+};
+
+/*
+* fixed supply PDO bits 29:24
+*/
+#define  PDO_FLAG_UNCHUNKED_EXT     0x01
+#define  PDO_FLAG_DUAL_ROLE_DATA    0x02
+#define  PDO_FLAG_USB_COMM          0x04
+#define  PDO_FLAG_UNCONSTRAINED     0x08
+#define  PDO_FLAG_USB_SUSPEND       0x10
+#define  PDO_FLAG_DUAL_ROLE_POWER   0x20
+
+
+typedef struct
+{
+    unsigned int    raw;
+    unsigned char   type;           //enum PDO_TYPE
+    unsigned char   flags;          //fixed: PDO_FLAG_*, PPS: 1 if power limited
+    unsigned short  min_mv;         //fixed: same as max_mv
+    unsigned short  max_mv;
+    unsigned short  max_ma;         //battery: 0
+    unsigned int    max_mw;         //battery: as advertised, the others max_mv * max_ma
+} s_TPS_pdo;
+
+
+typedef struct
+{
+    unsigned int    num_pdos;
+    s_TPS_pdo       pdos[PDO_MAX];
+} s_TPS_source_caps;
+
+
+/*
+* The last source caps of a controller, decoded. Kept by whoever sees the
+* events that change them (the status monitor) and read from any thread
+* without touching the bus; see tps65987_dev_get_source_caps().
+*/
+typedef struct
+{
+    atomic_uint         seq;        //seqlock, odd while updated
+    atomic_int          valid;
+    atomic_int          tracked;    //somebody invalidates it on events
+    s_TPS_source_caps   caps;
+} s_TPS_source_caps_cache;
+
+
+void tps65987_pdo_decode(unsigned int raw, s_TPS_pdo *p_pdo);
+void tps65987_source_caps_decode(const unsigned char *buf, s_TPS_source_caps *p_caps);
+const char *tps65987_pdo_type_name(unsigned char type);
+
+void tps65987_source_caps_cache_update(s_TPS_source_caps_cache *p_cache, const unsigned char *buf);
+void tps65987_source_caps_cache_invalidate(s_TPS_source_caps_cache *p_cache);
+int tps65987_source_caps_cache_read(s_TPS_source_caps_cache *p_cache, s_TPS_source_caps *p_caps);
+
+#endif
@@ -0,0 +1,187 @@
+/**
+*  @file      tps65987_query.c
+*  @brief     tps65987 batched status query with JSON output
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#include<stdio.h>
+#include<string.h>
+
+#include "tps65987_query.h"
+#include "tps65987_latency.h"
+#include "tps65987_xact.h"
+
+
+static const struct
+{
+    const char      *name;
+    unsigned int    what;
+} query_names[] =
+{
+    { "version",    QUERY_VERSION },
+    { "bootflags",  QUERY_BOOTFLAGS },
+    { "status",     QUERY_STATUS },
+    { "power",      QUERY_POWER },
+    { "pdos",       QUERY_PDOS },
+    { "all",        QUERY_ALL },
+};
+
+#define  QUERY_NUM_NAMES    (sizeof(query_names) / sizeof(query_names[0]))
+
+
+unsigned int tps65987_query_parse(const char *spec)
+{
+    unsigned int what = 0;
+    unsigned int i;
+    size_t len;
+
+    while(*spec != 0)
+    {
+        len = strcspn(spec, ",");
+
+        for(i = 0; i < QUERY_NUM_NAMES; i++)
+        {
+            if(strlen(query_names[i].name) == len && strncmp(spec, query_names[i].name, len) == 0)
+            {
+                break;
+            }
+        }
+
+        if(i == QUERY_NUM_NAMES)
+        {
+            return 0;
+        }
+
+        what |= query_names[i].what;
+
+        spec += len;
+        if(*spec == ',')
+        {
+            spec++;
+        }
+    }
+
+    return what;
+}
+
+
+int tps65987_query_read(s_TPS_dev *p_dev, unsigned int what, s_TPS_query *p_query)
+{
+    unsigned char version[4] = {0};
+    unsigned long long start;
+    s_TPS_xact xact;
+
+    memset(p_query, 0, sizeof(*p_query));
+    p_query->what = what;
+
+    tps65987_xact_init(&xact, p_dev->transport, p_dev->i2c_addr);
+
+    if(what & QUERY_VERSION)
+    {
+        tps65987_xact_read(&xact, REG_MODE, p_query->mode, 4);
+        tps65987_xact_read(&xact, REG_Version, version, 4);
+    }
+
+    if(what & QUERY_BOOTFLAGS)
+    {
+        tps65987_xact_read(&xact, REG_BootFlags, p_query->bootflags, 4);
+    }
+
+    if(what & QUERY_STATUS)
+    {
+        tps65987_xact_read(&xact, REG_Status, p_query->status, 4);
+    }
+
+    if(what & QUERY_POWER)
+    {
+        tps65987_xact_read(&xact, REG_Power_Status, p_query->power_status, 2);
+    }
+
+    if(what & QUERY_PDOS)
+    {
+        tps65987_xact_read(&xact, REG_RX_Source_Capabilities, p_query->source_caps, sizeof(p_query->source_caps));
+    }
+
+    start = tps65987_now_us();
+
+    if(tps65987_xact_run(&xact) != 0)
+    {
+        return -1;
+    }
+
+    p_query->read_us = tps65987_now_us() - start;
+    p_query->version = version[0] | (version[1] << 8) | (version[2] << 16) | ((unsigned int)version[3] << 24);
+
+    return 0;
+}
+
+
+void tps65987_query_print_json(const s_TPS_query *p_query, unsigned char i2c_addr, FILE *out)
+{
+    const unsigned char *p_bootflags = p_query->bootflags;
+    const unsigned char *p_status = p_query->status;
+    const unsigned char *p_power = p_query->power_status;
+    const s_TPS_pdo *p_pdo;
+    s_TPS_source_caps caps;
+    int i;
+
+    fprintf(out, "{\"addr\":\"0x%02x\"", i2c_addr);
+
+    if(p_query->what & QUERY_VERSION)
+    {
+        fprintf(out, ",\"mode\":\"");
+        for(i = 0; i < 4; i++)
+        {
+            //MODE is ASCII, but don't trust it in JSON
+            fputc(p_query->mode[i] >= 0x20 && p_query->mode[i] < 0x7F && p_query->mode[i] != '"' &&
+                  p_query->mode[i] != '\\' ? p_query->mode[i] : '?', out);
+        }
+        fprintf(out, "\",\"version\":\"0x%08x\"", p_query->version);
+    }
+
+    if(p_query->what & QUERY_BOOTFLAGS)
+    {
+        fprintf(out, ",\"bootflags\":{\"raw\":\"0x%08x\",\"patch_header_err\":%d,\"spi_flash\":%d,"
+                "\"region0\":%d,\"region1\":%d,\"region0_invalid\":%d,\"region1_invalid\":%d,"
+                "\"region0_crc_fail\":%d,\"region1_crc_fail\":%d}",
+                tps65987_field_get(p_bootflags, 0, 32), tps65987_boot_flags_patch_header_error(p_bootflags),
+                tps65987_boot_flags_spi_flash_present(p_bootflags), tps65987_boot_flags_region_0(p_bootflags),
+                tps65987_boot_flags_region_1(p_bootflags), tps65987_boot_flags_region_0_invalid(p_bootflags),
+                tps65987_boot_flags_region_1_invalid(p_bootflags), tps65987_boot_flags_region_0_crc_fail(p_bootflags),
+                tps65987_boot_flags_region_1_crc_fail(p_bootflags));
+    }
+
+    if(p_query->what & QUERY_STATUS)
+    {
+        fprintf(out, ",\"status\":{\"plug\":%d,\"conn\":%d,\"orientation\":%d,\"role\":\"%s\",\"data\":\"%s\",\"vbus\":%d}",
+                tps65987_status_plug_present(p_status), tps65987_status_conn_state(p_status),
+                tps65987_status_plug_orientation(p_status), tps65987_status_port_role(p_status) ? "source" : "sink",
+                tps65987_status_data_role(p_status) ? "DFP" : "UFP", tps65987_status_vbus_status(p_status));
+    }
+
+    if(p_query->what & QUERY_POWER)
+    {
+        fprintf(out, ",\"power\":{\"connection\":%d,\"role\":\"%s\",\"typec_current\":%d,\"charger_detect\":%d}",
+                tps65987_power_status_power_connection(p_power), tps65987_power_status_source_or_sink(p_power) ? "sink" : "source",
+                tps65987_power_status_type_c_current(p_power), tps65987_power_status_charger_detect_status(p_power));
+    }
+
+    if(p_query->what & QUERY_PDOS)
+    {
+        tps65987_source_caps_decode(p_query->source_caps, &caps);
+
+        fprintf(out, ",\"pdos\":[");
+        for(i = 0; i < (int)caps.num_pdos; i++)
+        {
+            p_pdo = &caps.pdos[i];
+            fprintf(out, "%s{\"type\":\"%s\",\"min_mv\":%u,\"max_mv\":%u,\"max_ma\":%u,\"max_mw\":%u,\"raw\":\"0x%08x\"}",
+                    i ? "," : "", tps65987_pdo_type_name(p_pdo->type), p_pdo->min_mv, p_pdo->max_mv, p_pdo->max_ma,
+                    p_pdo->max_mw, p_pdo->raw);
+        }
+        fprintf(out, "]");
+    }
+
+    fprintf(out, ",\"read_us\":%llu}\n", p_query->read_us);
+}
@@ -0,0 +1,54 @@
+/**
+*  @file      tps65987_query.h
+*  @brief     tps65987 batched status query with JSON output
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#ifndef TPS65987_QUERY_H
+#define TPS65987_QUERY_H
+
+#include<stdio.h>
+
+#include "tps65987_drv.h"
+#include "tps65987_regmap.h"
+
+/*
+* what to read, see tps65987_query_parse()
+*/
+#define  QUERY_VERSION          0x01    //MODE, Version
+#define  QUERY_BOOTFLAGS        0x02
+#define  QUERY_STATUS           0x04
+#define  QUERY_POWER            0x08
+#define  QUERY_PDOS             0x10    //RX Source Capabilities
+#define  QUERY_ALL              0x1F
+
+
+typedef struct
+{
+    unsigned int        what;           //QUERY_*
+
+    unsigned char       mode[4];
+    unsigned int        version;
+    unsigned char       bootflags[TPS_REG_BOOT_FLAGS_LEN];
+    unsigned char       status[TPS_REG_STATUS_LEN];
+    unsigned char       power_status[TPS_REG_POWER_STATUS_LEN];
+    unsigned char       source_caps[SOURCE_CAPS_LEN];
+
+    unsigned long long  read_us;        //the one transaction
+} s_TPS_query;
+
+
+/*
+* "version,status,..." or "all"; 0 if something isn't a query
+*/
+unsigned int tps65987_query_parse(const char *spec);
+
+/*
+* everything in 'what' with one combined bus transaction
+*/
+int tps65987_query_read(s_TPS_dev *p_dev, unsigned int what, s_TPS_query *p_query);
+void tps65987_query_print_json(const s_TPS_query *p_query, unsigned char i2c_addr, FILE *out);
+
+#endif
@@ -0,0 +1,123 @@
+/**
+*  @file      tps65987_regmap.c
+*  @brief     tps65987 register map, generated from TPS65987-DDH-02.pjt
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+//DO NOT EDIT: tools/tps65987_mkregmap.py TPS65987-DDH-02.pjt
+
+#include<stddef.h>
+
+#include "tps65987_regmap.h"
+
+
+const s_TPS_regdesc tps65987_regmap[TPS_REGMAP_NUM] =
+{
+    { "VID",                                   0x00,   4, TPS_REG_READ,                                       1 },
+    { "DID",                                   0x01,   4, TPS_REG_READ,                                       1 },
+    { "Mode",                                  0x03,   4, TPS_REG_READ | TPS_REG_DEVICE,                      1 },
+    { "UID",                                   0x05,  16, TPS_REG_READ | TPS_REG_DEVICE,                      1 },
+    { "Customer Use",                          0x06,   8, TPS_REG_READ,                                       2 },
+    { "Command Register for CMD1",             0x08,   4, TPS_REG_READ | TPS_REG_WRITE | TPS_REG_DEVICE,      1 },
+    { "Data Register for CMD1",                0x09,  64, TPS_REG_READ | TPS_REG_WRITE | TPS_REG_DEVICE,     16 },
+    { "Version",                               0x0F,   4, TPS_REG_READ | TPS_REG_DEVICE,                      1 },
+    { "Command Register for CMD2",             0x10,   4, TPS_REG_READ | TPS_REG_WRITE | TPS_REG_DEVICE,      1 },
+    { "Data Register for CMD2",                0x11,  64, TPS_REG_READ | TPS_REG_WRITE | TPS_REG_DEVICE,     16 },
+    { "Extended Data 2",                       0x12,  64, TPS_REG_READ | TPS_REG_WRITE | TPS_REG_DEVICE,      1 },
+    { "Extended Data 1",                       0x13,  64, TPS_REG_READ | TPS_REG_WRITE | TPS_REG_DEVICE,      1 },
+    { "Interrupt Event for I2C1",              0x14,  11, TPS_REG_READ | TPS_REG_DEVICE,                     69 },
+    { "Interrupt Event for I2C2",              0x15,  11, TPS_REG_READ | TPS_REG_DEVICE,                     69 },
+    { "Interrupt Mask for I2C1",               0x16,  11, TPS_REG_READ | TPS_REG_WRITE,                      69 },
+    { "Interrupt Mask for I2C2",               0x17,  11, TPS_REG_READ | TPS_REG_WRITE,                      69 },
+    { "Interrupt Clear for I2C1",              0x18,  11, TPS_REG_READ | TPS_REG_WRITE | TPS_REG_DEVICE,     69 },
+    { "Interrupt Clear for I2C2",              0x19,  11, TPS_REG_READ | TPS_REG_WRITE | TPS_REG_DEVICE,     69 },
+    { "Status",                                0x1A,   6, TPS_REG_READ | TPS_REG_DEVICE,                     14 },
+    { "Data Register for CMD3",                0x1F,   4, TPS_REG_READ | TPS_REG_WRITE | TPS_REG_DEVICE,      1 },
+    { "System Power State",                    0x20,   1, TPS_REG_READ | TPS_REG_WRITE,                       0 },
+    { "Wake Mask",                             0x22,   8, TPS_REG_READ | TPS_REG_WRITE | TPS_REG_DEVICE,     12 },
+    { "Power Path Status",                     0x26,   6, TPS_REG_READ | TPS_REG_DEVICE,                      1 },
+    { "Global System Configuration",           0x27,  14, TPS_REG_READ | TPS_REG_WRITE,                      30 },
+    { "Port Configuration",                    0x28,   7, TPS_REG_READ | TPS_REG_WRITE,                      15 },
+    { "Port Control",                          0x29,   4, TPS_REG_READ | TPS_REG_WRITE,                      22 },
+    { "Miscellaneous Configuration",           0x2B,   2, TPS_REG_READ | TPS_REG_WRITE,                       4 },
+    { "Boot Flags",                            0x2D,  12, TPS_REG_READ | TPS_REG_DEVICE,                     26 },
+    { "Build Identifier",                      0x2E,  49, TPS_REG_READ | TPS_REG_DEVICE,                      1 },
+    { "Device Info",                           0x2F,  47, TPS_REG_READ | TPS_REG_DEVICE,                      1 },
+    { "Received Source Capabilities",          0x30,  29, TPS_REG_READ | TPS_REG_DEVICE,                      1 },
+    { "Received Sink Capabilities",            0x31,  57, TPS_REG_READ | TPS_REG_DEVICE,                      1 },
+    { "Transmit Source Capabilities",          0x32,  64, TPS_REG_READ | TPS_REG_WRITE,                       5 },
+    { "Transmit Sink Capabilities",            0x33,  57, TPS_REG_READ | TPS_REG_WRITE,                       1 },
+    { "Active Contract PDO",                   0x34,   4, TPS_REG_READ | TPS_REG_DEVICE,                      0 },
+    { "Active Contract RDO",                   0x35,   4, TPS_REG_READ | TPS_REG_DEVICE,                      5 },
+    { "Sink Request RDO",                      0x36,   4, TPS_REG_READ | TPS_REG_DEVICE,                      5 },
+    { "Autonegotiate Sink",                    0x37,  12, TPS_REG_READ | TPS_REG_WRITE,                       8 },
+    { "Alternate Mode Entry Queue",            0x38,  12, TPS_REG_READ | TPS_REG_WRITE,                       0 },
+    { "Power Status",                          0x3F,   2, TPS_REG_READ | TPS_REG_DEVICE,                      5 },
+    { "PD Status",                             0x40,   4, TPS_REG_READ | TPS_REG_DEVICE,                      6 },
+    { "PD3.0 Status",                          0x41,   4, TPS_REG_READ | TPS_REG_DEVICE,                     10 },
+    { "PD3 Configuration Register",            0x42,   4, TPS_REG_READ | TPS_REG_WRITE,                      14 },
+    { "Event Delay",                           0x43,   9, TPS_REG_READ | TPS_REG_WRITE,                       0 },
+    { "Transmit Identity Data Object",         0x47,  49, TPS_REG_READ | TPS_REG_WRITE,                       1 },
+    { "RX Identity SOP",                       0x48,  25, TPS_REG_READ | TPS_REG_DEVICE,                      2 },
+    { "Received SOP Prime Identity Data Object", 0x49,  25, TPS_REG_READ | TPS_REG_DEVICE,                      1 },
+    { "User Alternate Mode Config",            0x4A,  64, TPS_REG_READ | TPS_REG_WRITE,                       5 },
+    { "MIPI VID Configuration",                0x4B,   4, TPS_REG_READ | TPS_REG_WRITE,                       3 },
+    { "RX Attention structured VDM",           0x4E,  29, TPS_REG_READ | TPS_REG_DEVICE,                      2 },
+    { "RX VDM Register",                       0x4F,  29, TPS_REG_READ | TPS_REG_DEVICE,                      3 },
+    { "Data Control Register",                 0x50,   6, TPS_REG_READ | TPS_REG_WRITE | TPS_REG_DEVICE,     23 },
+    { "Display Port Capabilities",             0x51,   7, TPS_REG_READ | TPS_REG_WRITE,                      14 },
+    { "Intel VID Config Register",             0x52,   8, TPS_REG_READ | TPS_REG_WRITE,                      10 },
+    { "Texas Instruments VID Config",          0x54,   8, TPS_REG_READ | TPS_REG_WRITE,                       3 },
+    { "Miscellaneous Control",                 0x55,   1, TPS_REG_READ | TPS_REG_WRITE,                       4 },
+    { "User VID Status Register",              0x57,   2, TPS_REG_READ | TPS_REG_DEVICE,                      7 },
+    { "DP SID Status",                         0x58,  33, TPS_REG_READ | TPS_REG_DEVICE,                      3 },
+    { "Intel VID Status",                      0x59,  11, TPS_REG_READ | TPS_REG_DEVICE,                      4 },
+    { "TI VID Status Register",                0x5B,   1, TPS_REG_READ | TPS_REG_DEVICE,                      3 },
+    { "I/O Config",                            0x5C,  64, TPS_REG_READ,                                       0 },
+    { "Retimer Debug Register",                0x5D,   4, TPS_REG_READ | TPS_REG_WRITE,                      13 },
+    { "Miscellaneous Configuration",           0x5E,  64, TPS_REG_READ | TPS_REG_WRITE,                       7 },
+    { "Data Status",                           0x5F,   5, TPS_REG_READ | TPS_REG_DEVICE,                     28 },
+    { "RX User VID Attention VDM Register",    0x60,  29, TPS_REG_READ | TPS_REG_DEVICE,                      2 },
+    { "RX User VID Other VDM Register",        0x61,  29, TPS_REG_READ | TPS_REG_DEVICE,                      2 },
+    { "App Config Binary Data Indices",        0x62,  10, TPS_REG_READ,                                      10 },
+    { "MIPI VID Status",                       0x63,   1, TPS_REG_READ | TPS_REG_DEVICE,                      3 },
+    { "I2C Master Configuration",              0x64,  20, TPS_REG_READ,                                       0 },
+    { "Type C State Register",                 0x69,   4, TPS_REG_READ | TPS_REG_DEVICE,                      4 },
+    { "ADC results Register",                  0x6A,  10, TPS_REG_READ | TPS_REG_DEVICE,                      5 },
+    { "HW control Register",                   0x6B,  12, TPS_REG_READ | TPS_REG_WRITE | TPS_REG_DEVICE,      8 },
+    { "App configuration Register",            0x6C,  60, TPS_REG_READ | TPS_REG_WRITE,                       0 },
+    { "Sleep Control Register",                0x70,   1, TPS_REG_READ | TPS_REG_WRITE,                       5 },
+    { "Received Manufacturer Info Data Block SOP", 0x71,  26, TPS_REG_READ | TPS_REG_DEVICE,                      3 },
+    { "GPIO Status Register",                  0x72,   8, TPS_REG_READ | TPS_REG_DEVICE,                      0 },
+    { "Tx Manufacturer Info SOP",              0x73,  26, TPS_REG_READ | TPS_REG_WRITE,                       3 },
+    { "Received Alert Data Object (ADO) Register", 0x74,   4, TPS_REG_READ | TPS_REG_DEVICE,                      3 },
+    { "Transmit Alert Data Object (ADO) Register", 0x75,   4, TPS_REG_READ | TPS_REG_WRITE | TPS_REG_DEVICE,      3 },
+    { "Received Source Capabilities Extended Data Block (SCEDB) Register", 0x76,  24, TPS_REG_READ | TPS_REG_DEVICE,                     15 },
+    { "Tx Source Capabilities Extended Data Block", 0x77,  24, TPS_REG_READ | TPS_REG_WRITE,                      20 },
+    { "Received Status Data Block (SDB) Register", 0x78,   5, TPS_REG_READ | TPS_REG_DEVICE,                      5 },
+    { "Transmitted Status Data Block (SDB) Register", 0x79,   5, TPS_REG_READ | TPS_REG_WRITE | TPS_REG_DEVICE,      5 },
+    { "Received Battery Status Data Objects (BSDO) Register", 0x7A,  32, TPS_REG_READ | TPS_REG_DEVICE,                      9 },
+    { "Transmitted Battery Status Data Objects (BSDO) Register", 0x7B,  32, TPS_REG_READ | TPS_REG_WRITE | TPS_REG_DEVICE,      9 },
+    { "Received Battery Capability Data Block (BCDB) Register", 0x7C,   9, TPS_REG_READ | TPS_REG_DEVICE,                      5 },
+    { "Tx Battery Capabilities",               0x7D,  63, TPS_REG_READ | TPS_REG_WRITE,                       0 },
+    { "Received Manufacturer Info Data Block SOPp (MIDB) Register", 0x7E,  26, TPS_REG_READ | TPS_REG_DEVICE,                      3 },
+    { "Tx Manufacturer Info SOP Prime",        0x7F,  26, TPS_REG_READ | TPS_REG_WRITE,                       3 },
+};
+
+
+const s_TPS_regdesc *tps65987_regmap_find(unsigned char addr)
+{
+    unsigned int i;
+
+    for(i = 0; i < TPS_REGMAP_NUM; i++)
+    {
+        if(tps65987_regmap[i].addr == addr)
+        {
+            return &tps65987_regmap[i];
+        }
+    }
+
+    return NULL;
+}
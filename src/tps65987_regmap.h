@@ -0,0 +1,2964 @@
+/**
+*  @file      tps65987_regmap.h
+*  @brief     tps65987 register map, generated from TPS65987-DDH-02.pjt
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+/*
+* DO NOT EDIT: tools/tps65987_mkregmap.py TPS65987-DDH-02.pjt
+*
+* Fields are read from the little-endian register buffer with shifts and
+* masks, so unlike the bitfield structs in tps65987_drv.h they don't depend
+* on the host byte order or the compiler's bitfield layout. With constant
+* offsets every accessor folds into a load, a shift and a mask.
+*/
+
+#ifndef TPS65987_REGMAP_H
+#define TPS65987_REGMAP_H
+
+#define  TPS_REG_READ            0x01
+#define  TPS_REG_WRITE           0x02
+#define  TPS_REG_DEVICE          0x04    //D*: one per controller, not per port
+
+#define  TPS_REGMAP_NUM          89
+
+
+typedef struct
+{
+    const char      *name;
+    unsigned char   addr;
+    unsigned char   len;            //bytes, without the byte count
+    unsigned char   perm;           //TPS_REG_*
+    unsigned char   num_fields;
+} s_TPS_regdesc;
+
+extern const s_TPS_regdesc tps65987_regmap[TPS_REGMAP_NUM];
+
+const s_TPS_regdesc *tps65987_regmap_find(unsigned char addr);
+
+
+static inline unsigned int tps65987_field_get(const unsigned char *buf, unsigned int offset, unsigned int bits)
+{
+    unsigned long long v = 0;
+    unsigned int i;
+
+    for(i = offset / 8; i <= (offset + bits - 1) / 8; i++)
+    {
+        v |= (unsigned long long)buf[i] << (8 * (i - offset / 8));
+    }
+
+    return (unsigned int)((v >> (offset % 8)) & ((1ULL << bits) - 1));
+}
+
+
+static inline void tps65987_field_set(unsigned char *buf, unsigned int offset, unsigned int bits, unsigned int value)
+{
+    unsigned long long mask = ((1ULL << bits) - 1) << (offset % 8);
+    unsigned long long v = ((unsigned long long)value << (offset % 8)) & mask;
+    unsigned int i;
+
+    for(i = offset / 8; i <= (offset + bits - 1) / 8; i++)
+    {
+        buf[i] = (buf[i] & ~(unsigned char)(mask >> (8 * (i - offset / 8)))) | (unsigned char)(v >> (8 * (i - offset / 8)));
+    }
+}
+
+
+/*
+* 0x00 VID, 4 bytes, RO
+*/
+#define  TPS_REG_VID                                      0x00
+#define  TPS_REG_VID_LEN                                  4
+#define  TPS_VID_INTEL_ASSIGNED_THUNDERBOLT_VENDOR_ID     0, 32
+static inline unsigned int tps65987_vid_intel_assigned_thunderbolt_vendor_id(const unsigned char *buf) { return tps65987_field_get(buf, TPS_VID_INTEL_ASSIGNED_THUNDERBOLT_VENDOR_ID); }
+
+/*
+* 0x01 DID, 4 bytes, RO
+*/
+#define  TPS_REG_DID                                      0x01
+#define  TPS_REG_DID_LEN                                  4
+#define  TPS_DID_VENDOR_SPECIFIC_DEVICE_ID                0, 32
+static inline unsigned int tps65987_did_vendor_specific_device_id(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DID_VENDOR_SPECIFIC_DEVICE_ID); }
+
+/*
+* 0x03 Mode, 4 bytes, DRO
+*/
+#define  TPS_REG_MODE                                     0x03
+#define  TPS_REG_MODE_LEN                                 4
+#define  TPS_MODE_MODE                                    0, 32
+static inline unsigned int tps65987_mode_mode(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MODE_MODE); }
+
+/*
+* 0x05 UID, 16 bytes, DRO
+*/
+#define  TPS_REG_UID                                      0x05
+#define  TPS_REG_UID_LEN                                  16
+#define  TPS_UID_UID                                      0, 128
+
+/*
+* 0x06 Customer Use, 8 bytes, RO
+*/
+#define  TPS_REG_CUSTOMER_USE                             0x06
+#define  TPS_REG_CUSTOMER_USE_LEN                         8
+#define  TPS_CUSTOMER_USE_CUSTOMER_USE_WORD_1             0, 32
+#define  TPS_CUSTOMER_USE_CUSTOMER_USE_WORD_2             32, 32
+static inline unsigned int tps65987_customer_use_customer_use_word_1(const unsigned char *buf) { return tps65987_field_get(buf, TPS_CUSTOMER_USE_CUSTOMER_USE_WORD_1); }
+static inline unsigned int tps65987_customer_use_customer_use_word_2(const unsigned char *buf) { return tps65987_field_get(buf, TPS_CUSTOMER_USE_CUSTOMER_USE_WORD_2); }
+
+/*
+* 0x08 Command Register for CMD1, 4 bytes, DRW
+*/
+#define  TPS_REG_COMMAND_REGISTER_FOR_CMD1                0x08
+#define  TPS_REG_COMMAND_REGISTER_FOR_CMD1_LEN            4
+#define  TPS_COMMAND_REGISTER_FOR_CMD1__4CC_COMMAND       0, 32
+static inline unsigned int tps65987_command_register_for_cmd1__4cc_command(const unsigned char *buf) { return tps65987_field_get(buf, TPS_COMMAND_REGISTER_FOR_CMD1__4CC_COMMAND); }
+static inline void tps65987_set_command_register_for_cmd1__4cc_command(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_COMMAND_REGISTER_FOR_CMD1__4CC_COMMAND, v); }
+
+/*
+* 0x09 Data Register for CMD1, 64 bytes, DRW
+*/
+#define  TPS_REG_DATA_REGISTER_FOR_CMD1                   0x09
+#define  TPS_REG_DATA_REGISTER_FOR_CMD1_LEN               64
+#define  TPS_DATA_REGISTER_FOR_CMD1_WORD_1_LEAST_SIGNIFICANT 0, 32
+#define  TPS_DATA_REGISTER_FOR_CMD1_WORD_2                32, 32
+#define  TPS_DATA_REGISTER_FOR_CMD1_WORD_3                64, 32
+#define  TPS_DATA_REGISTER_FOR_CMD1_WORD_4                96, 32
+#define  TPS_DATA_REGISTER_FOR_CMD1_WORD_5                128, 32
+#define  TPS_DATA_REGISTER_FOR_CMD1_WORD_6                160, 32
+#define  TPS_DATA_REGISTER_FOR_CMD1_WORD_7                192, 32
+#define  TPS_DATA_REGISTER_FOR_CMD1_WORD_8                224, 32
+#define  TPS_DATA_REGISTER_FOR_CMD1_WORD_9                256, 32
+#define  TPS_DATA_REGISTER_FOR_CMD1_WORD_10               288, 32
+#define  TPS_DATA_REGISTER_FOR_CMD1_WORD_11               320, 32
+#define  TPS_DATA_REGISTER_FOR_CMD1_WORD_12               352, 32
+#define  TPS_DATA_REGISTER_FOR_CMD1_WORD_13               384, 32
+#define  TPS_DATA_REGISTER_FOR_CMD1_WORD_14               416, 32
+#define  TPS_DATA_REGISTER_FOR_CMD1_WORD_15               448, 32
+#define  TPS_DATA_REGISTER_FOR_CMD1_WORD_16               480, 32
+static inline unsigned int tps65987_data_register_for_cmd1_word_1_least_significant(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_1_LEAST_SIGNIFICANT); }
+static inline void tps65987_set_data_register_for_cmd1_word_1_least_significant(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_1_LEAST_SIGNIFICANT, v); }
+static inline unsigned int tps65987_data_register_for_cmd1_word_2(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_2); }
+static inline void tps65987_set_data_register_for_cmd1_word_2(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_2, v); }
+static inline unsigned int tps65987_data_register_for_cmd1_word_3(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_3); }
+static inline void tps65987_set_data_register_for_cmd1_word_3(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_3, v); }
+static inline unsigned int tps65987_data_register_for_cmd1_word_4(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_4); }
+static inline void tps65987_set_data_register_for_cmd1_word_4(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_4, v); }
+static inline unsigned int tps65987_data_register_for_cmd1_word_5(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_5); }
+static inline void tps65987_set_data_register_for_cmd1_word_5(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_5, v); }
+static inline unsigned int tps65987_data_register_for_cmd1_word_6(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_6); }
+static inline void tps65987_set_data_register_for_cmd1_word_6(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_6, v); }
+static inline unsigned int tps65987_data_register_for_cmd1_word_7(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_7); }
+static inline void tps65987_set_data_register_for_cmd1_word_7(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_7, v); }
+static inline unsigned int tps65987_data_register_for_cmd1_word_8(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_8); }
+static inline void tps65987_set_data_register_for_cmd1_word_8(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_8, v); }
+static inline unsigned int tps65987_data_register_for_cmd1_word_9(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_9); }
+static inline void tps65987_set_data_register_for_cmd1_word_9(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_9, v); }
+static inline unsigned int tps65987_data_register_for_cmd1_word_10(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_10); }
+static inline void tps65987_set_data_register_for_cmd1_word_10(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_10, v); }
+static inline unsigned int tps65987_data_register_for_cmd1_word_11(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_11); }
+static inline void tps65987_set_data_register_for_cmd1_word_11(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_11, v); }
+static inline unsigned int tps65987_data_register_for_cmd1_word_12(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_12); }
+static inline void tps65987_set_data_register_for_cmd1_word_12(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_12, v); }
+static inline unsigned int tps65987_data_register_for_cmd1_word_13(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_13); }
+static inline void tps65987_set_data_register_for_cmd1_word_13(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_13, v); }
+static inline unsigned int tps65987_data_register_for_cmd1_word_14(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_14); }
+static inline void tps65987_set_data_register_for_cmd1_word_14(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_14, v); }
+static inline unsigned int tps65987_data_register_for_cmd1_word_15(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_15); }
+static inline void tps65987_set_data_register_for_cmd1_word_15(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_15, v); }
+static inline unsigned int tps65987_data_register_for_cmd1_word_16(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_16); }
+static inline void tps65987_set_data_register_for_cmd1_word_16(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD1_WORD_16, v); }
+
+/*
+* 0x0F Version, 4 bytes, DRO
+*/
+#define  TPS_REG_VERSION                                  0x0F
+#define  TPS_REG_VERSION_LEN                              4
+#define  TPS_VERSION_VERSION                              0, 32
+static inline unsigned int tps65987_version_version(const unsigned char *buf) { return tps65987_field_get(buf, TPS_VERSION_VERSION); }
+
+/*
+* 0x10 Command Register for CMD2, 4 bytes, DRW
+*/
+#define  TPS_REG_COMMAND_REGISTER_FOR_CMD2                0x10
+#define  TPS_REG_COMMAND_REGISTER_FOR_CMD2_LEN            4
+#define  TPS_COMMAND_REGISTER_FOR_CMD2__4CC_COMMAND       0, 32
+static inline unsigned int tps65987_command_register_for_cmd2__4cc_command(const unsigned char *buf) { return tps65987_field_get(buf, TPS_COMMAND_REGISTER_FOR_CMD2__4CC_COMMAND); }
+static inline void tps65987_set_command_register_for_cmd2__4cc_command(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_COMMAND_REGISTER_FOR_CMD2__4CC_COMMAND, v); }
+
+/*
+* 0x11 Data Register for CMD2, 64 bytes, DRW
+*/
+#define  TPS_REG_DATA_REGISTER_FOR_CMD2                   0x11
+#define  TPS_REG_DATA_REGISTER_FOR_CMD2_LEN               64
+#define  TPS_DATA_REGISTER_FOR_CMD2_WORD_1_LEAST_SIGNIFICANT 0, 32
+#define  TPS_DATA_REGISTER_FOR_CMD2_WORD_2                32, 32
+#define  TPS_DATA_REGISTER_FOR_CMD2_WORD_3                64, 32
+#define  TPS_DATA_REGISTER_FOR_CMD2_WORD_4                96, 32
+#define  TPS_DATA_REGISTER_FOR_CMD2_WORD_5                128, 32
+#define  TPS_DATA_REGISTER_FOR_CMD2_WORD_6                160, 32
+#define  TPS_DATA_REGISTER_FOR_CMD2_WORD_7                192, 32
+#define  TPS_DATA_REGISTER_FOR_CMD2_WORD_8                224, 32
+#define  TPS_DATA_REGISTER_FOR_CMD2_WORD_9                256, 32
+#define  TPS_DATA_REGISTER_FOR_CMD2_WORD_10               288, 32
+#define  TPS_DATA_REGISTER_FOR_CMD2_WORD_11               320, 32
+#define  TPS_DATA_REGISTER_FOR_CMD2_WORD_12               352, 32
+#define  TPS_DATA_REGISTER_FOR_CMD2_WORD_13               384, 32
+#define  TPS_DATA_REGISTER_FOR_CMD2_WORD_14               416, 32
+#define  TPS_DATA_REGISTER_FOR_CMD2_WORD_15               448, 32
+#define  TPS_DATA_REGISTER_FOR_CMD2_WORD_16               480, 32
+static inline unsigned int tps65987_data_register_for_cmd2_word_1_least_significant(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_1_LEAST_SIGNIFICANT); }
+static inline void tps65987_set_data_register_for_cmd2_word_1_least_significant(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_1_LEAST_SIGNIFICANT, v); }
+static inline unsigned int tps65987_data_register_for_cmd2_word_2(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_2); }
+static inline void tps65987_set_data_register_for_cmd2_word_2(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_2, v); }
+static inline unsigned int tps65987_data_register_for_cmd2_word_3(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_3); }
+static inline void tps65987_set_data_register_for_cmd2_word_3(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_3, v); }
+static inline unsigned int tps65987_data_register_for_cmd2_word_4(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_4); }
+static inline void tps65987_set_data_register_for_cmd2_word_4(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_4, v); }
+static inline unsigned int tps65987_data_register_for_cmd2_word_5(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_5); }
+static inline void tps65987_set_data_register_for_cmd2_word_5(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_5, v); }
+static inline unsigned int tps65987_data_register_for_cmd2_word_6(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_6); }
+static inline void tps65987_set_data_register_for_cmd2_word_6(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_6, v); }
+static inline unsigned int tps65987_data_register_for_cmd2_word_7(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_7); }
+static inline void tps65987_set_data_register_for_cmd2_word_7(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_7, v); }
+static inline unsigned int tps65987_data_register_for_cmd2_word_8(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_8); }
+static inline void tps65987_set_data_register_for_cmd2_word_8(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_8, v); }
+static inline unsigned int tps65987_data_register_for_cmd2_word_9(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_9); }
+static inline void tps65987_set_data_register_for_cmd2_word_9(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_9, v); }
+static inline unsigned int tps65987_data_register_for_cmd2_word_10(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_10); }
+static inline void tps65987_set_data_register_for_cmd2_word_10(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_10, v); }
+static inline unsigned int tps65987_data_register_for_cmd2_word_11(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_11); }
+static inline void tps65987_set_data_register_for_cmd2_word_11(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_11, v); }
+static inline unsigned int tps65987_data_register_for_cmd2_word_12(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_12); }
+static inline void tps65987_set_data_register_for_cmd2_word_12(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_12, v); }
+static inline unsigned int tps65987_data_register_for_cmd2_word_13(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_13); }
+static inline void tps65987_set_data_register_for_cmd2_word_13(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_13, v); }
+static inline unsigned int tps65987_data_register_for_cmd2_word_14(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_14); }
+static inline void tps65987_set_data_register_for_cmd2_word_14(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_14, v); }
+static inline unsigned int tps65987_data_register_for_cmd2_word_15(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_15); }
+static inline void tps65987_set_data_register_for_cmd2_word_15(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_15, v); }
+static inline unsigned int tps65987_data_register_for_cmd2_word_16(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_16); }
+static inline void tps65987_set_data_register_for_cmd2_word_16(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD2_WORD_16, v); }
+
+/*
+* 0x12 Extended Data 2, 64 bytes, DRW
+*/
+#define  TPS_REG_EXTENDED_DATA_2                          0x12
+#define  TPS_REG_EXTENDED_DATA_2_LEN                      64
+#define  TPS_EXTENDED_DATA_2_EXTENDED_DATA_2              0, 512
+
+/*
+* 0x13 Extended Data 1, 64 bytes, DRW
+*/
+#define  TPS_REG_EXTENDED_DATA_1                          0x13
+#define  TPS_REG_EXTENDED_DATA_1_LEN                      64
+#define  TPS_EXTENDED_DATA_1_EXTERNAL_DATA_1              0, 512
+
+/*
+* 0x14 Interrupt Event for I2C1, 11 bytes, DRO
+*/
+#define  TPS_REG_INTERRUPT_EVENT_FOR_I2C1                 0x14
+#define  TPS_REG_INTERRUPT_EVENT_FOR_I2C1_LEN             11
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_SOFT_RESET          0, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_HARD_RESET          1, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_CABLE_RESET_EVENT   2, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_PLUG_INSERT_OR_REMOVAL 3, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_PR_SWAP_COMPLETE    4, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_DR_SWAP_COMPLETE    5, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_FR_SWAP_COMPLETE    6, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_RDO_RECEIVED_FROM_SINK 7, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_BUILT_IN_SELF_TEST  8, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_OVERCURRENT_EVENT   9, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_ATTENTION_RECEIVED  10, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_VENDOR_DEFINED_MESSAGE_RECEIVED 11, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_NEW_CONTRACT_AS_CONSUMER 12, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_NEW_CONTRACT_AS_PROVIDER 13, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_SOURCE_CAPABILITIES_MESSAGE_READY 14, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_SINK_CAPABILITIES_MESSAGE_READY 15, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_LOW_VOLTAGE_WARNING 16, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_PR_SWAP_REQUESTED   17, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_DR_SWAP_REQUESTED   18, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_GOTO_MIN_RECEIVED   19, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_USB_HOST_PRESENT    20, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_USB_HOST_PRESENT_NO_LONGER 21, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_HIGH_VOLTAGE_WARNING 22, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_PP_SWITCH_CHANGED   23, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_POWER_STATUS_UPDATE 24, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_DATA_STATUS_UPDATE  25, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_STATUS_UPDATE       26, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_PD_STATUS_UPDATE    27, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_VCONN_SWAP_COMPLETE 28, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_VCONN_SWAP_REQUESTED 29, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_CMD1_COMPLETE       30, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_CMD2_COMPLETE       31, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_DEVICE_INCOMPATIBLE 32, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_CANNOT_PROVIDE_VOLTAGE_OR_CURRENT 33, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_CAN_PROVIDE_VOLTAGE_OR_CURRENT_LATER 34, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_POWER_EVENT_OCCURRED 35, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_MISSING_GET_CAPABILITIES_MESSAGE 36, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_PROTOCOL_ERROR 38, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_MESSAGE_DATA  39, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_DISCHARGE_FAILED 41, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_SINK_TRANSITION_COMPLETE 42, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_ICE_LAKE_PLUG_EARLY_NOTIFICATION 43, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_ICE_LAKE_PROCHOT_NOTIFICATION 44, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_UNABLE_TO_SOURCE 46, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_BIST_MESSAGE_IGNORED 47, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_AM_ENTRY_FAILURE    48, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_AM_ENTERED          49, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_VENDOR_DEFINED_MESSAGE_SENT 50, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_DISCOVER_MODE_COMPLETE 51, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_EXIT_MODE_COMPLETE  52, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_USER_SVID_MODE_ENTERED 56, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_USER_SVID_MODE_EXITED 57, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_USER_SVID_ATTENTION_VDM_RECEIVED 58, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_USER_SVID_OTHER_VDM_RECEIVED 59, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_DP_SID_STATUS_UPDATE 62, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_INTEL_VID_STATUS_UPDATE 63, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_PD3_STATUS_UPDATE   64, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_TX_MEM_BUFFER_EMPTY 65, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_RX_MEM_BUFFER_FULL  66, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_CUSTOM_VDM_ARRIVE   67, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_CUSTOM_AM_ENTERED   68, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_CUSTOM_VDM_MESSAGE_SENT 69, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_SOC_ACK_TIMEOUT     70, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_FRS_SIGNAL_RECEIVED 76, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_CHUNK_RESPONSE_RECEIVED 77, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_CHUNK_REQUEST_RECEIVED 78, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_ALERT_MESSAGE_RECEIVED 79, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_PATCH_LOADED        80, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C1_READY_FOR_PATCH     81, 1
+static inline unsigned int tps65987_interrupt_event_for_i2c1_soft_reset(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_SOFT_RESET); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_hard_reset(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_HARD_RESET); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_cable_reset_event(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_CABLE_RESET_EVENT); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_plug_insert_or_removal(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_PLUG_INSERT_OR_REMOVAL); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_pr_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_PR_SWAP_COMPLETE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_dr_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_DR_SWAP_COMPLETE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_fr_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_FR_SWAP_COMPLETE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_rdo_received_from_sink(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_RDO_RECEIVED_FROM_SINK); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_built_in_self_test(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_BUILT_IN_SELF_TEST); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_overcurrent_event(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_OVERCURRENT_EVENT); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_attention_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_ATTENTION_RECEIVED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_vendor_defined_message_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_VENDOR_DEFINED_MESSAGE_RECEIVED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_new_contract_as_consumer(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_NEW_CONTRACT_AS_CONSUMER); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_new_contract_as_provider(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_NEW_CONTRACT_AS_PROVIDER); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_source_capabilities_message_ready(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_SOURCE_CAPABILITIES_MESSAGE_READY); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_sink_capabilities_message_ready(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_SINK_CAPABILITIES_MESSAGE_READY); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_low_voltage_warning(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_LOW_VOLTAGE_WARNING); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_pr_swap_requested(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_PR_SWAP_REQUESTED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_dr_swap_requested(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_DR_SWAP_REQUESTED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_goto_min_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_GOTO_MIN_RECEIVED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_usb_host_present(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_USB_HOST_PRESENT); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_usb_host_present_no_longer(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_USB_HOST_PRESENT_NO_LONGER); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_high_voltage_warning(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_HIGH_VOLTAGE_WARNING); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_pp_switch_changed(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_PP_SWITCH_CHANGED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_power_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_POWER_STATUS_UPDATE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_data_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_DATA_STATUS_UPDATE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_STATUS_UPDATE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_pd_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_PD_STATUS_UPDATE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_vconn_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_VCONN_SWAP_COMPLETE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_vconn_swap_requested(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_VCONN_SWAP_REQUESTED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_cmd1_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_CMD1_COMPLETE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_cmd2_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_CMD2_COMPLETE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_error_device_incompatible(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_DEVICE_INCOMPATIBLE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_error_cannot_provide_voltage_or_current(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_CANNOT_PROVIDE_VOLTAGE_OR_CURRENT); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_error_can_provide_voltage_or_current_later(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_CAN_PROVIDE_VOLTAGE_OR_CURRENT_LATER); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_error_power_event_occurred(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_POWER_EVENT_OCCURRED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_error_missing_get_capabilities_message(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_MISSING_GET_CAPABILITIES_MESSAGE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_error_protocol_error(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_PROTOCOL_ERROR); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_error_message_data(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_MESSAGE_DATA); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_error_discharge_failed(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_DISCHARGE_FAILED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_sink_transition_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_SINK_TRANSITION_COMPLETE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_ice_lake_plug_early_notification(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_ICE_LAKE_PLUG_EARLY_NOTIFICATION); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_ice_lake_prochot_notification(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_ICE_LAKE_PROCHOT_NOTIFICATION); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_error_unable_to_source(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_UNABLE_TO_SOURCE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_error_bist_message_ignored(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_ERROR_BIST_MESSAGE_IGNORED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_am_entry_failure(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_AM_ENTRY_FAILURE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_am_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_AM_ENTERED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_vendor_defined_message_sent(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_VENDOR_DEFINED_MESSAGE_SENT); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_discover_mode_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_DISCOVER_MODE_COMPLETE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_exit_mode_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_EXIT_MODE_COMPLETE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_user_svid_mode_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_USER_SVID_MODE_ENTERED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_user_svid_mode_exited(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_USER_SVID_MODE_EXITED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_user_svid_attention_vdm_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_USER_SVID_ATTENTION_VDM_RECEIVED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_user_svid_other_vdm_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_USER_SVID_OTHER_VDM_RECEIVED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_dp_sid_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_DP_SID_STATUS_UPDATE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_intel_vid_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_INTEL_VID_STATUS_UPDATE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_pd3_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_PD3_STATUS_UPDATE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_tx_mem_buffer_empty(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_TX_MEM_BUFFER_EMPTY); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_rx_mem_buffer_full(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_RX_MEM_BUFFER_FULL); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_custom_vdm_arrive(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_CUSTOM_VDM_ARRIVE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_custom_am_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_CUSTOM_AM_ENTERED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_custom_vdm_message_sent(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_CUSTOM_VDM_MESSAGE_SENT); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_soc_ack_timeout(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_SOC_ACK_TIMEOUT); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_frs_signal_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_FRS_SIGNAL_RECEIVED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_chunk_response_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_CHUNK_RESPONSE_RECEIVED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_chunk_request_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_CHUNK_REQUEST_RECEIVED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_alert_message_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_ALERT_MESSAGE_RECEIVED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_patch_loaded(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_PATCH_LOADED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c1_ready_for_patch(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C1_READY_FOR_PATCH); }
+
+/*
+* 0x15 Interrupt Event for I2C2, 11 bytes, DRO
+*/
+#define  TPS_REG_INTERRUPT_EVENT_FOR_I2C2                 0x15
+#define  TPS_REG_INTERRUPT_EVENT_FOR_I2C2_LEN             11
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_SOFT_RESET          0, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_HARD_RESET          1, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_CABLE_RESET_EVENT   2, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_PLUG_INSERT_OR_REMOVAL 3, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_PR_SWAP_COMPLETE    4, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_DR_SWAP_COMPLETE    5, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_FR_SWAP_COMPLETE    6, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_RDO_RECEIVED_FROM_SINK 7, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_BUILT_IN_SELF_TEST  8, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_OVERCURRENT_EVENT   9, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_ATTENTION_RECEIVED  10, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_VENDOR_DEFINED_MESSAGE_RECEIVED 11, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_NEW_CONTRACT_AS_CONSUMER 12, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_NEW_CONTRACT_AS_PROVIDER 13, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_SOURCE_CAPABILITIES_MESSAGE_READY 14, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_SINK_CAPABILITIES_MESSAGE_READY 15, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_LOW_VOLTAGE_WARNING 16, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_PR_SWAP_REQUESTED   17, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_DR_SWAP_REQUESTED   18, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_GOTO_MIN_RECEIVED   19, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_USB_HOST_PRESENT    20, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_USB_HOST_PRESENT_NO_LONGER 21, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_HIGH_VOLTAGE_WARNING 22, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_PP_SWITCH_CHANGED   23, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_POWER_STATUS_UPDATE 24, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_DATA_STATUS_UPDATE  25, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_STATUS_UPDATE       26, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_PD_STATUS_UPDATE    27, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_VCONN_SWAP_COMPLETE 28, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_VCONN_SWAP_REQUESTED 29, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_CMD1_COMPLETE       30, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_CMD2_COMPLETE       31, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_DEVICE_INCOMPATIBLE 32, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_CANNOT_PROVIDE_VOLTAGE_OR_CURRENT 33, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_CAN_PROVIDE_VOLTAGE_OR_CURRENT_LATER 34, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_POWER_EVENT_OCCURRED 35, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_MISSING_GET_CAPABILITIES_MESSAGE 36, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_PROTOCOL_ERROR 38, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_MESSAGE_DATA  39, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_DISCHARGE_FAILED 41, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_SINK_TRANSITION_COMPLETE 42, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_ICE_LAKE_PLUG_EARLY_NOTIFICATION 43, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_ICE_LAKE_PROCHOT_NOTIFICATION 44, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_UNABLE_TO_SOURCE 46, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_BIST_MESSAGE_IGNORED 47, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_AM_ENTRY_FAILURE    48, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_AM_ENTERED          49, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_VENDOR_DEFINED_MESSAGE_SENT 50, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_DISCOVER_MODE_COMPLETE 51, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_EXIT_MODE_COMPLETE  52, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_USER_SVID_MODE_ENTERED 56, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_USER_SVID_MODE_EXITED 57, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_USER_SVID_ATTENTION_VDM_RECEIVED 58, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_USER_SVID_OTHER_VDM_RECEIVED 59, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_DP_SID_STATUS_UPDATE 62, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_INTEL_VID_STATUS_UPDATE 63, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_PD3_STATUS_UPDATE   64, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_TX_MEM_BUFFER_EMPTY 65, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_RX_MEM_BUFFER_FULL  66, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_CUSTOM_VDM_ARRIVE   67, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_CUSTOM_AM_ENTERED   68, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_CUSTOM_VDM_MESSAGE_SENT 69, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_SOC_ACK_TIMEOUT     70, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_FRS_SIGNAL_RECEIVED 76, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_CHUNK_RESPONSE_RECEIVED 77, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_CHUNK_REQUEST_RECEIVED 78, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_ALERT_MESSAGE_RECEIVED 79, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_PATCH_LOADED        80, 1
+#define  TPS_INTERRUPT_EVENT_FOR_I2C2_READY_FOR_PATCH     81, 1
+static inline unsigned int tps65987_interrupt_event_for_i2c2_soft_reset(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_SOFT_RESET); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_hard_reset(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_HARD_RESET); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_cable_reset_event(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_CABLE_RESET_EVENT); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_plug_insert_or_removal(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_PLUG_INSERT_OR_REMOVAL); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_pr_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_PR_SWAP_COMPLETE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_dr_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_DR_SWAP_COMPLETE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_fr_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_FR_SWAP_COMPLETE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_rdo_received_from_sink(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_RDO_RECEIVED_FROM_SINK); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_built_in_self_test(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_BUILT_IN_SELF_TEST); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_overcurrent_event(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_OVERCURRENT_EVENT); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_attention_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_ATTENTION_RECEIVED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_vendor_defined_message_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_VENDOR_DEFINED_MESSAGE_RECEIVED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_new_contract_as_consumer(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_NEW_CONTRACT_AS_CONSUMER); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_new_contract_as_provider(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_NEW_CONTRACT_AS_PROVIDER); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_source_capabilities_message_ready(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_SOURCE_CAPABILITIES_MESSAGE_READY); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_sink_capabilities_message_ready(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_SINK_CAPABILITIES_MESSAGE_READY); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_low_voltage_warning(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_LOW_VOLTAGE_WARNING); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_pr_swap_requested(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_PR_SWAP_REQUESTED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_dr_swap_requested(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_DR_SWAP_REQUESTED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_goto_min_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_GOTO_MIN_RECEIVED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_usb_host_present(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_USB_HOST_PRESENT); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_usb_host_present_no_longer(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_USB_HOST_PRESENT_NO_LONGER); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_high_voltage_warning(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_HIGH_VOLTAGE_WARNING); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_pp_switch_changed(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_PP_SWITCH_CHANGED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_power_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_POWER_STATUS_UPDATE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_data_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_DATA_STATUS_UPDATE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_STATUS_UPDATE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_pd_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_PD_STATUS_UPDATE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_vconn_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_VCONN_SWAP_COMPLETE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_vconn_swap_requested(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_VCONN_SWAP_REQUESTED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_cmd1_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_CMD1_COMPLETE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_cmd2_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_CMD2_COMPLETE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_error_device_incompatible(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_DEVICE_INCOMPATIBLE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_error_cannot_provide_voltage_or_current(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_CANNOT_PROVIDE_VOLTAGE_OR_CURRENT); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_error_can_provide_voltage_or_current_later(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_CAN_PROVIDE_VOLTAGE_OR_CURRENT_LATER); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_error_power_event_occurred(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_POWER_EVENT_OCCURRED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_error_missing_get_capabilities_message(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_MISSING_GET_CAPABILITIES_MESSAGE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_error_protocol_error(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_PROTOCOL_ERROR); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_error_message_data(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_MESSAGE_DATA); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_error_discharge_failed(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_DISCHARGE_FAILED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_sink_transition_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_SINK_TRANSITION_COMPLETE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_ice_lake_plug_early_notification(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_ICE_LAKE_PLUG_EARLY_NOTIFICATION); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_ice_lake_prochot_notification(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_ICE_LAKE_PROCHOT_NOTIFICATION); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_error_unable_to_source(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_UNABLE_TO_SOURCE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_error_bist_message_ignored(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_ERROR_BIST_MESSAGE_IGNORED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_am_entry_failure(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_AM_ENTRY_FAILURE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_am_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_AM_ENTERED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_vendor_defined_message_sent(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_VENDOR_DEFINED_MESSAGE_SENT); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_discover_mode_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_DISCOVER_MODE_COMPLETE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_exit_mode_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_EXIT_MODE_COMPLETE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_user_svid_mode_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_USER_SVID_MODE_ENTERED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_user_svid_mode_exited(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_USER_SVID_MODE_EXITED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_user_svid_attention_vdm_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_USER_SVID_ATTENTION_VDM_RECEIVED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_user_svid_other_vdm_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_USER_SVID_OTHER_VDM_RECEIVED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_dp_sid_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_DP_SID_STATUS_UPDATE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_intel_vid_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_INTEL_VID_STATUS_UPDATE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_pd3_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_PD3_STATUS_UPDATE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_tx_mem_buffer_empty(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_TX_MEM_BUFFER_EMPTY); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_rx_mem_buffer_full(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_RX_MEM_BUFFER_FULL); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_custom_vdm_arrive(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_CUSTOM_VDM_ARRIVE); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_custom_am_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_CUSTOM_AM_ENTERED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_custom_vdm_message_sent(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_CUSTOM_VDM_MESSAGE_SENT); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_soc_ack_timeout(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_SOC_ACK_TIMEOUT); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_frs_signal_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_FRS_SIGNAL_RECEIVED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_chunk_response_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_CHUNK_RESPONSE_RECEIVED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_chunk_request_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_CHUNK_REQUEST_RECEIVED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_alert_message_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_ALERT_MESSAGE_RECEIVED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_patch_loaded(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_PATCH_LOADED); }
+static inline unsigned int tps65987_interrupt_event_for_i2c2_ready_for_patch(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_EVENT_FOR_I2C2_READY_FOR_PATCH); }
+
+/*
+* 0x16 Interrupt Mask for I2C1, 11 bytes, RW
+*/
+#define  TPS_REG_INTERRUPT_MASK_FOR_I2C1                  0x16
+#define  TPS_REG_INTERRUPT_MASK_FOR_I2C1_LEN              11
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_SOFT_RESET           0, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_HARD_RESET           1, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_CABLE_RESET_EVENT    2, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_PLUG_INSERT_OR_REMOVAL 3, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_PR_SWAP_COMPLETE     4, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_DR_SWAP_COMPLETE     5, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_FR_SWAP_COMPLETE     6, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_RDO_RECEIVED_FROM_SINK 7, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_BUILT_IN_SELF_TEST   8, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_OVERCURRENT_EVENT    9, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_ATTENTION_RECEIVED   10, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_VENDOR_DEFINED_MESSAGE_RECEIVED 11, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_NEW_CONTRACT_AS_CONSUMER 12, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_NEW_CONTRACT_AS_PROVIDER 13, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_SOURCE_CAPABILITIES_MESSAGE_READY 14, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_SINK_CAPABILITIES_MESSAGE_READY 15, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_LOW_VOLTAGE_WARNING  16, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_PR_SWAP_REQUESTED    17, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_DR_SWAP_REQUESTED    18, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_GOTO_MIN_RECEIVED    19, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_USB_HOST_PRESENT     20, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_USB_HOST_PRESENT_NO_LONGER 21, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_HIGH_VOLTAGE_WARNING 22, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_PP_SWITCH_CHANGED    23, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_POWER_STATUS_UPDATE  24, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_DATA_STATUS_UPDATE   25, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_STATUS_UPDATE        26, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_PD_STATUS_UPDATE     27, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_VCONN_SWAP_COMPLETE  28, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_VCONN_SWAP_REQUESTED 29, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_CMD1_COMPLETE        30, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_CMD2_COMPLETE        31, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_DEVICE_INCOMPATIBLE 32, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_CANNOT_PROVIDE_VOLTAGE_OR_CURRENT 33, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_CAN_PROVIDE_VOLTAGE_OR_CURRENT_LATER 34, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_POWER_EVENT_OCCURRED 35, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_MISSING_GET_CAPABILITIES_MESSAGE 36, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_PROTOCOL_ERROR 38, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_MESSAGE_DATA   39, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_DISCHARGE_FAILED 41, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_SINK_TRANSITION_COMPLETE 42, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_ICE_LAKE_PLUG_EARLY_NOTIFICATION 43, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_ICE_LAKE_PROCHOT_NOTIFICATION 44, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_UNABLE_TO_SOURCE 46, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_BIST_MESSAGE_IGNORED 47, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_AM_ENTRY_FAILURE     48, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_AM_ENTERED           49, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_VENDOR_DEFINED_MESSAGE_SENT 50, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_DISCOVER_MODE_COMPLETE 51, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_EXIT_MODE_COMPLETE   52, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_USER_SVID_MODE_ENTERED 56, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_USER_SVID_MODE_EXITED 57, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_USER_SVID_ATTENTION_VDM_RECEIVED 58, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_USER_SVID_OTHER_VDM_RECEIVED 59, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_DP_SID_STATUS_UPDATE 62, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_INTEL_VID_STATUS_UPDATE 63, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_PD3_STATUS_UPDATE    64, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_TX_MEM_BUFFER_EMPTY  65, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_RX_MEM_BUFFER_FULL   66, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_CUSTOM_VDM_ARRIVE    67, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_CUSTOM_AM_ENTERED    68, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_CUSTOM_VDM_MESSAGE_SENT 69, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_SOC_ACK_TIMEOUT      70, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_FRS_SIGNAL_RECEIVED  76, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_CHUNK_RESPONSE_RECEIVED 77, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_CHUNK_REQUEST_RECEIVED 78, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_ALERT_MESSAGE_RECEIVED 79, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_PATCH_LOADED         80, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C1_READY_FOR_PATCH      81, 1
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_soft_reset(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_SOFT_RESET); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_soft_reset(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_SOFT_RESET, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_hard_reset(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_HARD_RESET); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_hard_reset(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_HARD_RESET, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_cable_reset_event(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_CABLE_RESET_EVENT); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_cable_reset_event(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_CABLE_RESET_EVENT, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_plug_insert_or_removal(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_PLUG_INSERT_OR_REMOVAL); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_plug_insert_or_removal(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_PLUG_INSERT_OR_REMOVAL, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_pr_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_PR_SWAP_COMPLETE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_pr_swap_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_PR_SWAP_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_dr_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_DR_SWAP_COMPLETE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_dr_swap_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_DR_SWAP_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_fr_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_FR_SWAP_COMPLETE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_fr_swap_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_FR_SWAP_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_rdo_received_from_sink(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_RDO_RECEIVED_FROM_SINK); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_rdo_received_from_sink(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_RDO_RECEIVED_FROM_SINK, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_built_in_self_test(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_BUILT_IN_SELF_TEST); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_built_in_self_test(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_BUILT_IN_SELF_TEST, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_overcurrent_event(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_OVERCURRENT_EVENT); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_overcurrent_event(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_OVERCURRENT_EVENT, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_attention_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ATTENTION_RECEIVED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_attention_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ATTENTION_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_vendor_defined_message_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_VENDOR_DEFINED_MESSAGE_RECEIVED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_vendor_defined_message_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_VENDOR_DEFINED_MESSAGE_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_new_contract_as_consumer(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_NEW_CONTRACT_AS_CONSUMER); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_new_contract_as_consumer(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_NEW_CONTRACT_AS_CONSUMER, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_new_contract_as_provider(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_NEW_CONTRACT_AS_PROVIDER); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_new_contract_as_provider(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_NEW_CONTRACT_AS_PROVIDER, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_source_capabilities_message_ready(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_SOURCE_CAPABILITIES_MESSAGE_READY); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_source_capabilities_message_ready(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_SOURCE_CAPABILITIES_MESSAGE_READY, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_sink_capabilities_message_ready(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_SINK_CAPABILITIES_MESSAGE_READY); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_sink_capabilities_message_ready(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_SINK_CAPABILITIES_MESSAGE_READY, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_low_voltage_warning(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_LOW_VOLTAGE_WARNING); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_low_voltage_warning(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_LOW_VOLTAGE_WARNING, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_pr_swap_requested(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_PR_SWAP_REQUESTED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_pr_swap_requested(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_PR_SWAP_REQUESTED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_dr_swap_requested(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_DR_SWAP_REQUESTED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_dr_swap_requested(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_DR_SWAP_REQUESTED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_goto_min_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_GOTO_MIN_RECEIVED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_goto_min_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_GOTO_MIN_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_usb_host_present(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_USB_HOST_PRESENT); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_usb_host_present(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_USB_HOST_PRESENT, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_usb_host_present_no_longer(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_USB_HOST_PRESENT_NO_LONGER); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_usb_host_present_no_longer(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_USB_HOST_PRESENT_NO_LONGER, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_high_voltage_warning(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_HIGH_VOLTAGE_WARNING); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_high_voltage_warning(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_HIGH_VOLTAGE_WARNING, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_pp_switch_changed(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_PP_SWITCH_CHANGED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_pp_switch_changed(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_PP_SWITCH_CHANGED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_power_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_POWER_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_power_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_POWER_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_data_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_DATA_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_data_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_DATA_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_pd_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_PD_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_pd_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_PD_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_vconn_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_VCONN_SWAP_COMPLETE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_vconn_swap_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_VCONN_SWAP_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_vconn_swap_requested(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_VCONN_SWAP_REQUESTED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_vconn_swap_requested(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_VCONN_SWAP_REQUESTED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_cmd1_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_CMD1_COMPLETE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_cmd1_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_CMD1_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_cmd2_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_CMD2_COMPLETE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_cmd2_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_CMD2_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_error_device_incompatible(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_DEVICE_INCOMPATIBLE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_error_device_incompatible(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_DEVICE_INCOMPATIBLE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_error_cannot_provide_voltage_or_current(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_CANNOT_PROVIDE_VOLTAGE_OR_CURRENT); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_error_cannot_provide_voltage_or_current(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_CANNOT_PROVIDE_VOLTAGE_OR_CURRENT, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_error_can_provide_voltage_or_current_later(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_CAN_PROVIDE_VOLTAGE_OR_CURRENT_LATER); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_error_can_provide_voltage_or_current_later(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_CAN_PROVIDE_VOLTAGE_OR_CURRENT_LATER, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_error_power_event_occurred(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_POWER_EVENT_OCCURRED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_error_power_event_occurred(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_POWER_EVENT_OCCURRED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_error_missing_get_capabilities_message(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_MISSING_GET_CAPABILITIES_MESSAGE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_error_missing_get_capabilities_message(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_MISSING_GET_CAPABILITIES_MESSAGE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_error_protocol_error(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_PROTOCOL_ERROR); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_error_protocol_error(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_PROTOCOL_ERROR, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_error_message_data(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_MESSAGE_DATA); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_error_message_data(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_MESSAGE_DATA, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_error_discharge_failed(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_DISCHARGE_FAILED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_error_discharge_failed(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_DISCHARGE_FAILED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_sink_transition_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_SINK_TRANSITION_COMPLETE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_sink_transition_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_SINK_TRANSITION_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_ice_lake_plug_early_notification(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ICE_LAKE_PLUG_EARLY_NOTIFICATION); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_ice_lake_plug_early_notification(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ICE_LAKE_PLUG_EARLY_NOTIFICATION, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_ice_lake_prochot_notification(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ICE_LAKE_PROCHOT_NOTIFICATION); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_ice_lake_prochot_notification(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ICE_LAKE_PROCHOT_NOTIFICATION, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_error_unable_to_source(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_UNABLE_TO_SOURCE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_error_unable_to_source(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_UNABLE_TO_SOURCE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_error_bist_message_ignored(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_BIST_MESSAGE_IGNORED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_error_bist_message_ignored(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ERROR_BIST_MESSAGE_IGNORED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_am_entry_failure(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_AM_ENTRY_FAILURE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_am_entry_failure(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_AM_ENTRY_FAILURE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_am_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_AM_ENTERED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_am_entered(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_AM_ENTERED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_vendor_defined_message_sent(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_VENDOR_DEFINED_MESSAGE_SENT); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_vendor_defined_message_sent(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_VENDOR_DEFINED_MESSAGE_SENT, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_discover_mode_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_DISCOVER_MODE_COMPLETE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_discover_mode_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_DISCOVER_MODE_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_exit_mode_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_EXIT_MODE_COMPLETE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_exit_mode_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_EXIT_MODE_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_user_svid_mode_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_USER_SVID_MODE_ENTERED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_user_svid_mode_entered(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_USER_SVID_MODE_ENTERED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_user_svid_mode_exited(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_USER_SVID_MODE_EXITED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_user_svid_mode_exited(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_USER_SVID_MODE_EXITED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_user_svid_attention_vdm_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_USER_SVID_ATTENTION_VDM_RECEIVED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_user_svid_attention_vdm_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_USER_SVID_ATTENTION_VDM_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_user_svid_other_vdm_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_USER_SVID_OTHER_VDM_RECEIVED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_user_svid_other_vdm_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_USER_SVID_OTHER_VDM_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_dp_sid_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_DP_SID_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_dp_sid_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_DP_SID_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_intel_vid_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_INTEL_VID_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_intel_vid_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_INTEL_VID_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_pd3_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_PD3_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_pd3_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_PD3_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_tx_mem_buffer_empty(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_TX_MEM_BUFFER_EMPTY); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_tx_mem_buffer_empty(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_TX_MEM_BUFFER_EMPTY, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_rx_mem_buffer_full(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_RX_MEM_BUFFER_FULL); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_rx_mem_buffer_full(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_RX_MEM_BUFFER_FULL, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_custom_vdm_arrive(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_CUSTOM_VDM_ARRIVE); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_custom_vdm_arrive(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_CUSTOM_VDM_ARRIVE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_custom_am_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_CUSTOM_AM_ENTERED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_custom_am_entered(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_CUSTOM_AM_ENTERED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_custom_vdm_message_sent(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_CUSTOM_VDM_MESSAGE_SENT); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_custom_vdm_message_sent(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_CUSTOM_VDM_MESSAGE_SENT, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_soc_ack_timeout(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_SOC_ACK_TIMEOUT); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_soc_ack_timeout(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_SOC_ACK_TIMEOUT, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_frs_signal_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_FRS_SIGNAL_RECEIVED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_frs_signal_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_FRS_SIGNAL_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_chunk_response_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_CHUNK_RESPONSE_RECEIVED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_chunk_response_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_CHUNK_RESPONSE_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_chunk_request_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_CHUNK_REQUEST_RECEIVED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_chunk_request_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_CHUNK_REQUEST_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_alert_message_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ALERT_MESSAGE_RECEIVED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_alert_message_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_ALERT_MESSAGE_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_patch_loaded(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_PATCH_LOADED); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_patch_loaded(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_PATCH_LOADED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c1_ready_for_patch(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C1_READY_FOR_PATCH); }
+static inline void tps65987_set_interrupt_mask_for_i2c1_ready_for_patch(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C1_READY_FOR_PATCH, v); }
+
+/*
+* 0x17 Interrupt Mask for I2C2, 11 bytes, RW
+*/
+#define  TPS_REG_INTERRUPT_MASK_FOR_I2C2                  0x17
+#define  TPS_REG_INTERRUPT_MASK_FOR_I2C2_LEN              11
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_SOFT_RESET           0, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_HARD_RESET           1, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_CABLE_RESET_EVENT    2, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_PLUG_INSERT_OR_REMOVAL 3, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_PR_SWAP_COMPLETE     4, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_DR_SWAP_COMPLETE     5, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_FR_SWAP_COMPLETE     6, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_RDO_RECEIVED_FROM_SINK 7, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_BUILT_IN_SELF_TEST   8, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_OVERCURRENT_EVENT    9, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_ATTENTION_RECEIVED   10, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_VENDOR_DEFINED_MESSAGE_RECEIVED 11, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_NEW_CONTRACT_AS_CONSUMER 12, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_NEW_CONTRACT_AS_PROVIDER 13, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_SOURCE_CAPABILITIES_MESSAGE_READY 14, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_SINK_CAPABILITIES_MESSAGE_READY 15, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_LOW_VOLTAGE_WARNING  16, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_PR_SWAP_REQUESTED    17, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_DR_SWAP_REQUESTED    18, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_GOTO_MIN_RECEIVED    19, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_USB_HOST_PRESENT     20, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_USB_HOST_PRESENT_NO_LONGER 21, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_HIGH_VOLTAGE_WARNING 22, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_PP_SWITCH_CHANGED    23, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_POWER_STATUS_UPDATE  24, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_DATA_STATUS_UPDATE   25, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_STATUS_UPDATE        26, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_PD_STATUS_UPDATE     27, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_VCONN_SWAP_COMPLETE  28, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_VCONN_SWAP_REQUESTED 29, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_CMD1_COMPLETE        30, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_CMD2_COMPLETE        31, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_DEVICE_INCOMPATIBLE 32, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_CANNOT_PROVIDE_VOLTAGE_OR_CURRENT 33, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_CAN_PROVIDE_VOLTAGE_OR_CURRENT_LATER 34, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_POWER_EVENT_OCCURRED 35, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_MISSING_GET_CAPABILITIES_MESSAGE 36, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_PROTOCOL_ERROR 38, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_MESSAGE_DATA   39, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_DISCHARGE_FAILED 41, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_SINK_TRANSITION_COMPLETE 42, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_ICE_LAKE_PLUG_EARLY_NOTIFICATION 43, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_ICE_LAKE_PROCHOT_NOTIFICATION 44, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_UNABLE_TO_SOURCE 46, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_BIST_MESSAGE_IGNORED 47, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_AM_ENTRY_FAILURE     48, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_AM_ENTERED           49, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_VENDOR_DEFINED_MESSAGE_SENT 50, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_DISCOVER_MODE_COMPLETE 51, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_EXIT_MODE_COMPLETE   52, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_USER_SVID_MODE_ENTERED 56, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_USER_SVID_MODE_EXITED 57, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_USER_SVID_ATTENTION_VDM_RECEIVED 58, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_USER_SVID_OTHER_VDM_RECEIVED 59, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_DP_SID_STATUS_UPDATE 62, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_INTEL_VID_STATUS_UPDATE 63, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_PD3_STATUS_UPDATE    64, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_TX_MEM_BUFFER_EMPTY  65, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_RX_MEM_BUFFER_FULL   66, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_CUSTOM_VDM_ARRIVE    67, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_CUSTOM_AM_ENTERED    68, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_CUSTOM_VDM_MESSAGE_SENT 69, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_SOC_ACK_TIMEOUT      70, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_FRS_SIGNAL_RECEIVED  76, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_CHUNK_RESPONSE_RECEIVED 77, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_CHUNK_REQUEST_RECEIVED 78, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_ALERT_MESSAGE_RECEIVED 79, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_PATCH_LOADED         80, 1
+#define  TPS_INTERRUPT_MASK_FOR_I2C2_READY_FOR_PATCH      81, 1
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_soft_reset(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_SOFT_RESET); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_soft_reset(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_SOFT_RESET, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_hard_reset(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_HARD_RESET); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_hard_reset(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_HARD_RESET, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_cable_reset_event(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_CABLE_RESET_EVENT); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_cable_reset_event(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_CABLE_RESET_EVENT, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_plug_insert_or_removal(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_PLUG_INSERT_OR_REMOVAL); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_plug_insert_or_removal(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_PLUG_INSERT_OR_REMOVAL, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_pr_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_PR_SWAP_COMPLETE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_pr_swap_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_PR_SWAP_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_dr_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_DR_SWAP_COMPLETE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_dr_swap_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_DR_SWAP_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_fr_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_FR_SWAP_COMPLETE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_fr_swap_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_FR_SWAP_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_rdo_received_from_sink(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_RDO_RECEIVED_FROM_SINK); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_rdo_received_from_sink(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_RDO_RECEIVED_FROM_SINK, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_built_in_self_test(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_BUILT_IN_SELF_TEST); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_built_in_self_test(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_BUILT_IN_SELF_TEST, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_overcurrent_event(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_OVERCURRENT_EVENT); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_overcurrent_event(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_OVERCURRENT_EVENT, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_attention_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ATTENTION_RECEIVED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_attention_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ATTENTION_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_vendor_defined_message_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_VENDOR_DEFINED_MESSAGE_RECEIVED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_vendor_defined_message_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_VENDOR_DEFINED_MESSAGE_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_new_contract_as_consumer(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_NEW_CONTRACT_AS_CONSUMER); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_new_contract_as_consumer(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_NEW_CONTRACT_AS_CONSUMER, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_new_contract_as_provider(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_NEW_CONTRACT_AS_PROVIDER); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_new_contract_as_provider(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_NEW_CONTRACT_AS_PROVIDER, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_source_capabilities_message_ready(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_SOURCE_CAPABILITIES_MESSAGE_READY); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_source_capabilities_message_ready(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_SOURCE_CAPABILITIES_MESSAGE_READY, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_sink_capabilities_message_ready(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_SINK_CAPABILITIES_MESSAGE_READY); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_sink_capabilities_message_ready(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_SINK_CAPABILITIES_MESSAGE_READY, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_low_voltage_warning(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_LOW_VOLTAGE_WARNING); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_low_voltage_warning(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_LOW_VOLTAGE_WARNING, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_pr_swap_requested(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_PR_SWAP_REQUESTED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_pr_swap_requested(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_PR_SWAP_REQUESTED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_dr_swap_requested(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_DR_SWAP_REQUESTED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_dr_swap_requested(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_DR_SWAP_REQUESTED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_goto_min_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_GOTO_MIN_RECEIVED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_goto_min_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_GOTO_MIN_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_usb_host_present(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_USB_HOST_PRESENT); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_usb_host_present(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_USB_HOST_PRESENT, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_usb_host_present_no_longer(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_USB_HOST_PRESENT_NO_LONGER); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_usb_host_present_no_longer(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_USB_HOST_PRESENT_NO_LONGER, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_high_voltage_warning(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_HIGH_VOLTAGE_WARNING); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_high_voltage_warning(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_HIGH_VOLTAGE_WARNING, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_pp_switch_changed(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_PP_SWITCH_CHANGED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_pp_switch_changed(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_PP_SWITCH_CHANGED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_power_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_POWER_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_power_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_POWER_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_data_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_DATA_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_data_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_DATA_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_pd_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_PD_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_pd_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_PD_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_vconn_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_VCONN_SWAP_COMPLETE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_vconn_swap_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_VCONN_SWAP_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_vconn_swap_requested(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_VCONN_SWAP_REQUESTED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_vconn_swap_requested(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_VCONN_SWAP_REQUESTED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_cmd1_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_CMD1_COMPLETE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_cmd1_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_CMD1_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_cmd2_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_CMD2_COMPLETE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_cmd2_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_CMD2_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_error_device_incompatible(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_DEVICE_INCOMPATIBLE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_error_device_incompatible(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_DEVICE_INCOMPATIBLE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_error_cannot_provide_voltage_or_current(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_CANNOT_PROVIDE_VOLTAGE_OR_CURRENT); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_error_cannot_provide_voltage_or_current(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_CANNOT_PROVIDE_VOLTAGE_OR_CURRENT, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_error_can_provide_voltage_or_current_later(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_CAN_PROVIDE_VOLTAGE_OR_CURRENT_LATER); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_error_can_provide_voltage_or_current_later(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_CAN_PROVIDE_VOLTAGE_OR_CURRENT_LATER, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_error_power_event_occurred(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_POWER_EVENT_OCCURRED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_error_power_event_occurred(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_POWER_EVENT_OCCURRED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_error_missing_get_capabilities_message(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_MISSING_GET_CAPABILITIES_MESSAGE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_error_missing_get_capabilities_message(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_MISSING_GET_CAPABILITIES_MESSAGE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_error_protocol_error(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_PROTOCOL_ERROR); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_error_protocol_error(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_PROTOCOL_ERROR, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_error_message_data(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_MESSAGE_DATA); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_error_message_data(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_MESSAGE_DATA, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_error_discharge_failed(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_DISCHARGE_FAILED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_error_discharge_failed(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_DISCHARGE_FAILED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_sink_transition_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_SINK_TRANSITION_COMPLETE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_sink_transition_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_SINK_TRANSITION_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_ice_lake_plug_early_notification(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ICE_LAKE_PLUG_EARLY_NOTIFICATION); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_ice_lake_plug_early_notification(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ICE_LAKE_PLUG_EARLY_NOTIFICATION, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_ice_lake_prochot_notification(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ICE_LAKE_PROCHOT_NOTIFICATION); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_ice_lake_prochot_notification(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ICE_LAKE_PROCHOT_NOTIFICATION, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_error_unable_to_source(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_UNABLE_TO_SOURCE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_error_unable_to_source(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_UNABLE_TO_SOURCE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_error_bist_message_ignored(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_BIST_MESSAGE_IGNORED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_error_bist_message_ignored(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ERROR_BIST_MESSAGE_IGNORED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_am_entry_failure(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_AM_ENTRY_FAILURE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_am_entry_failure(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_AM_ENTRY_FAILURE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_am_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_AM_ENTERED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_am_entered(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_AM_ENTERED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_vendor_defined_message_sent(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_VENDOR_DEFINED_MESSAGE_SENT); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_vendor_defined_message_sent(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_VENDOR_DEFINED_MESSAGE_SENT, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_discover_mode_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_DISCOVER_MODE_COMPLETE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_discover_mode_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_DISCOVER_MODE_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_exit_mode_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_EXIT_MODE_COMPLETE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_exit_mode_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_EXIT_MODE_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_user_svid_mode_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_USER_SVID_MODE_ENTERED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_user_svid_mode_entered(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_USER_SVID_MODE_ENTERED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_user_svid_mode_exited(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_USER_SVID_MODE_EXITED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_user_svid_mode_exited(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_USER_SVID_MODE_EXITED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_user_svid_attention_vdm_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_USER_SVID_ATTENTION_VDM_RECEIVED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_user_svid_attention_vdm_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_USER_SVID_ATTENTION_VDM_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_user_svid_other_vdm_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_USER_SVID_OTHER_VDM_RECEIVED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_user_svid_other_vdm_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_USER_SVID_OTHER_VDM_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_dp_sid_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_DP_SID_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_dp_sid_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_DP_SID_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_intel_vid_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_INTEL_VID_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_intel_vid_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_INTEL_VID_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_pd3_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_PD3_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_pd3_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_PD3_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_tx_mem_buffer_empty(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_TX_MEM_BUFFER_EMPTY); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_tx_mem_buffer_empty(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_TX_MEM_BUFFER_EMPTY, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_rx_mem_buffer_full(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_RX_MEM_BUFFER_FULL); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_rx_mem_buffer_full(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_RX_MEM_BUFFER_FULL, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_custom_vdm_arrive(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_CUSTOM_VDM_ARRIVE); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_custom_vdm_arrive(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_CUSTOM_VDM_ARRIVE, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_custom_am_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_CUSTOM_AM_ENTERED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_custom_am_entered(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_CUSTOM_AM_ENTERED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_custom_vdm_message_sent(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_CUSTOM_VDM_MESSAGE_SENT); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_custom_vdm_message_sent(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_CUSTOM_VDM_MESSAGE_SENT, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_soc_ack_timeout(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_SOC_ACK_TIMEOUT); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_soc_ack_timeout(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_SOC_ACK_TIMEOUT, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_frs_signal_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_FRS_SIGNAL_RECEIVED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_frs_signal_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_FRS_SIGNAL_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_chunk_response_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_CHUNK_RESPONSE_RECEIVED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_chunk_response_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_CHUNK_RESPONSE_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_chunk_request_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_CHUNK_REQUEST_RECEIVED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_chunk_request_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_CHUNK_REQUEST_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_alert_message_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ALERT_MESSAGE_RECEIVED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_alert_message_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_ALERT_MESSAGE_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_patch_loaded(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_PATCH_LOADED); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_patch_loaded(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_PATCH_LOADED, v); }
+static inline unsigned int tps65987_interrupt_mask_for_i2c2_ready_for_patch(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_MASK_FOR_I2C2_READY_FOR_PATCH); }
+static inline void tps65987_set_interrupt_mask_for_i2c2_ready_for_patch(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_MASK_FOR_I2C2_READY_FOR_PATCH, v); }
+
+/*
+* 0x18 Interrupt Clear for I2C1, 11 bytes, DRW
+*/
+#define  TPS_REG_INTERRUPT_CLEAR_FOR_I2C1                 0x18
+#define  TPS_REG_INTERRUPT_CLEAR_FOR_I2C1_LEN             11
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_SOFT_RESET          0, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_HARD_RESET          1, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_CABLE_RESET_EVENT   2, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_PLUG_INSERT_OR_REMOVAL 3, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_PR_SWAP_COMPLETE    4, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_DR_SWAP_COMPLETE    5, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_FR_SWAP_COMPLETE    6, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_RDO_RECEIVED_FROM_SINK 7, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_BUILT_IN_SELF_TEST  8, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_OVERCURRENT_EVENT   9, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_ATTENTION_RECEIVED  10, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_VENDOR_DEFINED_MESSAGE_RECEIVED 11, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_NEW_CONTRACT_AS_CONSUMER 12, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_NEW_CONTRACT_AS_PROVIDER 13, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_SOURCE_CAPABILITIES_MESSAGE_READY 14, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_SINK_CAPABILITIES_MESSAGE_READY 15, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_LOW_VOLTAGE_WARNING 16, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_PR_SWAP_REQUESTED   17, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_DR_SWAP_REQUESTED   18, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_GOTO_MIN_RECEIVED   19, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_USB_HOST_PRESENT    20, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_USB_HOST_PRESENT_NO_LONGER 21, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_HIGH_VOLTAGE_WARNING 22, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_PP_SWITCH_CHANGED   23, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_POWER_STATUS_UPDATE 24, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_DATA_STATUS_UPDATE  25, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_STATUS_UPDATE       26, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_PD_STATUS_UPDATE    27, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_VCONN_SWAP_COMPLETE 28, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_VCONN_SWAP_REQUESTED 29, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_CMD1_COMPLETE       30, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_CMD2_COMPLETE       31, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_DEVICE_INCOMPATIBLE 32, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_CANNOT_PROVIDE_VOLTAGE_OR_CURRENT 33, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_CAN_PROVIDE_VOLTAGE_OR_CURRENT_LATER 34, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_POWER_EVENT_OCCURRED 35, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_MISSING_GET_CAPABILITIES_MESSAGE 36, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_PROTOCOL_ERROR 38, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_MESSAGE_DATA  39, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_DISCHARGE_FAILED 41, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_SINK_TRANSITION_COMPLETE 42, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_ICE_LAKE_PLUG_EARLY_NOTIFICATION 43, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_ICE_LAKE_PROCHOT_NOTIFICATION 44, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_UNABLE_TO_SOURCE 46, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_BIST_MESSAGE_IGNORED 47, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_AM_ENTRY_FAILURE    48, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_AM_ENTERED          49, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_VENDOR_DEFINED_MESSAGE_SENT 50, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_DISCOVER_MODE_COMPLETE 51, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_EXIT_MODE_COMPLETE  52, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_USER_SVID_MODE_ENTERED 56, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_USER_SVID_MODE_EXITED 57, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_USER_SVID_ATTENTION_VDM_RECEIVED 58, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_USER_SVID_OTHER_VDM_RECEIVED 59, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_DP_SID_STATUS_UPDATE 62, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_INTEL_VID_STATUS_UPDATE 63, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_PD3_STATUS_UPDATE   64, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_TX_MEM_BUFFER_EMPTY 65, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_RX_MEM_BUFFER_FULL  66, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_CUSTOM_VDM_ARRIVE   67, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_CUSTOM_AM_ENTERED   68, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_CUSTOM_VDM_MESSAGE_SENT 69, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_SOC_ACK_TIMEOUT     70, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_FRS_SIGNAL_RECEIVED 76, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_CHUNK_RESPONSE_RECEIVED 77, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_CHUNK_REQUEST_RECEIVED 78, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_ALERT_MESSAGE_RECEIVED 79, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_PATCH_LOADED        80, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C1_READY_FOR_PATCH     81, 1
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_soft_reset(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_SOFT_RESET); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_soft_reset(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_SOFT_RESET, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_hard_reset(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_HARD_RESET); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_hard_reset(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_HARD_RESET, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_cable_reset_event(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_CABLE_RESET_EVENT); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_cable_reset_event(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_CABLE_RESET_EVENT, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_plug_insert_or_removal(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_PLUG_INSERT_OR_REMOVAL); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_plug_insert_or_removal(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_PLUG_INSERT_OR_REMOVAL, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_pr_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_PR_SWAP_COMPLETE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_pr_swap_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_PR_SWAP_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_dr_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_DR_SWAP_COMPLETE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_dr_swap_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_DR_SWAP_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_fr_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_FR_SWAP_COMPLETE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_fr_swap_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_FR_SWAP_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_rdo_received_from_sink(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_RDO_RECEIVED_FROM_SINK); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_rdo_received_from_sink(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_RDO_RECEIVED_FROM_SINK, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_built_in_self_test(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_BUILT_IN_SELF_TEST); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_built_in_self_test(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_BUILT_IN_SELF_TEST, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_overcurrent_event(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_OVERCURRENT_EVENT); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_overcurrent_event(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_OVERCURRENT_EVENT, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_attention_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ATTENTION_RECEIVED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_attention_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ATTENTION_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_vendor_defined_message_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_VENDOR_DEFINED_MESSAGE_RECEIVED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_vendor_defined_message_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_VENDOR_DEFINED_MESSAGE_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_new_contract_as_consumer(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_NEW_CONTRACT_AS_CONSUMER); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_new_contract_as_consumer(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_NEW_CONTRACT_AS_CONSUMER, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_new_contract_as_provider(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_NEW_CONTRACT_AS_PROVIDER); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_new_contract_as_provider(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_NEW_CONTRACT_AS_PROVIDER, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_source_capabilities_message_ready(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_SOURCE_CAPABILITIES_MESSAGE_READY); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_source_capabilities_message_ready(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_SOURCE_CAPABILITIES_MESSAGE_READY, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_sink_capabilities_message_ready(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_SINK_CAPABILITIES_MESSAGE_READY); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_sink_capabilities_message_ready(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_SINK_CAPABILITIES_MESSAGE_READY, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_low_voltage_warning(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_LOW_VOLTAGE_WARNING); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_low_voltage_warning(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_LOW_VOLTAGE_WARNING, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_pr_swap_requested(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_PR_SWAP_REQUESTED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_pr_swap_requested(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_PR_SWAP_REQUESTED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_dr_swap_requested(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_DR_SWAP_REQUESTED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_dr_swap_requested(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_DR_SWAP_REQUESTED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_goto_min_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_GOTO_MIN_RECEIVED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_goto_min_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_GOTO_MIN_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_usb_host_present(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_USB_HOST_PRESENT); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_usb_host_present(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_USB_HOST_PRESENT, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_usb_host_present_no_longer(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_USB_HOST_PRESENT_NO_LONGER); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_usb_host_present_no_longer(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_USB_HOST_PRESENT_NO_LONGER, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_high_voltage_warning(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_HIGH_VOLTAGE_WARNING); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_high_voltage_warning(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_HIGH_VOLTAGE_WARNING, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_pp_switch_changed(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_PP_SWITCH_CHANGED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_pp_switch_changed(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_PP_SWITCH_CHANGED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_power_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_POWER_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_power_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_POWER_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_data_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_DATA_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_data_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_DATA_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_pd_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_PD_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_pd_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_PD_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_vconn_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_VCONN_SWAP_COMPLETE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_vconn_swap_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_VCONN_SWAP_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_vconn_swap_requested(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_VCONN_SWAP_REQUESTED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_vconn_swap_requested(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_VCONN_SWAP_REQUESTED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_cmd1_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_CMD1_COMPLETE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_cmd1_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_CMD1_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_cmd2_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_CMD2_COMPLETE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_cmd2_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_CMD2_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_error_device_incompatible(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_DEVICE_INCOMPATIBLE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_error_device_incompatible(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_DEVICE_INCOMPATIBLE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_error_cannot_provide_voltage_or_current(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_CANNOT_PROVIDE_VOLTAGE_OR_CURRENT); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_error_cannot_provide_voltage_or_current(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_CANNOT_PROVIDE_VOLTAGE_OR_CURRENT, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_error_can_provide_voltage_or_current_later(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_CAN_PROVIDE_VOLTAGE_OR_CURRENT_LATER); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_error_can_provide_voltage_or_current_later(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_CAN_PROVIDE_VOLTAGE_OR_CURRENT_LATER, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_error_power_event_occurred(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_POWER_EVENT_OCCURRED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_error_power_event_occurred(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_POWER_EVENT_OCCURRED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_error_missing_get_capabilities_message(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_MISSING_GET_CAPABILITIES_MESSAGE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_error_missing_get_capabilities_message(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_MISSING_GET_CAPABILITIES_MESSAGE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_error_protocol_error(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_PROTOCOL_ERROR); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_error_protocol_error(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_PROTOCOL_ERROR, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_error_message_data(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_MESSAGE_DATA); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_error_message_data(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_MESSAGE_DATA, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_error_discharge_failed(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_DISCHARGE_FAILED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_error_discharge_failed(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_DISCHARGE_FAILED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_sink_transition_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_SINK_TRANSITION_COMPLETE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_sink_transition_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_SINK_TRANSITION_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_ice_lake_plug_early_notification(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ICE_LAKE_PLUG_EARLY_NOTIFICATION); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_ice_lake_plug_early_notification(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ICE_LAKE_PLUG_EARLY_NOTIFICATION, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_ice_lake_prochot_notification(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ICE_LAKE_PROCHOT_NOTIFICATION); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_ice_lake_prochot_notification(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ICE_LAKE_PROCHOT_NOTIFICATION, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_error_unable_to_source(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_UNABLE_TO_SOURCE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_error_unable_to_source(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_UNABLE_TO_SOURCE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_error_bist_message_ignored(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_BIST_MESSAGE_IGNORED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_error_bist_message_ignored(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ERROR_BIST_MESSAGE_IGNORED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_am_entry_failure(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_AM_ENTRY_FAILURE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_am_entry_failure(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_AM_ENTRY_FAILURE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_am_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_AM_ENTERED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_am_entered(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_AM_ENTERED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_vendor_defined_message_sent(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_VENDOR_DEFINED_MESSAGE_SENT); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_vendor_defined_message_sent(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_VENDOR_DEFINED_MESSAGE_SENT, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_discover_mode_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_DISCOVER_MODE_COMPLETE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_discover_mode_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_DISCOVER_MODE_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_exit_mode_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_EXIT_MODE_COMPLETE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_exit_mode_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_EXIT_MODE_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_user_svid_mode_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_USER_SVID_MODE_ENTERED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_user_svid_mode_entered(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_USER_SVID_MODE_ENTERED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_user_svid_mode_exited(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_USER_SVID_MODE_EXITED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_user_svid_mode_exited(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_USER_SVID_MODE_EXITED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_user_svid_attention_vdm_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_USER_SVID_ATTENTION_VDM_RECEIVED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_user_svid_attention_vdm_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_USER_SVID_ATTENTION_VDM_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_user_svid_other_vdm_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_USER_SVID_OTHER_VDM_RECEIVED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_user_svid_other_vdm_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_USER_SVID_OTHER_VDM_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_dp_sid_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_DP_SID_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_dp_sid_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_DP_SID_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_intel_vid_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_INTEL_VID_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_intel_vid_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_INTEL_VID_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_pd3_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_PD3_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_pd3_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_PD3_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_tx_mem_buffer_empty(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_TX_MEM_BUFFER_EMPTY); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_tx_mem_buffer_empty(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_TX_MEM_BUFFER_EMPTY, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_rx_mem_buffer_full(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_RX_MEM_BUFFER_FULL); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_rx_mem_buffer_full(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_RX_MEM_BUFFER_FULL, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_custom_vdm_arrive(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_CUSTOM_VDM_ARRIVE); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_custom_vdm_arrive(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_CUSTOM_VDM_ARRIVE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_custom_am_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_CUSTOM_AM_ENTERED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_custom_am_entered(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_CUSTOM_AM_ENTERED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_custom_vdm_message_sent(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_CUSTOM_VDM_MESSAGE_SENT); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_custom_vdm_message_sent(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_CUSTOM_VDM_MESSAGE_SENT, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_soc_ack_timeout(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_SOC_ACK_TIMEOUT); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_soc_ack_timeout(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_SOC_ACK_TIMEOUT, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_frs_signal_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_FRS_SIGNAL_RECEIVED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_frs_signal_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_FRS_SIGNAL_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_chunk_response_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_CHUNK_RESPONSE_RECEIVED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_chunk_response_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_CHUNK_RESPONSE_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_chunk_request_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_CHUNK_REQUEST_RECEIVED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_chunk_request_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_CHUNK_REQUEST_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_alert_message_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ALERT_MESSAGE_RECEIVED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_alert_message_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_ALERT_MESSAGE_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_patch_loaded(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_PATCH_LOADED); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_patch_loaded(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_PATCH_LOADED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c1_ready_for_patch(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_READY_FOR_PATCH); }
+static inline void tps65987_set_interrupt_clear_for_i2c1_ready_for_patch(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C1_READY_FOR_PATCH, v); }
+
+/*
+* 0x19 Interrupt Clear for I2C2, 11 bytes, DRW
+*/
+#define  TPS_REG_INTERRUPT_CLEAR_FOR_I2C2                 0x19
+#define  TPS_REG_INTERRUPT_CLEAR_FOR_I2C2_LEN             11
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_SOFT_RESET          0, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_HARD_RESET          1, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_CABLE_RESET_EVENT   2, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_PLUG_INSERT_OR_REMOVAL 3, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_PR_SWAP_COMPLETE    4, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_DR_SWAP_COMPLETE    5, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_FR_SWAP_COMPLETE    6, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_RDO_RECEIVED_FROM_SINK 7, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_BUILT_IN_SELF_TEST  8, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_OVERCURRENT_EVENT   9, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_ATTENTION_RECEIVED  10, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_VENDOR_DEFINED_MESSAGE_RECEIVED 11, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_NEW_CONTRACT_AS_CONSUMER 12, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_NEW_CONTRACT_AS_PROVIDER 13, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_SOURCE_CAPABILITIES_MESSAGE_READY 14, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_SINK_CAPABILITIES_MESSAGE_READY 15, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_LOW_VOLTAGE_WARNING 16, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_PR_SWAP_REQUESTED   17, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_DR_SWAP_REQUESTED   18, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_GOTO_MIN_RECEIVED   19, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_USB_HOST_PRESENT    20, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_USB_HOST_PRESENT_NO_LONGER 21, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_HIGH_VOLTAGE_WARNING 22, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_PP_SWITCH_CHANGED   23, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_POWER_STATUS_UPDATE 24, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_DATA_STATUS_UPDATE  25, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_STATUS_UPDATE       26, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_PD_STATUS_UPDATE    27, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_VCONN_SWAP_COMPLETE 28, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_VCONN_SWAP_REQUESTED 29, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_CMD1_COMPLETE       30, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_CMD2_COMPLETE       31, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_DEVICE_INCOMPATIBLE 32, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_CANNOT_PROVIDE_VOLTAGE_OR_CURRENT 33, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_CAN_PROVIDE_VOLTAGE_OR_CURRENT_LATER 34, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_POWER_EVENT_OCCURRED 35, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_MISSING_GET_CAPABILITIES_MESSAGE 36, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_PROTOCOL_ERROR 38, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_MESSAGE_DATA  39, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_DISCHARGE_FAILED 41, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_SINK_TRANSITION_COMPLETE 42, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_ICE_LAKE_PLUG_EARLY_NOTIFICATION 43, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_ICE_LAKE_PROCHOT_NOTIFICATION 44, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_UNABLE_TO_SOURCE 46, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_BIST_MESSAGE_IGNORED 47, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_AM_ENTRY_FAILURE    48, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_AM_ENTERED          49, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_VENDOR_DEFINED_MESSAGE_SENT 50, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_DISCOVER_MODE_COMPLETE 51, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_EXIT_MODE_COMPLETE  52, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_USER_SVID_MODE_ENTERED 56, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_USER_SVID_MODE_EXITED 57, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_USER_SVID_ATTENTION_VDM_RECEIVED 58, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_USER_SVID_OTHER_VDM_RECEIVED 59, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_DP_SID_STATUS_UPDATE 62, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_INTEL_VID_STATUS_UPDATE 63, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_PD3_STATUS_UPDATE   64, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_TX_MEM_BUFFER_EMPTY 65, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_RX_MEM_BUFFER_FULL  66, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_CUSTOM_VDM_ARRIVE   67, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_CUSTOM_AM_ENTERED   68, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_CUSTOM_VDM_MESSAGE_SENT 69, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_SOC_ACK_TIMEOUT     70, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_FRS_SIGNAL_RECEIVED 76, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_CHUNK_RESPONSE_RECEIVED 77, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_CHUNK_REQUEST_RECEIVED 78, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_ALERT_MESSAGE_RECEIVED 79, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_PATCH_LOADED        80, 1
+#define  TPS_INTERRUPT_CLEAR_FOR_I2C2_READY_FOR_PATCH     81, 1
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_soft_reset(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_SOFT_RESET); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_soft_reset(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_SOFT_RESET, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_hard_reset(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_HARD_RESET); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_hard_reset(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_HARD_RESET, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_cable_reset_event(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_CABLE_RESET_EVENT); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_cable_reset_event(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_CABLE_RESET_EVENT, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_plug_insert_or_removal(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_PLUG_INSERT_OR_REMOVAL); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_plug_insert_or_removal(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_PLUG_INSERT_OR_REMOVAL, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_pr_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_PR_SWAP_COMPLETE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_pr_swap_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_PR_SWAP_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_dr_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_DR_SWAP_COMPLETE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_dr_swap_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_DR_SWAP_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_fr_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_FR_SWAP_COMPLETE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_fr_swap_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_FR_SWAP_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_rdo_received_from_sink(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_RDO_RECEIVED_FROM_SINK); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_rdo_received_from_sink(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_RDO_RECEIVED_FROM_SINK, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_built_in_self_test(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_BUILT_IN_SELF_TEST); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_built_in_self_test(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_BUILT_IN_SELF_TEST, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_overcurrent_event(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_OVERCURRENT_EVENT); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_overcurrent_event(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_OVERCURRENT_EVENT, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_attention_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ATTENTION_RECEIVED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_attention_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ATTENTION_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_vendor_defined_message_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_VENDOR_DEFINED_MESSAGE_RECEIVED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_vendor_defined_message_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_VENDOR_DEFINED_MESSAGE_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_new_contract_as_consumer(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_NEW_CONTRACT_AS_CONSUMER); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_new_contract_as_consumer(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_NEW_CONTRACT_AS_CONSUMER, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_new_contract_as_provider(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_NEW_CONTRACT_AS_PROVIDER); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_new_contract_as_provider(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_NEW_CONTRACT_AS_PROVIDER, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_source_capabilities_message_ready(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_SOURCE_CAPABILITIES_MESSAGE_READY); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_source_capabilities_message_ready(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_SOURCE_CAPABILITIES_MESSAGE_READY, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_sink_capabilities_message_ready(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_SINK_CAPABILITIES_MESSAGE_READY); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_sink_capabilities_message_ready(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_SINK_CAPABILITIES_MESSAGE_READY, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_low_voltage_warning(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_LOW_VOLTAGE_WARNING); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_low_voltage_warning(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_LOW_VOLTAGE_WARNING, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_pr_swap_requested(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_PR_SWAP_REQUESTED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_pr_swap_requested(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_PR_SWAP_REQUESTED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_dr_swap_requested(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_DR_SWAP_REQUESTED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_dr_swap_requested(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_DR_SWAP_REQUESTED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_goto_min_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_GOTO_MIN_RECEIVED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_goto_min_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_GOTO_MIN_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_usb_host_present(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_USB_HOST_PRESENT); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_usb_host_present(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_USB_HOST_PRESENT, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_usb_host_present_no_longer(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_USB_HOST_PRESENT_NO_LONGER); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_usb_host_present_no_longer(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_USB_HOST_PRESENT_NO_LONGER, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_high_voltage_warning(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_HIGH_VOLTAGE_WARNING); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_high_voltage_warning(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_HIGH_VOLTAGE_WARNING, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_pp_switch_changed(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_PP_SWITCH_CHANGED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_pp_switch_changed(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_PP_SWITCH_CHANGED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_power_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_POWER_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_power_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_POWER_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_data_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_DATA_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_data_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_DATA_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_pd_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_PD_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_pd_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_PD_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_vconn_swap_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_VCONN_SWAP_COMPLETE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_vconn_swap_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_VCONN_SWAP_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_vconn_swap_requested(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_VCONN_SWAP_REQUESTED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_vconn_swap_requested(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_VCONN_SWAP_REQUESTED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_cmd1_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_CMD1_COMPLETE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_cmd1_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_CMD1_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_cmd2_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_CMD2_COMPLETE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_cmd2_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_CMD2_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_error_device_incompatible(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_DEVICE_INCOMPATIBLE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_error_device_incompatible(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_DEVICE_INCOMPATIBLE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_error_cannot_provide_voltage_or_current(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_CANNOT_PROVIDE_VOLTAGE_OR_CURRENT); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_error_cannot_provide_voltage_or_current(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_CANNOT_PROVIDE_VOLTAGE_OR_CURRENT, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_error_can_provide_voltage_or_current_later(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_CAN_PROVIDE_VOLTAGE_OR_CURRENT_LATER); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_error_can_provide_voltage_or_current_later(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_CAN_PROVIDE_VOLTAGE_OR_CURRENT_LATER, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_error_power_event_occurred(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_POWER_EVENT_OCCURRED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_error_power_event_occurred(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_POWER_EVENT_OCCURRED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_error_missing_get_capabilities_message(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_MISSING_GET_CAPABILITIES_MESSAGE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_error_missing_get_capabilities_message(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_MISSING_GET_CAPABILITIES_MESSAGE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_error_protocol_error(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_PROTOCOL_ERROR); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_error_protocol_error(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_PROTOCOL_ERROR, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_error_message_data(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_MESSAGE_DATA); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_error_message_data(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_MESSAGE_DATA, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_error_discharge_failed(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_DISCHARGE_FAILED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_error_discharge_failed(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_DISCHARGE_FAILED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_sink_transition_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_SINK_TRANSITION_COMPLETE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_sink_transition_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_SINK_TRANSITION_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_ice_lake_plug_early_notification(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ICE_LAKE_PLUG_EARLY_NOTIFICATION); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_ice_lake_plug_early_notification(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ICE_LAKE_PLUG_EARLY_NOTIFICATION, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_ice_lake_prochot_notification(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ICE_LAKE_PROCHOT_NOTIFICATION); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_ice_lake_prochot_notification(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ICE_LAKE_PROCHOT_NOTIFICATION, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_error_unable_to_source(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_UNABLE_TO_SOURCE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_error_unable_to_source(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_UNABLE_TO_SOURCE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_error_bist_message_ignored(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_BIST_MESSAGE_IGNORED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_error_bist_message_ignored(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ERROR_BIST_MESSAGE_IGNORED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_am_entry_failure(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_AM_ENTRY_FAILURE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_am_entry_failure(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_AM_ENTRY_FAILURE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_am_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_AM_ENTERED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_am_entered(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_AM_ENTERED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_vendor_defined_message_sent(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_VENDOR_DEFINED_MESSAGE_SENT); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_vendor_defined_message_sent(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_VENDOR_DEFINED_MESSAGE_SENT, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_discover_mode_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_DISCOVER_MODE_COMPLETE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_discover_mode_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_DISCOVER_MODE_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_exit_mode_complete(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_EXIT_MODE_COMPLETE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_exit_mode_complete(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_EXIT_MODE_COMPLETE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_user_svid_mode_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_USER_SVID_MODE_ENTERED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_user_svid_mode_entered(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_USER_SVID_MODE_ENTERED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_user_svid_mode_exited(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_USER_SVID_MODE_EXITED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_user_svid_mode_exited(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_USER_SVID_MODE_EXITED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_user_svid_attention_vdm_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_USER_SVID_ATTENTION_VDM_RECEIVED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_user_svid_attention_vdm_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_USER_SVID_ATTENTION_VDM_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_user_svid_other_vdm_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_USER_SVID_OTHER_VDM_RECEIVED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_user_svid_other_vdm_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_USER_SVID_OTHER_VDM_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_dp_sid_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_DP_SID_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_dp_sid_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_DP_SID_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_intel_vid_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_INTEL_VID_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_intel_vid_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_INTEL_VID_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_pd3_status_update(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_PD3_STATUS_UPDATE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_pd3_status_update(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_PD3_STATUS_UPDATE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_tx_mem_buffer_empty(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_TX_MEM_BUFFER_EMPTY); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_tx_mem_buffer_empty(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_TX_MEM_BUFFER_EMPTY, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_rx_mem_buffer_full(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_RX_MEM_BUFFER_FULL); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_rx_mem_buffer_full(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_RX_MEM_BUFFER_FULL, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_custom_vdm_arrive(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_CUSTOM_VDM_ARRIVE); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_custom_vdm_arrive(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_CUSTOM_VDM_ARRIVE, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_custom_am_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_CUSTOM_AM_ENTERED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_custom_am_entered(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_CUSTOM_AM_ENTERED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_custom_vdm_message_sent(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_CUSTOM_VDM_MESSAGE_SENT); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_custom_vdm_message_sent(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_CUSTOM_VDM_MESSAGE_SENT, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_soc_ack_timeout(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_SOC_ACK_TIMEOUT); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_soc_ack_timeout(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_SOC_ACK_TIMEOUT, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_frs_signal_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_FRS_SIGNAL_RECEIVED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_frs_signal_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_FRS_SIGNAL_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_chunk_response_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_CHUNK_RESPONSE_RECEIVED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_chunk_response_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_CHUNK_RESPONSE_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_chunk_request_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_CHUNK_REQUEST_RECEIVED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_chunk_request_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_CHUNK_REQUEST_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_alert_message_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ALERT_MESSAGE_RECEIVED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_alert_message_received(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_ALERT_MESSAGE_RECEIVED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_patch_loaded(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_PATCH_LOADED); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_patch_loaded(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_PATCH_LOADED, v); }
+static inline unsigned int tps65987_interrupt_clear_for_i2c2_ready_for_patch(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_READY_FOR_PATCH); }
+static inline void tps65987_set_interrupt_clear_for_i2c2_ready_for_patch(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTERRUPT_CLEAR_FOR_I2C2_READY_FOR_PATCH, v); }
+
+/*
+* 0x1A Status, 6 bytes, DRO
+*/
+#define  TPS_REG_STATUS                                   0x1A
+#define  TPS_REG_STATUS_LEN                               6
+#define  TPS_STATUS_PLUG_PRESENT                          0, 1
+#define  TPS_STATUS_CONN_STATE                            1, 3
+#define  TPS_STATUS_PLUG_ORIENTATION                      4, 1
+#define  TPS_STATUS_PORT_ROLE                             5, 1
+#define  TPS_STATUS_DATA_ROLE                             6, 1
+#define  TPS_STATUS_VBUS_STATUS                           20, 2
+#define  TPS_STATUS_USB_HOST_PRESENT                      22, 2
+#define  TPS_STATUS_ACTING_AS_LEGACY                      24, 2
+#define  TPS_STATUS_GO_TO_MIN_ACTIVE                      26, 1
+#define  TPS_STATUS_BIST                                  27, 1
+#define  TPS_STATUS_HIGH_VOLTAGE_WARNING                  28, 1
+#define  TPS_STATUS_LOW_VOLTAGE_WARNING                   29, 1
+#define  TPS_STATUS_SOC_ACK_TIMEOUT_OCCURRED              30, 1
+#define  TPS_STATUS_ALTERNATIVE_MODE_STATUS               32, 3
+static inline unsigned int tps65987_status_plug_present(const unsigned char *buf) { return tps65987_field_get(buf, TPS_STATUS_PLUG_PRESENT); }
+static inline unsigned int tps65987_status_conn_state(const unsigned char *buf) { return tps65987_field_get(buf, TPS_STATUS_CONN_STATE); }
+static inline unsigned int tps65987_status_plug_orientation(const unsigned char *buf) { return tps65987_field_get(buf, TPS_STATUS_PLUG_ORIENTATION); }
+static inline unsigned int tps65987_status_port_role(const unsigned char *buf) { return tps65987_field_get(buf, TPS_STATUS_PORT_ROLE); }
+static inline unsigned int tps65987_status_data_role(const unsigned char *buf) { return tps65987_field_get(buf, TPS_STATUS_DATA_ROLE); }
+static inline unsigned int tps65987_status_vbus_status(const unsigned char *buf) { return tps65987_field_get(buf, TPS_STATUS_VBUS_STATUS); }
+static inline unsigned int tps65987_status_usb_host_present(const unsigned char *buf) { return tps65987_field_get(buf, TPS_STATUS_USB_HOST_PRESENT); }
+static inline unsigned int tps65987_status_acting_as_legacy(const unsigned char *buf) { return tps65987_field_get(buf, TPS_STATUS_ACTING_AS_LEGACY); }
+static inline unsigned int tps65987_status_go_to_min_active(const unsigned char *buf) { return tps65987_field_get(buf, TPS_STATUS_GO_TO_MIN_ACTIVE); }
+static inline unsigned int tps65987_status_bist(const unsigned char *buf) { return tps65987_field_get(buf, TPS_STATUS_BIST); }
+static inline unsigned int tps65987_status_high_voltage_warning(const unsigned char *buf) { return tps65987_field_get(buf, TPS_STATUS_HIGH_VOLTAGE_WARNING); }
+static inline unsigned int tps65987_status_low_voltage_warning(const unsigned char *buf) { return tps65987_field_get(buf, TPS_STATUS_LOW_VOLTAGE_WARNING); }
+static inline unsigned int tps65987_status_soc_ack_timeout_occurred(const unsigned char *buf) { return tps65987_field_get(buf, TPS_STATUS_SOC_ACK_TIMEOUT_OCCURRED); }
+static inline unsigned int tps65987_status_alternative_mode_status(const unsigned char *buf) { return tps65987_field_get(buf, TPS_STATUS_ALTERNATIVE_MODE_STATUS); }
+
+/*
+* 0x1F Data Register for CMD3, 4 bytes, DRW
+*/
+#define  TPS_REG_DATA_REGISTER_FOR_CMD3                   0x1F
+#define  TPS_REG_DATA_REGISTER_FOR_CMD3_LEN               4
+#define  TPS_DATA_REGISTER_FOR_CMD3_WORD_1_LEAST_SIGNIFICANT 0, 32
+static inline unsigned int tps65987_data_register_for_cmd3_word_1_least_significant(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_REGISTER_FOR_CMD3_WORD_1_LEAST_SIGNIFICANT); }
+static inline void tps65987_set_data_register_for_cmd3_word_1_least_significant(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_REGISTER_FOR_CMD3_WORD_1_LEAST_SIGNIFICANT, v); }
+
+/*
+* 0x20 System Power State, 1 bytes, RW
+*/
+#define  TPS_REG_SYSTEM_POWER_STATE                       0x20
+#define  TPS_REG_SYSTEM_POWER_STATE_LEN                   1
+
+/*
+* 0x22 Wake Mask, 8 bytes, DRW
+*/
+#define  TPS_REG_WAKE_MASK                                0x22
+#define  TPS_REG_WAKE_MASK_LEN                            8
+#define  TPS_WAKE_MASK_PLUG1                              0, 1
+#define  TPS_WAKE_MASK_UNPLUG1                            1, 1
+#define  TPS_WAKE_MASK_PDACTIVITY1                        2, 1
+#define  TPS_WAKE_MASK_HPD1LOW                            3, 1
+#define  TPS_WAKE_MASK_HPD1HIGH                           4, 1
+#define  TPS_WAKE_MASK_IRQ_HPD1                           5, 1
+#define  TPS_WAKE_MASK_PLUG2                              16, 1
+#define  TPS_WAKE_MASK_UNPLUG2                            17, 1
+#define  TPS_WAKE_MASK_PDACTIVITY2                        18, 1
+#define  TPS_WAKE_MASK_HPD2LOW                            19, 1
+#define  TPS_WAKE_MASK_HPD2HIGH                           20, 1
+#define  TPS_WAKE_MASK_IRQ_HPD2                           21, 1
+static inline unsigned int tps65987_wake_mask_plug1(const unsigned char *buf) { return tps65987_field_get(buf, TPS_WAKE_MASK_PLUG1); }
+static inline void tps65987_set_wake_mask_plug1(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_WAKE_MASK_PLUG1, v); }
+static inline unsigned int tps65987_wake_mask_unplug1(const unsigned char *buf) { return tps65987_field_get(buf, TPS_WAKE_MASK_UNPLUG1); }
+static inline void tps65987_set_wake_mask_unplug1(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_WAKE_MASK_UNPLUG1, v); }
+static inline unsigned int tps65987_wake_mask_pdactivity1(const unsigned char *buf) { return tps65987_field_get(buf, TPS_WAKE_MASK_PDACTIVITY1); }
+static inline void tps65987_set_wake_mask_pdactivity1(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_WAKE_MASK_PDACTIVITY1, v); }
+static inline unsigned int tps65987_wake_mask_hpd1low(const unsigned char *buf) { return tps65987_field_get(buf, TPS_WAKE_MASK_HPD1LOW); }
+static inline void tps65987_set_wake_mask_hpd1low(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_WAKE_MASK_HPD1LOW, v); }
+static inline unsigned int tps65987_wake_mask_hpd1high(const unsigned char *buf) { return tps65987_field_get(buf, TPS_WAKE_MASK_HPD1HIGH); }
+static inline void tps65987_set_wake_mask_hpd1high(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_WAKE_MASK_HPD1HIGH, v); }
+static inline unsigned int tps65987_wake_mask_irq_hpd1(const unsigned char *buf) { return tps65987_field_get(buf, TPS_WAKE_MASK_IRQ_HPD1); }
+static inline void tps65987_set_wake_mask_irq_hpd1(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_WAKE_MASK_IRQ_HPD1, v); }
+static inline unsigned int tps65987_wake_mask_plug2(const unsigned char *buf) { return tps65987_field_get(buf, TPS_WAKE_MASK_PLUG2); }
+static inline void tps65987_set_wake_mask_plug2(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_WAKE_MASK_PLUG2, v); }
+static inline unsigned int tps65987_wake_mask_unplug2(const unsigned char *buf) { return tps65987_field_get(buf, TPS_WAKE_MASK_UNPLUG2); }
+static inline void tps65987_set_wake_mask_unplug2(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_WAKE_MASK_UNPLUG2, v); }
+static inline unsigned int tps65987_wake_mask_pdactivity2(const unsigned char *buf) { return tps65987_field_get(buf, TPS_WAKE_MASK_PDACTIVITY2); }
+static inline void tps65987_set_wake_mask_pdactivity2(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_WAKE_MASK_PDACTIVITY2, v); }
+static inline unsigned int tps65987_wake_mask_hpd2low(const unsigned char *buf) { return tps65987_field_get(buf, TPS_WAKE_MASK_HPD2LOW); }
+static inline void tps65987_set_wake_mask_hpd2low(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_WAKE_MASK_HPD2LOW, v); }
+static inline unsigned int tps65987_wake_mask_hpd2high(const unsigned char *buf) { return tps65987_field_get(buf, TPS_WAKE_MASK_HPD2HIGH); }
+static inline void tps65987_set_wake_mask_hpd2high(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_WAKE_MASK_HPD2HIGH, v); }
+static inline unsigned int tps65987_wake_mask_irq_hpd2(const unsigned char *buf) { return tps65987_field_get(buf, TPS_WAKE_MASK_IRQ_HPD2); }
+static inline void tps65987_set_wake_mask_irq_hpd2(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_WAKE_MASK_IRQ_HPD2, v); }
+
+/*
+* 0x26 Power Path Status, 6 bytes, DRO
+*/
+#define  TPS_REG_POWER_PATH_STATUS                        0x26
+#define  TPS_REG_POWER_PATH_STATUS_LEN                    6
+#define  TPS_POWER_PATH_STATUS_POWERSOURCE                38, 2
+static inline unsigned int tps65987_power_path_status_powersource(const unsigned char *buf) { return tps65987_field_get(buf, TPS_POWER_PATH_STATUS_POWERSOURCE); }
+
+/*
+* 0x27 Global System Configuration, 14 bytes, RW
+*/
+#define  TPS_REG_GLOBAL_SYSTEM_CONFIGURATION              0x27
+#define  TPS_REG_GLOBAL_SYSTEM_CONFIGURATION_LEN          14
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_CABLE_1_SWITCH_CONFIG 0, 2
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_CABLE_2_SWITCH_CONFIG 2, 2
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_1_SWITCH_CONFIG 16, 3
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_2_SWITCH_CONFIG 19, 3
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_3_SWITCH_CONFIG 32, 3
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_3_SWITCH_CONFIG_2 32, 3
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_4_SWITCH_CONFIG 35, 3
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_4_SWITCH_CONFIG_2 35, 3
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_POWER_DUO_MODE   52, 1
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION__87_EMULATION_MODE 55, 1
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_PP1_SWITCH_TO_VBUS_MAP 56, 1
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_PP2_SWITCH_TO_VBUS_MAP 57, 1
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_PP3_SWITCH_TO_VBUS_MAP 58, 1
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_PP4_SWITCH_TO_VBUS_MAP 59, 1
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_SWITCH_1_OVERCURRENT_TIMEOUT 64, 4
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_SWITCH_1_OVERCURRENT_TIMEOUT_ENABLE 68, 1
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_SWITCH_2_OVERCURRENT_TIMEOUT 72, 4
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_SWITCH_2_OVERCURRENT_TIMEOUT_ENABLE 76, 1
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_I2C1_ENABLE_AS_MASTER 81, 1
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_I2C3_ENABLE_AS_MASTER 82, 1
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_I2C4_ENABLE_AS_MASTER 83, 1
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_MULTIPORT_SINK_POLICY 96, 2
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_SINK_POLICY_NON_OVERLAP_TIME 105, 2
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_MULTIPORT_ALTERNATE_MODE_POLICY 98, 2
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_EXTERNAL_PROCESSOR 100, 2
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_ICE_LAKE_ENABLE_ONE_UFP_POLICY 102, 1
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_ICE_LAKE_ENABLE_SIMPLE_SOURCE_POLICY_MANAGER 103, 1
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_TBT_CONTROLLER_I2C_PORT 107, 1
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_I2C_TIMEOUT      108, 3
+#define  TPS_GLOBAL_SYSTEM_CONFIGURATION_SPI_READ_ONLY    111, 1
+static inline unsigned int tps65987_global_system_configuration_pp_cable_1_switch_config(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_CABLE_1_SWITCH_CONFIG); }
+static inline void tps65987_set_global_system_configuration_pp_cable_1_switch_config(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_CABLE_1_SWITCH_CONFIG, v); }
+static inline unsigned int tps65987_global_system_configuration_pp_cable_2_switch_config(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_CABLE_2_SWITCH_CONFIG); }
+static inline void tps65987_set_global_system_configuration_pp_cable_2_switch_config(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_CABLE_2_SWITCH_CONFIG, v); }
+static inline unsigned int tps65987_global_system_configuration_pp_1_switch_config(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_1_SWITCH_CONFIG); }
+static inline void tps65987_set_global_system_configuration_pp_1_switch_config(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_1_SWITCH_CONFIG, v); }
+static inline unsigned int tps65987_global_system_configuration_pp_2_switch_config(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_2_SWITCH_CONFIG); }
+static inline void tps65987_set_global_system_configuration_pp_2_switch_config(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_2_SWITCH_CONFIG, v); }
+static inline unsigned int tps65987_global_system_configuration_pp_3_switch_config(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_3_SWITCH_CONFIG); }
+static inline void tps65987_set_global_system_configuration_pp_3_switch_config(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_3_SWITCH_CONFIG, v); }
+static inline unsigned int tps65987_global_system_configuration_pp_3_switch_config_2(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_3_SWITCH_CONFIG_2); }
+static inline void tps65987_set_global_system_configuration_pp_3_switch_config_2(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_3_SWITCH_CONFIG_2, v); }
+static inline unsigned int tps65987_global_system_configuration_pp_4_switch_config(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_4_SWITCH_CONFIG); }
+static inline void tps65987_set_global_system_configuration_pp_4_switch_config(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_4_SWITCH_CONFIG, v); }
+static inline unsigned int tps65987_global_system_configuration_pp_4_switch_config_2(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_4_SWITCH_CONFIG_2); }
+static inline void tps65987_set_global_system_configuration_pp_4_switch_config_2(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_4_SWITCH_CONFIG_2, v); }
+static inline unsigned int tps65987_global_system_configuration_power_duo_mode(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_POWER_DUO_MODE); }
+static inline void tps65987_set_global_system_configuration_power_duo_mode(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_POWER_DUO_MODE, v); }
+static inline unsigned int tps65987_global_system_configuration__87_emulation_mode(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION__87_EMULATION_MODE); }
+static inline void tps65987_set_global_system_configuration__87_emulation_mode(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION__87_EMULATION_MODE, v); }
+static inline unsigned int tps65987_global_system_configuration_pp1_switch_to_vbus_map(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP1_SWITCH_TO_VBUS_MAP); }
+static inline void tps65987_set_global_system_configuration_pp1_switch_to_vbus_map(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP1_SWITCH_TO_VBUS_MAP, v); }
+static inline unsigned int tps65987_global_system_configuration_pp2_switch_to_vbus_map(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP2_SWITCH_TO_VBUS_MAP); }
+static inline void tps65987_set_global_system_configuration_pp2_switch_to_vbus_map(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP2_SWITCH_TO_VBUS_MAP, v); }
+static inline unsigned int tps65987_global_system_configuration_pp3_switch_to_vbus_map(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP3_SWITCH_TO_VBUS_MAP); }
+static inline void tps65987_set_global_system_configuration_pp3_switch_to_vbus_map(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP3_SWITCH_TO_VBUS_MAP, v); }
+static inline unsigned int tps65987_global_system_configuration_pp4_switch_to_vbus_map(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP4_SWITCH_TO_VBUS_MAP); }
+static inline void tps65987_set_global_system_configuration_pp4_switch_to_vbus_map(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP4_SWITCH_TO_VBUS_MAP, v); }
+static inline unsigned int tps65987_global_system_configuration_pp_switch_1_overcurrent_timeout(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_SWITCH_1_OVERCURRENT_TIMEOUT); }
+static inline void tps65987_set_global_system_configuration_pp_switch_1_overcurrent_timeout(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_SWITCH_1_OVERCURRENT_TIMEOUT, v); }
+static inline unsigned int tps65987_global_system_configuration_pp_switch_1_overcurrent_timeout_enable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_SWITCH_1_OVERCURRENT_TIMEOUT_ENABLE); }
+static inline void tps65987_set_global_system_configuration_pp_switch_1_overcurrent_timeout_enable(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_SWITCH_1_OVERCURRENT_TIMEOUT_ENABLE, v); }
+static inline unsigned int tps65987_global_system_configuration_pp_switch_2_overcurrent_timeout(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_SWITCH_2_OVERCURRENT_TIMEOUT); }
+static inline void tps65987_set_global_system_configuration_pp_switch_2_overcurrent_timeout(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_SWITCH_2_OVERCURRENT_TIMEOUT, v); }
+static inline unsigned int tps65987_global_system_configuration_pp_switch_2_overcurrent_timeout_enable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_SWITCH_2_OVERCURRENT_TIMEOUT_ENABLE); }
+static inline void tps65987_set_global_system_configuration_pp_switch_2_overcurrent_timeout_enable(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_PP_SWITCH_2_OVERCURRENT_TIMEOUT_ENABLE, v); }
+static inline unsigned int tps65987_global_system_configuration_i2c1_enable_as_master(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_I2C1_ENABLE_AS_MASTER); }
+static inline void tps65987_set_global_system_configuration_i2c1_enable_as_master(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_I2C1_ENABLE_AS_MASTER, v); }
+static inline unsigned int tps65987_global_system_configuration_i2c3_enable_as_master(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_I2C3_ENABLE_AS_MASTER); }
+static inline void tps65987_set_global_system_configuration_i2c3_enable_as_master(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_I2C3_ENABLE_AS_MASTER, v); }
+static inline unsigned int tps65987_global_system_configuration_i2c4_enable_as_master(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_I2C4_ENABLE_AS_MASTER); }
+static inline void tps65987_set_global_system_configuration_i2c4_enable_as_master(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_I2C4_ENABLE_AS_MASTER, v); }
+static inline unsigned int tps65987_global_system_configuration_multiport_sink_policy(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_MULTIPORT_SINK_POLICY); }
+static inline void tps65987_set_global_system_configuration_multiport_sink_policy(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_MULTIPORT_SINK_POLICY, v); }
+static inline unsigned int tps65987_global_system_configuration_sink_policy_non_overlap_time(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_SINK_POLICY_NON_OVERLAP_TIME); }
+static inline void tps65987_set_global_system_configuration_sink_policy_non_overlap_time(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_SINK_POLICY_NON_OVERLAP_TIME, v); }
+static inline unsigned int tps65987_global_system_configuration_multiport_alternate_mode_policy(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_MULTIPORT_ALTERNATE_MODE_POLICY); }
+static inline void tps65987_set_global_system_configuration_multiport_alternate_mode_policy(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_MULTIPORT_ALTERNATE_MODE_POLICY, v); }
+static inline unsigned int tps65987_global_system_configuration_external_processor(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_EXTERNAL_PROCESSOR); }
+static inline void tps65987_set_global_system_configuration_external_processor(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_EXTERNAL_PROCESSOR, v); }
+static inline unsigned int tps65987_global_system_configuration_ice_lake_enable_one_ufp_policy(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_ICE_LAKE_ENABLE_ONE_UFP_POLICY); }
+static inline void tps65987_set_global_system_configuration_ice_lake_enable_one_ufp_policy(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_ICE_LAKE_ENABLE_ONE_UFP_POLICY, v); }
+static inline unsigned int tps65987_global_system_configuration_ice_lake_enable_simple_source_policy_manager(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_ICE_LAKE_ENABLE_SIMPLE_SOURCE_POLICY_MANAGER); }
+static inline void tps65987_set_global_system_configuration_ice_lake_enable_simple_source_policy_manager(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_ICE_LAKE_ENABLE_SIMPLE_SOURCE_POLICY_MANAGER, v); }
+static inline unsigned int tps65987_global_system_configuration_tbt_controller_i2c_port(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_TBT_CONTROLLER_I2C_PORT); }
+static inline void tps65987_set_global_system_configuration_tbt_controller_i2c_port(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_TBT_CONTROLLER_I2C_PORT, v); }
+static inline unsigned int tps65987_global_system_configuration_i2c_timeout(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_I2C_TIMEOUT); }
+static inline void tps65987_set_global_system_configuration_i2c_timeout(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_I2C_TIMEOUT, v); }
+static inline unsigned int tps65987_global_system_configuration_spi_read_only(const unsigned char *buf) { return tps65987_field_get(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_SPI_READ_ONLY); }
+static inline void tps65987_set_global_system_configuration_spi_read_only(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_GLOBAL_SYSTEM_CONFIGURATION_SPI_READ_ONLY, v); }
+
+/*
+* 0x28 Port Configuration, 7 bytes, RW
+*/
+#define  TPS_REG_PORT_CONFIGURATION                       0x28
+#define  TPS_REG_PORT_CONFIGURATION_LEN                   7
+#define  TPS_PORT_CONFIGURATION_PORT_CONFIGURATION        0, 2
+#define  TPS_PORT_CONFIGURATION_RECEPTACLE_TYPE           3, 3
+#define  TPS_PORT_CONFIGURATION_AUDIO_ACCESSORY_SUPPORT   6, 1
+#define  TPS_PORT_CONFIGURATION_DEBUG_ACCESSORY_SUPPORT   7, 1
+#define  TPS_PORT_CONFIGURATION_TYPE_C_SUPPORTED_OPTIONS  8, 2
+#define  TPS_PORT_CONFIGURATION_VCONN_SUPPORTED           11, 2
+#define  TPS_PORT_CONFIGURATION_USB3_0_3_1_RATE           13, 2
+#define  TPS_PORT_CONFIGURATION_SET_UVP_TO_4_5_V          16, 1
+#define  TPS_PORT_CONFIGURATION_UNDER_VOLTAGE_PROTECTION_TRIP_POINT_PP_5V 17, 3
+#define  TPS_PORT_CONFIGURATION_UNDER_VOLTAGE_PROTECTION_USAGE_PP_HV 20, 3
+#define  TPS_PORT_CONFIGURATION_OVER_VOLTAGE_PROTECTION_USAGE 29, 2
+#define  TPS_PORT_CONFIGURATION_HIGH_VOLTAGE_WARNING_LEVEL 31, 1
+#define  TPS_PORT_CONFIGURATION_LOW_VOLTAGE_WARNING_LEVEL 32, 1
+#define  TPS_PORT_CONFIGURATION_SOFT_START_SLEW_RATE      33, 2
+#define  TPS_PORT_CONFIGURATION_SET_UVP_DEBOUNCE          36, 1
+static inline unsigned int tps65987_port_configuration_port_configuration(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONFIGURATION_PORT_CONFIGURATION); }
+static inline void tps65987_set_port_configuration_port_configuration(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONFIGURATION_PORT_CONFIGURATION, v); }
+static inline unsigned int tps65987_port_configuration_receptacle_type(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONFIGURATION_RECEPTACLE_TYPE); }
+static inline void tps65987_set_port_configuration_receptacle_type(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONFIGURATION_RECEPTACLE_TYPE, v); }
+static inline unsigned int tps65987_port_configuration_audio_accessory_support(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONFIGURATION_AUDIO_ACCESSORY_SUPPORT); }
+static inline void tps65987_set_port_configuration_audio_accessory_support(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONFIGURATION_AUDIO_ACCESSORY_SUPPORT, v); }
+static inline unsigned int tps65987_port_configuration_debug_accessory_support(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONFIGURATION_DEBUG_ACCESSORY_SUPPORT); }
+static inline void tps65987_set_port_configuration_debug_accessory_support(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONFIGURATION_DEBUG_ACCESSORY_SUPPORT, v); }
+static inline unsigned int tps65987_port_configuration_type_c_supported_options(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONFIGURATION_TYPE_C_SUPPORTED_OPTIONS); }
+static inline void tps65987_set_port_configuration_type_c_supported_options(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONFIGURATION_TYPE_C_SUPPORTED_OPTIONS, v); }
+static inline unsigned int tps65987_port_configuration_vconn_supported(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONFIGURATION_VCONN_SUPPORTED); }
+static inline void tps65987_set_port_configuration_vconn_supported(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONFIGURATION_VCONN_SUPPORTED, v); }
+static inline unsigned int tps65987_port_configuration_usb3_0_3_1_rate(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONFIGURATION_USB3_0_3_1_RATE); }
+static inline void tps65987_set_port_configuration_usb3_0_3_1_rate(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONFIGURATION_USB3_0_3_1_RATE, v); }
+static inline unsigned int tps65987_port_configuration_set_uvp_to_4_5_v(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONFIGURATION_SET_UVP_TO_4_5_V); }
+static inline void tps65987_set_port_configuration_set_uvp_to_4_5_v(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONFIGURATION_SET_UVP_TO_4_5_V, v); }
+static inline unsigned int tps65987_port_configuration_under_voltage_protection_trip_point_pp_5v(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONFIGURATION_UNDER_VOLTAGE_PROTECTION_TRIP_POINT_PP_5V); }
+static inline void tps65987_set_port_configuration_under_voltage_protection_trip_point_pp_5v(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONFIGURATION_UNDER_VOLTAGE_PROTECTION_TRIP_POINT_PP_5V, v); }
+static inline unsigned int tps65987_port_configuration_under_voltage_protection_usage_pp_hv(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONFIGURATION_UNDER_VOLTAGE_PROTECTION_USAGE_PP_HV); }
+static inline void tps65987_set_port_configuration_under_voltage_protection_usage_pp_hv(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONFIGURATION_UNDER_VOLTAGE_PROTECTION_USAGE_PP_HV, v); }
+static inline unsigned int tps65987_port_configuration_over_voltage_protection_usage(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONFIGURATION_OVER_VOLTAGE_PROTECTION_USAGE); }
+static inline void tps65987_set_port_configuration_over_voltage_protection_usage(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONFIGURATION_OVER_VOLTAGE_PROTECTION_USAGE, v); }
+static inline unsigned int tps65987_port_configuration_high_voltage_warning_level(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONFIGURATION_HIGH_VOLTAGE_WARNING_LEVEL); }
+static inline void tps65987_set_port_configuration_high_voltage_warning_level(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONFIGURATION_HIGH_VOLTAGE_WARNING_LEVEL, v); }
+static inline unsigned int tps65987_port_configuration_low_voltage_warning_level(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONFIGURATION_LOW_VOLTAGE_WARNING_LEVEL); }
+static inline void tps65987_set_port_configuration_low_voltage_warning_level(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONFIGURATION_LOW_VOLTAGE_WARNING_LEVEL, v); }
+static inline unsigned int tps65987_port_configuration_soft_start_slew_rate(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONFIGURATION_SOFT_START_SLEW_RATE); }
+static inline void tps65987_set_port_configuration_soft_start_slew_rate(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONFIGURATION_SOFT_START_SLEW_RATE, v); }
+static inline unsigned int tps65987_port_configuration_set_uvp_debounce(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONFIGURATION_SET_UVP_DEBOUNCE); }
+static inline void tps65987_set_port_configuration_set_uvp_debounce(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONFIGURATION_SET_UVP_DEBOUNCE, v); }
+
+/*
+* 0x29 Port Control, 4 bytes, RW
+*/
+#define  TPS_REG_PORT_CONTROL                             0x29
+#define  TPS_REG_PORT_CONTROL_LEN                         4
+#define  TPS_PORT_CONTROL_TYPE_C_CURRENT                  0, 2
+#define  TPS_PORT_CONTROL_PD_MODE                         2, 2
+#define  TPS_PORT_CONTROL_PROCESS_SWAP_TO_SINK            4, 1
+#define  TPS_PORT_CONTROL_INITIATE_SWAP_TO_SINK           5, 1
+#define  TPS_PORT_CONTROL_PROCESS_SWAP_TO_SOURCE          6, 1
+#define  TPS_PORT_CONTROL_INITIATE_SWAP_TO_SOURCE         7, 1
+#define  TPS_PORT_CONTROL_PROCESS_VCONN_SWAP              10, 1
+#define  TPS_PORT_CONTROL_PROCESS_SWAP_TO_UFP             12, 1
+#define  TPS_PORT_CONTROL_INITIATE_SWAP_TO_UFP            13, 1
+#define  TPS_PORT_CONTROL_PROCESS_SWAP_TO_DFP             14, 1
+#define  TPS_PORT_CONTROL_INITIATE_SWAP_TO_DFP            15, 1
+#define  TPS_PORT_CONTROL_AUTOMATIC_ID_REQUEST            16, 1
+#define  TPS_PORT_CONTROL_AM_INTRUSIVE_MODE               17, 1
+#define  TPS_PORT_CONTROL_FORCE_USB_GENERATION_1          18, 1
+#define  TPS_PORT_CONTROL_EXTERNALLY_POWERED              19, 1
+#define  TPS_PORT_CONTROL_AUTOMATIC_SINK_CAP              20, 1
+#define  TPS_PORT_CONTROL_SINK_CONTROL_BIT                21, 1
+#define  TPS_PORT_CONTROL__15_KOHM_RESISTOR_PRESENT       24, 1
+#define  TPS_PORT_CONTROL_DATA_CONTACT_DETECTION_ENABLE   25, 1
+#define  TPS_PORT_CONTROL_CHARGER_ADVERTISE_ENABLE        26, 3
+#define  TPS_PORT_CONTROL_USB_DISABLE                     29, 1
+#define  TPS_PORT_CONTROL_CHARGER_DETECT_ENABLE           30, 2
+static inline unsigned int tps65987_port_control_type_c_current(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_TYPE_C_CURRENT); }
+static inline void tps65987_set_port_control_type_c_current(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_TYPE_C_CURRENT, v); }
+static inline unsigned int tps65987_port_control_pd_mode(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_PD_MODE); }
+static inline void tps65987_set_port_control_pd_mode(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_PD_MODE, v); }
+static inline unsigned int tps65987_port_control_process_swap_to_sink(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_PROCESS_SWAP_TO_SINK); }
+static inline void tps65987_set_port_control_process_swap_to_sink(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_PROCESS_SWAP_TO_SINK, v); }
+static inline unsigned int tps65987_port_control_initiate_swap_to_sink(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_INITIATE_SWAP_TO_SINK); }
+static inline void tps65987_set_port_control_initiate_swap_to_sink(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_INITIATE_SWAP_TO_SINK, v); }
+static inline unsigned int tps65987_port_control_process_swap_to_source(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_PROCESS_SWAP_TO_SOURCE); }
+static inline void tps65987_set_port_control_process_swap_to_source(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_PROCESS_SWAP_TO_SOURCE, v); }
+static inline unsigned int tps65987_port_control_initiate_swap_to_source(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_INITIATE_SWAP_TO_SOURCE); }
+static inline void tps65987_set_port_control_initiate_swap_to_source(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_INITIATE_SWAP_TO_SOURCE, v); }
+static inline unsigned int tps65987_port_control_process_vconn_swap(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_PROCESS_VCONN_SWAP); }
+static inline void tps65987_set_port_control_process_vconn_swap(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_PROCESS_VCONN_SWAP, v); }
+static inline unsigned int tps65987_port_control_process_swap_to_ufp(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_PROCESS_SWAP_TO_UFP); }
+static inline void tps65987_set_port_control_process_swap_to_ufp(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_PROCESS_SWAP_TO_UFP, v); }
+static inline unsigned int tps65987_port_control_initiate_swap_to_ufp(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_INITIATE_SWAP_TO_UFP); }
+static inline void tps65987_set_port_control_initiate_swap_to_ufp(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_INITIATE_SWAP_TO_UFP, v); }
+static inline unsigned int tps65987_port_control_process_swap_to_dfp(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_PROCESS_SWAP_TO_DFP); }
+static inline void tps65987_set_port_control_process_swap_to_dfp(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_PROCESS_SWAP_TO_DFP, v); }
+static inline unsigned int tps65987_port_control_initiate_swap_to_dfp(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_INITIATE_SWAP_TO_DFP); }
+static inline void tps65987_set_port_control_initiate_swap_to_dfp(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_INITIATE_SWAP_TO_DFP, v); }
+static inline unsigned int tps65987_port_control_automatic_id_request(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_AUTOMATIC_ID_REQUEST); }
+static inline void tps65987_set_port_control_automatic_id_request(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_AUTOMATIC_ID_REQUEST, v); }
+static inline unsigned int tps65987_port_control_am_intrusive_mode(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_AM_INTRUSIVE_MODE); }
+static inline void tps65987_set_port_control_am_intrusive_mode(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_AM_INTRUSIVE_MODE, v); }
+static inline unsigned int tps65987_port_control_force_usb_generation_1(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_FORCE_USB_GENERATION_1); }
+static inline void tps65987_set_port_control_force_usb_generation_1(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_FORCE_USB_GENERATION_1, v); }
+static inline unsigned int tps65987_port_control_externally_powered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_EXTERNALLY_POWERED); }
+static inline void tps65987_set_port_control_externally_powered(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_EXTERNALLY_POWERED, v); }
+static inline unsigned int tps65987_port_control_automatic_sink_cap(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_AUTOMATIC_SINK_CAP); }
+static inline void tps65987_set_port_control_automatic_sink_cap(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_AUTOMATIC_SINK_CAP, v); }
+static inline unsigned int tps65987_port_control_sink_control_bit(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_SINK_CONTROL_BIT); }
+static inline void tps65987_set_port_control_sink_control_bit(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_SINK_CONTROL_BIT, v); }
+static inline unsigned int tps65987_port_control__15_kohm_resistor_present(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL__15_KOHM_RESISTOR_PRESENT); }
+static inline void tps65987_set_port_control__15_kohm_resistor_present(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL__15_KOHM_RESISTOR_PRESENT, v); }
+static inline unsigned int tps65987_port_control_data_contact_detection_enable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_DATA_CONTACT_DETECTION_ENABLE); }
+static inline void tps65987_set_port_control_data_contact_detection_enable(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_DATA_CONTACT_DETECTION_ENABLE, v); }
+static inline unsigned int tps65987_port_control_charger_advertise_enable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_CHARGER_ADVERTISE_ENABLE); }
+static inline void tps65987_set_port_control_charger_advertise_enable(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_CHARGER_ADVERTISE_ENABLE, v); }
+static inline unsigned int tps65987_port_control_usb_disable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_USB_DISABLE); }
+static inline void tps65987_set_port_control_usb_disable(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_USB_DISABLE, v); }
+static inline unsigned int tps65987_port_control_charger_detect_enable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PORT_CONTROL_CHARGER_DETECT_ENABLE); }
+static inline void tps65987_set_port_control_charger_detect_enable(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PORT_CONTROL_CHARGER_DETECT_ENABLE, v); }
+
+/*
+* 0x2B Miscellaneous Configuration, 2 bytes, RW
+*/
+#define  TPS_REG_MISCELLANEOUS_CONFIGURATION              0x2B
+#define  TPS_REG_MISCELLANEOUS_CONFIGURATION_LEN          2
+#define  TPS_MISCELLANEOUS_CONFIGURATION_I2C1_VOLTAGE_LEVEL 4, 1
+#define  TPS_MISCELLANEOUS_CONFIGURATION_I2C2_VOLTAGE_LEVEL 5, 1
+#define  TPS_MISCELLANEOUS_CONFIGURATION_SUPPORT_DP_ACTIVE_CABLE 6, 1
+#define  TPS_MISCELLANEOUS_CONFIGURATION_RELAX_OCP_ON_VOLTAGE_TRANSITIONS 8, 1
+static inline unsigned int tps65987_miscellaneous_configuration_i2c1_voltage_level(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MISCELLANEOUS_CONFIGURATION_I2C1_VOLTAGE_LEVEL); }
+static inline void tps65987_set_miscellaneous_configuration_i2c1_voltage_level(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_MISCELLANEOUS_CONFIGURATION_I2C1_VOLTAGE_LEVEL, v); }
+static inline unsigned int tps65987_miscellaneous_configuration_i2c2_voltage_level(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MISCELLANEOUS_CONFIGURATION_I2C2_VOLTAGE_LEVEL); }
+static inline void tps65987_set_miscellaneous_configuration_i2c2_voltage_level(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_MISCELLANEOUS_CONFIGURATION_I2C2_VOLTAGE_LEVEL, v); }
+static inline unsigned int tps65987_miscellaneous_configuration_support_dp_active_cable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MISCELLANEOUS_CONFIGURATION_SUPPORT_DP_ACTIVE_CABLE); }
+static inline void tps65987_set_miscellaneous_configuration_support_dp_active_cable(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_MISCELLANEOUS_CONFIGURATION_SUPPORT_DP_ACTIVE_CABLE, v); }
+static inline unsigned int tps65987_miscellaneous_configuration_relax_ocp_on_voltage_transitions(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MISCELLANEOUS_CONFIGURATION_RELAX_OCP_ON_VOLTAGE_TRANSITIONS); }
+static inline void tps65987_set_miscellaneous_configuration_relax_ocp_on_voltage_transitions(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_MISCELLANEOUS_CONFIGURATION_RELAX_OCP_ON_VOLTAGE_TRANSITIONS, v); }
+
+/*
+* 0x2D Boot Flags, 12 bytes, DRO
+*/
+#define  TPS_REG_BOOT_FLAGS                               0x2D
+#define  TPS_REG_BOOT_FLAGS_LEN                           12
+#define  TPS_BOOT_FLAGS_PATCH_HEADER_ERROR                0, 1
+#define  TPS_BOOT_FLAGS_DEAD_BATTERY_FLAG                 2, 1
+#define  TPS_BOOT_FLAGS_SPI_FLASH_PRESENT                 3, 1
+#define  TPS_BOOT_FLAGS_REGION_0                          4, 1
+#define  TPS_BOOT_FLAGS_REGION_1                          5, 1
+#define  TPS_BOOT_FLAGS_REGION_0_INVALID                  6, 1
+#define  TPS_BOOT_FLAGS_REGION_1_INVALID                  7, 1
+#define  TPS_BOOT_FLAGS_REGION_0_FLASH_ERROR              8, 1
+#define  TPS_BOOT_FLAGS_REGION_1_FLASH_ERROR              9, 1
+#define  TPS_BOOT_FLAGS_PATCH_DOWNLOAD_ERROR              10, 1
+#define  TPS_BOOT_FLAGS_REGION_0_CRC_FAIL                 12, 1
+#define  TPS_BOOT_FLAGS_REGION_1_CRC_FAIL                 13, 1
+#define  TPS_BOOT_FLAGS_CUSTOMER_OTP_INVALID              14, 1
+#define  TPS_BOOT_FLAGS_PP1_SWITCH                        17, 1
+#define  TPS_BOOT_FLAGS_PP2_SWITCH                        18, 1
+#define  TPS_BOOT_FLAGS_PP3_SWITCH                        19, 1
+#define  TPS_BOOT_FLAGS_PP4_SWITCH                        20, 1
+#define  TPS_BOOT_FLAGS_CUSTOMER_OTP_VALID                32, 2
+#define  TPS_BOOT_FLAGS_OTP_CUSTOMER_DEAD_BATTERY         34, 2
+#define  TPS_BOOT_FLAGS_OTP_I2C_ADDRESS_6_5_FOR_I2C2      36, 2
+#define  TPS_BOOT_FLAGS_OTP_CUSTOMER_TBT_PRESENT          38, 1
+#define  TPS_BOOT_FLAGS_OTP_CUSTOMER_I2C_THRESHOLD        39, 1
+#define  TPS_BOOT_FLAGS_OTP_CUSTOMER_TBT_CONTROLLER_TYPE  40, 2
+#define  TPS_BOOT_FLAGS_OTP_CUSTOMER_DISABLE_PD           42, 1
+#define  TPS_BOOT_FLAGS_REVISION_ID_METAL                 63, 3
+#define  TPS_BOOT_FLAGS_REVISION_ID_BASE                  66, 3
+static inline unsigned int tps65987_boot_flags_patch_header_error(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_PATCH_HEADER_ERROR); }
+static inline unsigned int tps65987_boot_flags_dead_battery_flag(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_DEAD_BATTERY_FLAG); }
+static inline unsigned int tps65987_boot_flags_spi_flash_present(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_SPI_FLASH_PRESENT); }
+static inline unsigned int tps65987_boot_flags_region_0(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_REGION_0); }
+static inline unsigned int tps65987_boot_flags_region_1(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_REGION_1); }
+static inline unsigned int tps65987_boot_flags_region_0_invalid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_REGION_0_INVALID); }
+static inline unsigned int tps65987_boot_flags_region_1_invalid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_REGION_1_INVALID); }
+static inline unsigned int tps65987_boot_flags_region_0_flash_error(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_REGION_0_FLASH_ERROR); }
+static inline unsigned int tps65987_boot_flags_region_1_flash_error(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_REGION_1_FLASH_ERROR); }
+static inline unsigned int tps65987_boot_flags_patch_download_error(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_PATCH_DOWNLOAD_ERROR); }
+static inline unsigned int tps65987_boot_flags_region_0_crc_fail(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_REGION_0_CRC_FAIL); }
+static inline unsigned int tps65987_boot_flags_region_1_crc_fail(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_REGION_1_CRC_FAIL); }
+static inline unsigned int tps65987_boot_flags_customer_otp_invalid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_CUSTOMER_OTP_INVALID); }
+static inline unsigned int tps65987_boot_flags_pp1_switch(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_PP1_SWITCH); }
+static inline unsigned int tps65987_boot_flags_pp2_switch(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_PP2_SWITCH); }
+static inline unsigned int tps65987_boot_flags_pp3_switch(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_PP3_SWITCH); }
+static inline unsigned int tps65987_boot_flags_pp4_switch(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_PP4_SWITCH); }
+static inline unsigned int tps65987_boot_flags_customer_otp_valid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_CUSTOMER_OTP_VALID); }
+static inline unsigned int tps65987_boot_flags_otp_customer_dead_battery(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_OTP_CUSTOMER_DEAD_BATTERY); }
+static inline unsigned int tps65987_boot_flags_otp_i2c_address_6_5_for_i2c2(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_OTP_I2C_ADDRESS_6_5_FOR_I2C2); }
+static inline unsigned int tps65987_boot_flags_otp_customer_tbt_present(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_OTP_CUSTOMER_TBT_PRESENT); }
+static inline unsigned int tps65987_boot_flags_otp_customer_i2c_threshold(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_OTP_CUSTOMER_I2C_THRESHOLD); }
+static inline unsigned int tps65987_boot_flags_otp_customer_tbt_controller_type(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_OTP_CUSTOMER_TBT_CONTROLLER_TYPE); }
+static inline unsigned int tps65987_boot_flags_otp_customer_disable_pd(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_OTP_CUSTOMER_DISABLE_PD); }
+static inline unsigned int tps65987_boot_flags_revision_id_metal(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_REVISION_ID_METAL); }
+static inline unsigned int tps65987_boot_flags_revision_id_base(const unsigned char *buf) { return tps65987_field_get(buf, TPS_BOOT_FLAGS_REVISION_ID_BASE); }
+
+/*
+* 0x2E Build Identifier, 49 bytes, DRO
+*/
+#define  TPS_REG_BUILD_IDENTIFIER                         0x2E
+#define  TPS_REG_BUILD_IDENTIFIER_LEN                     49
+#define  TPS_BUILD_IDENTIFIER_BUILD_IDENTIFIER            0, 392
+
+/*
+* 0x2F Device Info, 47 bytes, DRO
+*/
+#define  TPS_REG_DEVICE_INFO                              0x2F
+#define  TPS_REG_DEVICE_INFO_LEN                          47
+#define  TPS_DEVICE_INFO_DEVICE_INFO                      0, 376
+
+/*
+* 0x30 Received Source Capabilities, 29 bytes, DRO
+*/
+#define  TPS_REG_RECEIVED_SOURCE_CAPABILITIES             0x30
+#define  TPS_REG_RECEIVED_SOURCE_CAPABILITIES_LEN         29
+#define  TPS_RECEIVED_SOURCE_CAPABILITIES_NUMBER_OF_SOURCE_PDOS 0, 3
+static inline unsigned int tps65987_received_source_capabilities_number_of_source_pdos(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_SOURCE_CAPABILITIES_NUMBER_OF_SOURCE_PDOS); }
+
+/*
+* 0x31 Received Sink Capabilities, 57 bytes, DRO
+*/
+#define  TPS_REG_RECEIVED_SINK_CAPABILITIES               0x31
+#define  TPS_REG_RECEIVED_SINK_CAPABILITIES_LEN           57
+#define  TPS_RECEIVED_SINK_CAPABILITIES_NUMBER_OF_SINK_PDOS 0, 3
+static inline unsigned int tps65987_received_sink_capabilities_number_of_sink_pdos(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_SINK_CAPABILITIES_NUMBER_OF_SINK_PDOS); }
+
+/*
+* 0x32 Transmit Source Capabilities, 64 bytes, RW
+*/
+#define  TPS_REG_TRANSMIT_SOURCE_CAPABILITIES             0x32
+#define  TPS_REG_TRANSMIT_SOURCE_CAPABILITIES_LEN         64
+#define  TPS_TRANSMIT_SOURCE_CAPABILITIES_ACTIVE_PDO_BANK 16, 1
+#define  TPS_TRANSMIT_SOURCE_CAPABILITIES_ACTIVE_PDO_BANK_FOLLOWS_EP 17, 1
+#define  TPS_TRANSMIT_SOURCE_CAPABILITIES_TRANSMIT_SOURCE_SEND_PENDING 23, 1
+#define  TPS_TRANSMIT_SOURCE_CAPABILITIES_NUMBER_OF_BANK_0_SOURCE_PDOS 64, 3
+#define  TPS_TRANSMIT_SOURCE_CAPABILITIES_NUMBER_OF_BANK_1_SOURCE_PDOS 291, 3
+static inline unsigned int tps65987_transmit_source_capabilities_active_pdo_bank(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMIT_SOURCE_CAPABILITIES_ACTIVE_PDO_BANK); }
+static inline void tps65987_set_transmit_source_capabilities_active_pdo_bank(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMIT_SOURCE_CAPABILITIES_ACTIVE_PDO_BANK, v); }
+static inline unsigned int tps65987_transmit_source_capabilities_active_pdo_bank_follows_ep(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMIT_SOURCE_CAPABILITIES_ACTIVE_PDO_BANK_FOLLOWS_EP); }
+static inline void tps65987_set_transmit_source_capabilities_active_pdo_bank_follows_ep(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMIT_SOURCE_CAPABILITIES_ACTIVE_PDO_BANK_FOLLOWS_EP, v); }
+static inline unsigned int tps65987_transmit_source_capabilities_transmit_source_send_pending(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMIT_SOURCE_CAPABILITIES_TRANSMIT_SOURCE_SEND_PENDING); }
+static inline void tps65987_set_transmit_source_capabilities_transmit_source_send_pending(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMIT_SOURCE_CAPABILITIES_TRANSMIT_SOURCE_SEND_PENDING, v); }
+static inline unsigned int tps65987_transmit_source_capabilities_number_of_bank_0_source_pdos(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMIT_SOURCE_CAPABILITIES_NUMBER_OF_BANK_0_SOURCE_PDOS); }
+static inline void tps65987_set_transmit_source_capabilities_number_of_bank_0_source_pdos(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMIT_SOURCE_CAPABILITIES_NUMBER_OF_BANK_0_SOURCE_PDOS, v); }
+static inline unsigned int tps65987_transmit_source_capabilities_number_of_bank_1_source_pdos(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMIT_SOURCE_CAPABILITIES_NUMBER_OF_BANK_1_SOURCE_PDOS); }
+static inline void tps65987_set_transmit_source_capabilities_number_of_bank_1_source_pdos(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMIT_SOURCE_CAPABILITIES_NUMBER_OF_BANK_1_SOURCE_PDOS, v); }
+
+/*
+* 0x33 Transmit Sink Capabilities, 57 bytes, RW
+*/
+#define  TPS_REG_TRANSMIT_SINK_CAPABILITIES               0x33
+#define  TPS_REG_TRANSMIT_SINK_CAPABILITIES_LEN           57
+#define  TPS_TRANSMIT_SINK_CAPABILITIES_NUMBER_OF_SINK_PDOS 0, 3
+static inline unsigned int tps65987_transmit_sink_capabilities_number_of_sink_pdos(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMIT_SINK_CAPABILITIES_NUMBER_OF_SINK_PDOS); }
+static inline void tps65987_set_transmit_sink_capabilities_number_of_sink_pdos(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMIT_SINK_CAPABILITIES_NUMBER_OF_SINK_PDOS, v); }
+
+/*
+* 0x34 Active Contract PDO, 4 bytes, DRO
+*/
+#define  TPS_REG_ACTIVE_CONTRACT_PDO                      0x34
+#define  TPS_REG_ACTIVE_CONTRACT_PDO_LEN                  4
+
+/*
+* 0x35 Active Contract RDO, 4 bytes, DRO
+*/
+#define  TPS_REG_ACTIVE_CONTRACT_RDO                      0x35
+#define  TPS_REG_ACTIVE_CONTRACT_RDO_LEN                  4
+#define  TPS_ACTIVE_CONTRACT_RDO_NO_USB_SUSPEND           24, 1
+#define  TPS_ACTIVE_CONTRACT_RDO_USB_COMMUNICATION_CAPABLE 25, 1
+#define  TPS_ACTIVE_CONTRACT_RDO_CAPABILITY_MISMATCH      26, 1
+#define  TPS_ACTIVE_CONTRACT_RDO_GIVEBACK_FLAG            27, 1
+#define  TPS_ACTIVE_CONTRACT_RDO_OBJECT_POSITION          28, 3
+static inline unsigned int tps65987_active_contract_rdo_no_usb_suspend(const unsigned char *buf) { return tps65987_field_get(buf, TPS_ACTIVE_CONTRACT_RDO_NO_USB_SUSPEND); }
+static inline unsigned int tps65987_active_contract_rdo_usb_communication_capable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_ACTIVE_CONTRACT_RDO_USB_COMMUNICATION_CAPABLE); }
+static inline unsigned int tps65987_active_contract_rdo_capability_mismatch(const unsigned char *buf) { return tps65987_field_get(buf, TPS_ACTIVE_CONTRACT_RDO_CAPABILITY_MISMATCH); }
+static inline unsigned int tps65987_active_contract_rdo_giveback_flag(const unsigned char *buf) { return tps65987_field_get(buf, TPS_ACTIVE_CONTRACT_RDO_GIVEBACK_FLAG); }
+static inline unsigned int tps65987_active_contract_rdo_object_position(const unsigned char *buf) { return tps65987_field_get(buf, TPS_ACTIVE_CONTRACT_RDO_OBJECT_POSITION); }
+
+/*
+* 0x36 Sink Request RDO, 4 bytes, DRO
+*/
+#define  TPS_REG_SINK_REQUEST_RDO                         0x36
+#define  TPS_REG_SINK_REQUEST_RDO_LEN                     4
+#define  TPS_SINK_REQUEST_RDO_NO_USB_SUSPEND              24, 1
+#define  TPS_SINK_REQUEST_RDO_USB_COMMUNICATION_CAPABLE   25, 1
+#define  TPS_SINK_REQUEST_RDO_CAPABILITY_MISMATCH         26, 1
+#define  TPS_SINK_REQUEST_RDO_GIVEBACK_FLAG               27, 1
+#define  TPS_SINK_REQUEST_RDO_OBJECT_POSITION             28, 3
+static inline unsigned int tps65987_sink_request_rdo_no_usb_suspend(const unsigned char *buf) { return tps65987_field_get(buf, TPS_SINK_REQUEST_RDO_NO_USB_SUSPEND); }
+static inline unsigned int tps65987_sink_request_rdo_usb_communication_capable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_SINK_REQUEST_RDO_USB_COMMUNICATION_CAPABLE); }
+static inline unsigned int tps65987_sink_request_rdo_capability_mismatch(const unsigned char *buf) { return tps65987_field_get(buf, TPS_SINK_REQUEST_RDO_CAPABILITY_MISMATCH); }
+static inline unsigned int tps65987_sink_request_rdo_giveback_flag(const unsigned char *buf) { return tps65987_field_get(buf, TPS_SINK_REQUEST_RDO_GIVEBACK_FLAG); }
+static inline unsigned int tps65987_sink_request_rdo_object_position(const unsigned char *buf) { return tps65987_field_get(buf, TPS_SINK_REQUEST_RDO_OBJECT_POSITION); }
+
+/*
+* 0x37 Autonegotiate Sink, 12 bytes, RW
+*/
+#define  TPS_REG_AUTONEGOTIATE_SINK                       0x37
+#define  TPS_REG_AUTONEGOTIATE_SINK_LEN                   12
+#define  TPS_AUTONEGOTIATE_SINK_AUTONEGOTIATE_SINK_ENABLE 0, 1
+#define  TPS_AUTONEGOTIATE_SINK_AUTONEGOTIATE_VARIABLE_SINK_ENABLE 2, 1
+#define  TPS_AUTONEGOTIATE_SINK_AUTONEGOTIATE_BATTERY_SINK_ENABLE 1, 1
+#define  TPS_AUTONEGOTIATE_SINK_USB_COMMUNICATION_CAPABLE 3, 1
+#define  TPS_AUTONEGOTIATE_SINK_OFFER_PRIORITY            4, 2
+#define  TPS_AUTONEGOTIATE_SINK_NO_USB_SUSPEND            6, 1
+#define  TPS_AUTONEGOTIATE_SINK_GIVEBACK_FLAG             7, 1
+#define  TPS_AUTONEGOTIATE_SINK_AUTO_COMPUTE_SINK_MIN_POWER 8, 1
+static inline unsigned int tps65987_autonegotiate_sink_autonegotiate_sink_enable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_AUTONEGOTIATE_SINK_AUTONEGOTIATE_SINK_ENABLE); }
+static inline void tps65987_set_autonegotiate_sink_autonegotiate_sink_enable(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_AUTONEGOTIATE_SINK_AUTONEGOTIATE_SINK_ENABLE, v); }
+static inline unsigned int tps65987_autonegotiate_sink_autonegotiate_variable_sink_enable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_AUTONEGOTIATE_SINK_AUTONEGOTIATE_VARIABLE_SINK_ENABLE); }
+static inline void tps65987_set_autonegotiate_sink_autonegotiate_variable_sink_enable(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_AUTONEGOTIATE_SINK_AUTONEGOTIATE_VARIABLE_SINK_ENABLE, v); }
+static inline unsigned int tps65987_autonegotiate_sink_autonegotiate_battery_sink_enable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_AUTONEGOTIATE_SINK_AUTONEGOTIATE_BATTERY_SINK_ENABLE); }
+static inline void tps65987_set_autonegotiate_sink_autonegotiate_battery_sink_enable(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_AUTONEGOTIATE_SINK_AUTONEGOTIATE_BATTERY_SINK_ENABLE, v); }
+static inline unsigned int tps65987_autonegotiate_sink_usb_communication_capable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_AUTONEGOTIATE_SINK_USB_COMMUNICATION_CAPABLE); }
+static inline void tps65987_set_autonegotiate_sink_usb_communication_capable(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_AUTONEGOTIATE_SINK_USB_COMMUNICATION_CAPABLE, v); }
+static inline unsigned int tps65987_autonegotiate_sink_offer_priority(const unsigned char *buf) { return tps65987_field_get(buf, TPS_AUTONEGOTIATE_SINK_OFFER_PRIORITY); }
+static inline void tps65987_set_autonegotiate_sink_offer_priority(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_AUTONEGOTIATE_SINK_OFFER_PRIORITY, v); }
+static inline unsigned int tps65987_autonegotiate_sink_no_usb_suspend(const unsigned char *buf) { return tps65987_field_get(buf, TPS_AUTONEGOTIATE_SINK_NO_USB_SUSPEND); }
+static inline void tps65987_set_autonegotiate_sink_no_usb_suspend(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_AUTONEGOTIATE_SINK_NO_USB_SUSPEND, v); }
+static inline unsigned int tps65987_autonegotiate_sink_giveback_flag(const unsigned char *buf) { return tps65987_field_get(buf, TPS_AUTONEGOTIATE_SINK_GIVEBACK_FLAG); }
+static inline void tps65987_set_autonegotiate_sink_giveback_flag(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_AUTONEGOTIATE_SINK_GIVEBACK_FLAG, v); }
+static inline unsigned int tps65987_autonegotiate_sink_auto_compute_sink_min_power(const unsigned char *buf) { return tps65987_field_get(buf, TPS_AUTONEGOTIATE_SINK_AUTO_COMPUTE_SINK_MIN_POWER); }
+static inline void tps65987_set_autonegotiate_sink_auto_compute_sink_min_power(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_AUTONEGOTIATE_SINK_AUTO_COMPUTE_SINK_MIN_POWER, v); }
+
+/*
+* 0x38 Alternate Mode Entry Queue, 12 bytes, RW
+*/
+#define  TPS_REG_ALTERNATE_MODE_ENTRY_QUEUE               0x38
+#define  TPS_REG_ALTERNATE_MODE_ENTRY_QUEUE_LEN           12
+
+/*
+* 0x3F Power Status, 2 bytes, DRO
+*/
+#define  TPS_REG_POWER_STATUS                             0x3F
+#define  TPS_REG_POWER_STATUS_LEN                         2
+#define  TPS_POWER_STATUS_POWER_CONNECTION                0, 1
+#define  TPS_POWER_STATUS_SOURCE_OR_SINK                  1, 1
+#define  TPS_POWER_STATUS_TYPE_C_CURRENT                  2, 2
+#define  TPS_POWER_STATUS_CHARGER_DETECT_STATUS           4, 4
+#define  TPS_POWER_STATUS_CHARGER_ADVERTISE_STATUS        8, 2
+static inline unsigned int tps65987_power_status_power_connection(const unsigned char *buf) { return tps65987_field_get(buf, TPS_POWER_STATUS_POWER_CONNECTION); }
+static inline unsigned int tps65987_power_status_source_or_sink(const unsigned char *buf) { return tps65987_field_get(buf, TPS_POWER_STATUS_SOURCE_OR_SINK); }
+static inline unsigned int tps65987_power_status_type_c_current(const unsigned char *buf) { return tps65987_field_get(buf, TPS_POWER_STATUS_TYPE_C_CURRENT); }
+static inline unsigned int tps65987_power_status_charger_detect_status(const unsigned char *buf) { return tps65987_field_get(buf, TPS_POWER_STATUS_CHARGER_DETECT_STATUS); }
+static inline unsigned int tps65987_power_status_charger_advertise_status(const unsigned char *buf) { return tps65987_field_get(buf, TPS_POWER_STATUS_CHARGER_ADVERTISE_STATUS); }
+
+/*
+* 0x40 PD Status, 4 bytes, DRO
+*/
+#define  TPS_REG_PD_STATUS                                0x40
+#define  TPS_REG_PD_STATUS_LEN                            4
+#define  TPS_PD_STATUS_PLUG_DETAILS                       0, 2
+#define  TPS_PD_STATUS_CC_PULL_UP                         2, 2
+#define  TPS_PD_STATUS_PORT_TYPE                          4, 2
+#define  TPS_PD_STATUS_PRESENT_ROLE                       6, 1
+#define  TPS_PD_STATUS_SOFT_RESET_DETAILS                 8, 5
+#define  TPS_PD_STATUS_HARD_RESET_DETAILS                 16, 6
+static inline unsigned int tps65987_pd_status_plug_details(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD_STATUS_PLUG_DETAILS); }
+static inline unsigned int tps65987_pd_status_cc_pull_up(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD_STATUS_CC_PULL_UP); }
+static inline unsigned int tps65987_pd_status_port_type(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD_STATUS_PORT_TYPE); }
+static inline unsigned int tps65987_pd_status_present_role(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD_STATUS_PRESENT_ROLE); }
+static inline unsigned int tps65987_pd_status_soft_reset_details(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD_STATUS_SOFT_RESET_DETAILS); }
+static inline unsigned int tps65987_pd_status_hard_reset_details(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD_STATUS_HARD_RESET_DETAILS); }
+
+/*
+* 0x41 PD3.0 Status, 4 bytes, DRO
+*/
+#define  TPS_REG_PD3_0_STATUS                             0x41
+#define  TPS_REG_PD3_0_STATUS_LEN                         4
+#define  TPS_PD3_0_STATUS_RECEIVED_MESSAGE_NOT_SUPPORTED  0, 1
+#define  TPS_PD3_0_STATUS_SOURCE_CAPABILITIES_RECEIVED_MESSAGE 1, 1
+#define  TPS_PD3_0_STATUS_SECURITY_RESPONSE_RECEIVED_MESSAGE 2, 1
+#define  TPS_PD3_0_STATUS_GET_SOURCE_CAPABILITIES_RECEIVED_MESSAGE 3, 1
+#define  TPS_PD3_0_STATUS_SECURITY_REQUEST_MESSAGE_RECEIVED 4, 1
+#define  TPS_PD3_0_STATUS_PORT_PARTNER_NEGOTIATION_SVDM_RECEIVED 23, 2
+#define  TPS_PD3_0_STATUS_PLUG_PARTNER_NEGOTIATION_SVDM_RECEIVED 25, 2
+#define  TPS_PD3_0_STATUS_PORT_PARTNER_NEGOTIATION_RECEIVED 27, 2
+#define  TPS_PD3_0_STATUS_PLUG_PARTNER_NEGOTIATION_RECEIVED 29, 2
+#define  TPS_PD3_0_STATUS_UNCHUNKED_MESSAGES              31, 1
+static inline unsigned int tps65987_pd3_0_status_received_message_not_supported(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_0_STATUS_RECEIVED_MESSAGE_NOT_SUPPORTED); }
+static inline unsigned int tps65987_pd3_0_status_source_capabilities_received_message(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_0_STATUS_SOURCE_CAPABILITIES_RECEIVED_MESSAGE); }
+static inline unsigned int tps65987_pd3_0_status_security_response_received_message(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_0_STATUS_SECURITY_RESPONSE_RECEIVED_MESSAGE); }
+static inline unsigned int tps65987_pd3_0_status_get_source_capabilities_received_message(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_0_STATUS_GET_SOURCE_CAPABILITIES_RECEIVED_MESSAGE); }
+static inline unsigned int tps65987_pd3_0_status_security_request_message_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_0_STATUS_SECURITY_REQUEST_MESSAGE_RECEIVED); }
+static inline unsigned int tps65987_pd3_0_status_port_partner_negotiation_svdm_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_0_STATUS_PORT_PARTNER_NEGOTIATION_SVDM_RECEIVED); }
+static inline unsigned int tps65987_pd3_0_status_plug_partner_negotiation_svdm_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_0_STATUS_PLUG_PARTNER_NEGOTIATION_SVDM_RECEIVED); }
+static inline unsigned int tps65987_pd3_0_status_port_partner_negotiation_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_0_STATUS_PORT_PARTNER_NEGOTIATION_RECEIVED); }
+static inline unsigned int tps65987_pd3_0_status_plug_partner_negotiation_received(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_0_STATUS_PLUG_PARTNER_NEGOTIATION_RECEIVED); }
+static inline unsigned int tps65987_pd3_0_status_unchunked_messages(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_0_STATUS_UNCHUNKED_MESSAGES); }
+
+/*
+* 0x42 PD3 Configuration Register, 4 bytes, RW
+*/
+#define  TPS_REG_PD3_CONFIGURATION_REGISTER               0x42
+#define  TPS_REG_PD3_CONFIGURATION_REGISTER_LEN           4
+#define  TPS_PD3_CONFIGURATION_REGISTER_PORT_MAX_SPEC_REVISION 0, 2
+#define  TPS_PD3_CONFIGURATION_REGISTER_PLUG_MAX_SPEC_REVISION 2, 2
+#define  TPS_PD3_CONFIGURATION_REGISTER_UNCHUNKED_MESSAGING_SUPPORTED 4, 1
+#define  TPS_PD3_CONFIGURATION_REGISTER_FAST_ROLE_SWAP_SUPPORTED 5, 1
+#define  TPS_PD3_CONFIGURATION_REGISTER_FAST_ROLE_SWAP_NOT_INITIATED_BY_UVP 6, 1
+#define  TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_SOURCE_CAP_EXTENDED_MESSAGE 16, 1
+#define  TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_STATUS_MESSAGE 17, 1
+#define  TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_BATTERY_CAPABILITY_MESSAGE 18, 1
+#define  TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_BATTERY_STATUS_MESSAGE 19, 1
+#define  TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_MANUFACTURER_INFO_MESSAGE 20, 1
+#define  TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_SECURITY_MESSAGE 21, 1
+#define  TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_FIRMWARE_UPGRADE_MESSAGE 22, 1
+#define  TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_FIRMWARE_UPGRADE_MESSAGE_2 22, 1
+#define  TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_COUNTY_CODE_INFO 24, 1
+static inline unsigned int tps65987_pd3_configuration_register_port_max_spec_revision(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_CONFIGURATION_REGISTER_PORT_MAX_SPEC_REVISION); }
+static inline void tps65987_set_pd3_configuration_register_port_max_spec_revision(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PD3_CONFIGURATION_REGISTER_PORT_MAX_SPEC_REVISION, v); }
+static inline unsigned int tps65987_pd3_configuration_register_plug_max_spec_revision(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_CONFIGURATION_REGISTER_PLUG_MAX_SPEC_REVISION); }
+static inline void tps65987_set_pd3_configuration_register_plug_max_spec_revision(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PD3_CONFIGURATION_REGISTER_PLUG_MAX_SPEC_REVISION, v); }
+static inline unsigned int tps65987_pd3_configuration_register_unchunked_messaging_supported(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_CONFIGURATION_REGISTER_UNCHUNKED_MESSAGING_SUPPORTED); }
+static inline void tps65987_set_pd3_configuration_register_unchunked_messaging_supported(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PD3_CONFIGURATION_REGISTER_UNCHUNKED_MESSAGING_SUPPORTED, v); }
+static inline unsigned int tps65987_pd3_configuration_register_fast_role_swap_supported(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_CONFIGURATION_REGISTER_FAST_ROLE_SWAP_SUPPORTED); }
+static inline void tps65987_set_pd3_configuration_register_fast_role_swap_supported(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PD3_CONFIGURATION_REGISTER_FAST_ROLE_SWAP_SUPPORTED, v); }
+static inline unsigned int tps65987_pd3_configuration_register_fast_role_swap_not_initiated_by_uvp(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_CONFIGURATION_REGISTER_FAST_ROLE_SWAP_NOT_INITIATED_BY_UVP); }
+static inline void tps65987_set_pd3_configuration_register_fast_role_swap_not_initiated_by_uvp(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PD3_CONFIGURATION_REGISTER_FAST_ROLE_SWAP_NOT_INITIATED_BY_UVP, v); }
+static inline unsigned int tps65987_pd3_configuration_register_support_source_cap_extended_message(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_SOURCE_CAP_EXTENDED_MESSAGE); }
+static inline void tps65987_set_pd3_configuration_register_support_source_cap_extended_message(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_SOURCE_CAP_EXTENDED_MESSAGE, v); }
+static inline unsigned int tps65987_pd3_configuration_register_support_status_message(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_STATUS_MESSAGE); }
+static inline void tps65987_set_pd3_configuration_register_support_status_message(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_STATUS_MESSAGE, v); }
+static inline unsigned int tps65987_pd3_configuration_register_support_battery_capability_message(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_BATTERY_CAPABILITY_MESSAGE); }
+static inline void tps65987_set_pd3_configuration_register_support_battery_capability_message(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_BATTERY_CAPABILITY_MESSAGE, v); }
+static inline unsigned int tps65987_pd3_configuration_register_support_battery_status_message(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_BATTERY_STATUS_MESSAGE); }
+static inline void tps65987_set_pd3_configuration_register_support_battery_status_message(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_BATTERY_STATUS_MESSAGE, v); }
+static inline unsigned int tps65987_pd3_configuration_register_support_manufacturer_info_message(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_MANUFACTURER_INFO_MESSAGE); }
+static inline void tps65987_set_pd3_configuration_register_support_manufacturer_info_message(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_MANUFACTURER_INFO_MESSAGE, v); }
+static inline unsigned int tps65987_pd3_configuration_register_support_security_message(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_SECURITY_MESSAGE); }
+static inline void tps65987_set_pd3_configuration_register_support_security_message(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_SECURITY_MESSAGE, v); }
+static inline unsigned int tps65987_pd3_configuration_register_support_firmware_upgrade_message(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_FIRMWARE_UPGRADE_MESSAGE); }
+static inline void tps65987_set_pd3_configuration_register_support_firmware_upgrade_message(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_FIRMWARE_UPGRADE_MESSAGE, v); }
+static inline unsigned int tps65987_pd3_configuration_register_support_firmware_upgrade_message_2(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_FIRMWARE_UPGRADE_MESSAGE_2); }
+static inline void tps65987_set_pd3_configuration_register_support_firmware_upgrade_message_2(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_FIRMWARE_UPGRADE_MESSAGE_2, v); }
+static inline unsigned int tps65987_pd3_configuration_register_support_county_code_info(const unsigned char *buf) { return tps65987_field_get(buf, TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_COUNTY_CODE_INFO); }
+static inline void tps65987_set_pd3_configuration_register_support_county_code_info(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_PD3_CONFIGURATION_REGISTER_SUPPORT_COUNTY_CODE_INFO, v); }
+
+/*
+* 0x43 Event Delay, 9 bytes, RW
+*/
+#define  TPS_REG_EVENT_DELAY                              0x43
+#define  TPS_REG_EVENT_DELAY_LEN                          9
+
+/*
+* 0x47 Transmit Identity Data Object, 49 bytes, RW
+*/
+#define  TPS_REG_TRANSMIT_IDENTITY_DATA_OBJECT            0x47
+#define  TPS_REG_TRANSMIT_IDENTITY_DATA_OBJECT_LEN        49
+#define  TPS_TRANSMIT_IDENTITY_DATA_OBJECT_NUMBER_OF_IDENTITY_OBJECTS 0, 3
+static inline unsigned int tps65987_transmit_identity_data_object_number_of_identity_objects(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMIT_IDENTITY_DATA_OBJECT_NUMBER_OF_IDENTITY_OBJECTS); }
+static inline void tps65987_set_transmit_identity_data_object_number_of_identity_objects(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMIT_IDENTITY_DATA_OBJECT_NUMBER_OF_IDENTITY_OBJECTS, v); }
+
+/*
+* 0x48 RX Identity SOP, 25 bytes, DRO
+*/
+#define  TPS_REG_RX_IDENTITY_SOP                          0x48
+#define  TPS_REG_RX_IDENTITY_SOP_LEN                      25
+#define  TPS_RX_IDENTITY_SOP_NUMBER_OF_VALID_VDOS         0, 3
+#define  TPS_RX_IDENTITY_SOP_SOP_MESSAGE_SOURCE           6, 2
+static inline unsigned int tps65987_rx_identity_sop_number_of_valid_vdos(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RX_IDENTITY_SOP_NUMBER_OF_VALID_VDOS); }
+static inline unsigned int tps65987_rx_identity_sop_sop_message_source(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RX_IDENTITY_SOP_SOP_MESSAGE_SOURCE); }
+
+/*
+* 0x49 Received SOP Prime Identity Data Object, 25 bytes, DRO
+*/
+#define  TPS_REG_RECEIVED_SOP_PRIME_IDENTITY_DATA_OBJECT  0x49
+#define  TPS_REG_RECEIVED_SOP_PRIME_IDENTITY_DATA_OBJECT_LEN 25
+#define  TPS_RECEIVED_SOP_PRIME_IDENTITY_DATA_OBJECT_NUMBER_OF_RECEIVED_IDENTITY_OBJECTS 0, 3
+static inline unsigned int tps65987_received_sop_prime_identity_data_object_number_of_received_identity_objects(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_SOP_PRIME_IDENTITY_DATA_OBJECT_NUMBER_OF_RECEIVED_IDENTITY_OBJECTS); }
+
+/*
+* 0x4A User Alternate Mode Config, 64 bytes, RW
+*/
+#define  TPS_REG_USER_ALTERNATE_MODE_CONFIG               0x4A
+#define  TPS_REG_USER_ALTERNATE_MODE_CONFIG_LEN           64
+#define  TPS_USER_ALTERNATE_MODE_CONFIG_USER_VID_ENABLED  0, 1
+#define  TPS_USER_ALTERNATE_MODE_CONFIG_USER_ALTERNATE_MODE_VID_VENDOR_ID 16, 16
+#define  TPS_USER_ALTERNATE_MODE_CONFIG_USER_VID_AUTO_SEND_VDO_DATA 288, 192
+#define  TPS_USER_ALTERNATE_MODE_CONFIG_USER_VID_AUTO_SEND_VENDOR_DATA 480, 14
+#define  TPS_USER_ALTERNATE_MODE_CONFIG_USER_MODE_AUTO_SEND_VDO_COUNT 496, 8
+static inline unsigned int tps65987_user_alternate_mode_config_user_vid_enabled(const unsigned char *buf) { return tps65987_field_get(buf, TPS_USER_ALTERNATE_MODE_CONFIG_USER_VID_ENABLED); }
+static inline void tps65987_set_user_alternate_mode_config_user_vid_enabled(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_USER_ALTERNATE_MODE_CONFIG_USER_VID_ENABLED, v); }
+static inline unsigned int tps65987_user_alternate_mode_config_user_alternate_mode_vid_vendor_id(const unsigned char *buf) { return tps65987_field_get(buf, TPS_USER_ALTERNATE_MODE_CONFIG_USER_ALTERNATE_MODE_VID_VENDOR_ID); }
+static inline void tps65987_set_user_alternate_mode_config_user_alternate_mode_vid_vendor_id(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_USER_ALTERNATE_MODE_CONFIG_USER_ALTERNATE_MODE_VID_VENDOR_ID, v); }
+static inline unsigned int tps65987_user_alternate_mode_config_user_vid_auto_send_vendor_data(const unsigned char *buf) { return tps65987_field_get(buf, TPS_USER_ALTERNATE_MODE_CONFIG_USER_VID_AUTO_SEND_VENDOR_DATA); }
+static inline void tps65987_set_user_alternate_mode_config_user_vid_auto_send_vendor_data(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_USER_ALTERNATE_MODE_CONFIG_USER_VID_AUTO_SEND_VENDOR_DATA, v); }
+static inline unsigned int tps65987_user_alternate_mode_config_user_mode_auto_send_vdo_count(const unsigned char *buf) { return tps65987_field_get(buf, TPS_USER_ALTERNATE_MODE_CONFIG_USER_MODE_AUTO_SEND_VDO_COUNT); }
+static inline void tps65987_set_user_alternate_mode_config_user_mode_auto_send_vdo_count(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_USER_ALTERNATE_MODE_CONFIG_USER_MODE_AUTO_SEND_VDO_COUNT, v); }
+
+/*
+* 0x4B MIPI VID Configuration, 4 bytes, RW
+*/
+#define  TPS_REG_MIPI_VID_CONFIGURATION                   0x4B
+#define  TPS_REG_MIPI_VID_CONFIGURATION_LEN               4
+#define  TPS_MIPI_VID_CONFIGURATION_MIPI_VID_ENABLE       0, 1
+#define  TPS_MIPI_VID_CONFIGURATION_MIPI_DEBUG_MODE_ENABLE 1, 1
+#define  TPS_MIPI_VID_CONFIGURATION_MIPI_DEBUG_MODE_AUTOENTRY_ENABLE 9, 1
+static inline unsigned int tps65987_mipi_vid_configuration_mipi_vid_enable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MIPI_VID_CONFIGURATION_MIPI_VID_ENABLE); }
+static inline void tps65987_set_mipi_vid_configuration_mipi_vid_enable(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_MIPI_VID_CONFIGURATION_MIPI_VID_ENABLE, v); }
+static inline unsigned int tps65987_mipi_vid_configuration_mipi_debug_mode_enable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MIPI_VID_CONFIGURATION_MIPI_DEBUG_MODE_ENABLE); }
+static inline void tps65987_set_mipi_vid_configuration_mipi_debug_mode_enable(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_MIPI_VID_CONFIGURATION_MIPI_DEBUG_MODE_ENABLE, v); }
+static inline unsigned int tps65987_mipi_vid_configuration_mipi_debug_mode_autoentry_enable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MIPI_VID_CONFIGURATION_MIPI_DEBUG_MODE_AUTOENTRY_ENABLE); }
+static inline void tps65987_set_mipi_vid_configuration_mipi_debug_mode_autoentry_enable(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_MIPI_VID_CONFIGURATION_MIPI_DEBUG_MODE_AUTOENTRY_ENABLE, v); }
+
+/*
+* 0x4E RX Attention structured VDM, 29 bytes, DRO
+*/
+#define  TPS_REG_RX_ATTENTION_STRUCTURED_VDM              0x4E
+#define  TPS_REG_RX_ATTENTION_STRUCTURED_VDM_LEN          29
+#define  TPS_RX_ATTENTION_STRUCTURED_VDM_NUMBER_OF_VALID_VDOS 0, 3
+#define  TPS_RX_ATTENTION_STRUCTURED_VDM_NUMBER_OF_REGISTER_UPDATES 5, 3
+static inline unsigned int tps65987_rx_attention_structured_vdm_number_of_valid_vdos(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RX_ATTENTION_STRUCTURED_VDM_NUMBER_OF_VALID_VDOS); }
+static inline unsigned int tps65987_rx_attention_structured_vdm_number_of_register_updates(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RX_ATTENTION_STRUCTURED_VDM_NUMBER_OF_REGISTER_UPDATES); }
+
+/*
+* 0x4F RX VDM Register, 29 bytes, DRO
+*/
+#define  TPS_REG_RX_VDM_REGISTER                          0x4F
+#define  TPS_REG_RX_VDM_REGISTER_LEN                      29
+#define  TPS_RX_VDM_REGISTER_NUMBER_OF_VALID_VDOS         0, 3
+#define  TPS_RX_VDM_REGISTER_SOP_MESSAGE_SOURCE           3, 2
+#define  TPS_RX_VDM_REGISTER_NUMBER_OF_REGISTER_UPDATES   5, 3
+static inline unsigned int tps65987_rx_vdm_register_number_of_valid_vdos(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RX_VDM_REGISTER_NUMBER_OF_VALID_VDOS); }
+static inline unsigned int tps65987_rx_vdm_register_sop_message_source(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RX_VDM_REGISTER_SOP_MESSAGE_SOURCE); }
+static inline unsigned int tps65987_rx_vdm_register_number_of_register_updates(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RX_VDM_REGISTER_NUMBER_OF_REGISTER_UPDATES); }
+
+/*
+* 0x50 Data Control Register, 6 bytes, DRW
+*/
+#define  TPS_REG_DATA_CONTROL_REGISTER                    0x50
+#define  TPS_REG_DATA_CONTROL_REGISTER_LEN                6
+#define  TPS_DATA_CONTROL_REGISTER_THUNDERBOLT_HOST_CONNECTED 0, 1
+#define  TPS_DATA_CONTROL_REGISTER_SOFT_RESET_PD_CONTROLLER 1, 1
+#define  TPS_DATA_CONTROL_REGISTER_INTERRUPT_ACKNOWLEDGE  2, 1
+#define  TPS_DATA_CONTROL_REGISTER_STATUS_NAK             3, 1
+#define  TPS_DATA_CONTROL_REGISTER_USB_HOST_CONNECTED     4, 1
+#define  TPS_DATA_CONTROL_REGISTER_DISPLAYPORT_HOST_CONNECTED 5, 1
+#define  TPS_DATA_CONTROL_REGISTER_WRITE_TO_RETIMER       12, 1
+#define  TPS_DATA_CONTROL_REGISTER_DP_INTERRUPT_ACK       13, 1
+#define  TPS_DATA_CONTROL_REGISTER_DISPLAYPORT_HPD_IRQ_PRESENT 14, 1
+#define  TPS_DATA_CONTROL_REGISTER_DISPLAYPORT_HPD_HIGH_LOW 15, 1
+#define  TPS_DATA_CONTROL_REGISTER_AMP_ICL                16, 2
+#define  TPS_DATA_CONTROL_REGISTER_EMPHASIS_ICL           18, 2
+#define  TPS_DATA_CONTROL_REGISTER_REQUESTED_WINDOW_SIZE  20, 2
+#define  TPS_DATA_CONTROL_REGISTER_TPS_TYPE               22, 2
+#define  TPS_DATA_CONTROL_REGISTER_DEBUG_RX_LOCKED        31, 1
+#define  TPS_DATA_CONTROL_REGISTER_AMP_DB                 32, 2
+#define  TPS_DATA_CONTROL_REGISTER_EMPHASIS_DB            34, 2
+#define  TPS_DATA_CONTROL_REGISTER_FREQUENCY              36, 2
+#define  TPS_DATA_CONTROL_REGISTER_LANE_COUNT             38, 2
+#define  TPS_DATA_CONTROL_REGISTER_ADDITIONAL_SKEW        40, 3
+#define  TPS_DATA_CONTROL_REGISTER_DEBUG_MODE_TYPE        44, 2
+#define  TPS_DATA_CONTROL_REGISTER_ENABLE                 46, 1
+#define  TPS_DATA_CONTROL_REGISTER_TRACE_MODE             47, 1
+static inline unsigned int tps65987_data_control_register_thunderbolt_host_connected(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_THUNDERBOLT_HOST_CONNECTED); }
+static inline void tps65987_set_data_control_register_thunderbolt_host_connected(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_THUNDERBOLT_HOST_CONNECTED, v); }
+static inline unsigned int tps65987_data_control_register_soft_reset_pd_controller(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_SOFT_RESET_PD_CONTROLLER); }
+static inline void tps65987_set_data_control_register_soft_reset_pd_controller(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_SOFT_RESET_PD_CONTROLLER, v); }
+static inline unsigned int tps65987_data_control_register_interrupt_acknowledge(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_INTERRUPT_ACKNOWLEDGE); }
+static inline void tps65987_set_data_control_register_interrupt_acknowledge(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_INTERRUPT_ACKNOWLEDGE, v); }
+static inline unsigned int tps65987_data_control_register_status_nak(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_STATUS_NAK); }
+static inline void tps65987_set_data_control_register_status_nak(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_STATUS_NAK, v); }
+static inline unsigned int tps65987_data_control_register_usb_host_connected(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_USB_HOST_CONNECTED); }
+static inline void tps65987_set_data_control_register_usb_host_connected(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_USB_HOST_CONNECTED, v); }
+static inline unsigned int tps65987_data_control_register_displayport_host_connected(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_DISPLAYPORT_HOST_CONNECTED); }
+static inline void tps65987_set_data_control_register_displayport_host_connected(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_DISPLAYPORT_HOST_CONNECTED, v); }
+static inline unsigned int tps65987_data_control_register_write_to_retimer(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_WRITE_TO_RETIMER); }
+static inline void tps65987_set_data_control_register_write_to_retimer(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_WRITE_TO_RETIMER, v); }
+static inline unsigned int tps65987_data_control_register_dp_interrupt_ack(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_DP_INTERRUPT_ACK); }
+static inline void tps65987_set_data_control_register_dp_interrupt_ack(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_DP_INTERRUPT_ACK, v); }
+static inline unsigned int tps65987_data_control_register_displayport_hpd_irq_present(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_DISPLAYPORT_HPD_IRQ_PRESENT); }
+static inline void tps65987_set_data_control_register_displayport_hpd_irq_present(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_DISPLAYPORT_HPD_IRQ_PRESENT, v); }
+static inline unsigned int tps65987_data_control_register_displayport_hpd_high_low(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_DISPLAYPORT_HPD_HIGH_LOW); }
+static inline void tps65987_set_data_control_register_displayport_hpd_high_low(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_DISPLAYPORT_HPD_HIGH_LOW, v); }
+static inline unsigned int tps65987_data_control_register_amp_icl(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_AMP_ICL); }
+static inline void tps65987_set_data_control_register_amp_icl(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_AMP_ICL, v); }
+static inline unsigned int tps65987_data_control_register_emphasis_icl(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_EMPHASIS_ICL); }
+static inline void tps65987_set_data_control_register_emphasis_icl(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_EMPHASIS_ICL, v); }
+static inline unsigned int tps65987_data_control_register_requested_window_size(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_REQUESTED_WINDOW_SIZE); }
+static inline void tps65987_set_data_control_register_requested_window_size(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_REQUESTED_WINDOW_SIZE, v); }
+static inline unsigned int tps65987_data_control_register_tps_type(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_TPS_TYPE); }
+static inline void tps65987_set_data_control_register_tps_type(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_TPS_TYPE, v); }
+static inline unsigned int tps65987_data_control_register_debug_rx_locked(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_DEBUG_RX_LOCKED); }
+static inline void tps65987_set_data_control_register_debug_rx_locked(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_DEBUG_RX_LOCKED, v); }
+static inline unsigned int tps65987_data_control_register_amp_db(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_AMP_DB); }
+static inline void tps65987_set_data_control_register_amp_db(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_AMP_DB, v); }
+static inline unsigned int tps65987_data_control_register_emphasis_db(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_EMPHASIS_DB); }
+static inline void tps65987_set_data_control_register_emphasis_db(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_EMPHASIS_DB, v); }
+static inline unsigned int tps65987_data_control_register_frequency(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_FREQUENCY); }
+static inline void tps65987_set_data_control_register_frequency(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_FREQUENCY, v); }
+static inline unsigned int tps65987_data_control_register_lane_count(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_LANE_COUNT); }
+static inline void tps65987_set_data_control_register_lane_count(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_LANE_COUNT, v); }
+static inline unsigned int tps65987_data_control_register_additional_skew(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_ADDITIONAL_SKEW); }
+static inline void tps65987_set_data_control_register_additional_skew(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_ADDITIONAL_SKEW, v); }
+static inline unsigned int tps65987_data_control_register_debug_mode_type(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_DEBUG_MODE_TYPE); }
+static inline void tps65987_set_data_control_register_debug_mode_type(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_DEBUG_MODE_TYPE, v); }
+static inline unsigned int tps65987_data_control_register_enable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_ENABLE); }
+static inline void tps65987_set_data_control_register_enable(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_ENABLE, v); }
+static inline unsigned int tps65987_data_control_register_trace_mode(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_CONTROL_REGISTER_TRACE_MODE); }
+static inline void tps65987_set_data_control_register_trace_mode(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DATA_CONTROL_REGISTER_TRACE_MODE, v); }
+
+/*
+* 0x51 Display Port Capabilities, 7 bytes, RW
+*/
+#define  TPS_REG_DISPLAY_PORT_CAPABILITIES                0x51
+#define  TPS_REG_DISPLAY_PORT_CAPABILITIES_LEN            7
+#define  TPS_DISPLAY_PORT_CAPABILITIES_ENABLE_DISPLAY_PORT_SVID 0, 1
+#define  TPS_DISPLAY_PORT_CAPABILITIES_ENABLE_DISPLAY_PORT_MODE_1 1, 1
+#define  TPS_DISPLAY_PORT_CAPABILITIES_DP_PORT_CAPABILITY 8, 2
+#define  TPS_DISPLAY_PORT_CAPABILITIES_SUPPORTS_DP_V1_3_SIGNALLING 10, 1
+#define  TPS_DISPLAY_PORT_CAPABILITIES_SUPPORTS_USB_GEN_2_SIGNALLING 11, 1
+#define  TPS_DISPLAY_PORT_CAPABILITIES_DP_RECEPTACLE_INDICATION 14, 1
+#define  TPS_DISPLAY_PORT_CAPABILITIES_USB2_0_SIGNALLING_NOT_USED 15, 1
+#define  TPS_DISPLAY_PORT_CAPABILITIES_DFPD_RECEPTACLE_OR_UFPD_PLUG_PIN_ASSIGNMENT 16, 8
+#define  TPS_DISPLAY_PORT_CAPABILITIES_UFPD_RECEPTACLE_OR_DFPD_PLUG_PIN_ASSIGNMENT 24, 8
+#define  TPS_DISPLAY_PORT_CAPABILITIES_MULTIFUNCTION_PREFERRED 32, 1
+#define  TPS_DISPLAY_PORT_CAPABILITIES_PREFERRED_DP_ROLE  33, 1
+#define  TPS_DISPLAY_PORT_CAPABILITIES_FORCE_USB_CONFIGURATION 34, 1
+#define  TPS_DISPLAY_PORT_CAPABILITIES_DFP_D_UFP_D_CONNECTED 35, 2
+#define  TPS_DISPLAY_PORT_CAPABILITIES_DISPLAYPORT_MODE_AUTO_ENTRY_ALLOWED 41, 1
+static inline unsigned int tps65987_display_port_capabilities_enable_display_port_svid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DISPLAY_PORT_CAPABILITIES_ENABLE_DISPLAY_PORT_SVID); }
+static inline void tps65987_set_display_port_capabilities_enable_display_port_svid(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DISPLAY_PORT_CAPABILITIES_ENABLE_DISPLAY_PORT_SVID, v); }
+static inline unsigned int tps65987_display_port_capabilities_enable_display_port_mode_1(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DISPLAY_PORT_CAPABILITIES_ENABLE_DISPLAY_PORT_MODE_1); }
+static inline void tps65987_set_display_port_capabilities_enable_display_port_mode_1(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DISPLAY_PORT_CAPABILITIES_ENABLE_DISPLAY_PORT_MODE_1, v); }
+static inline unsigned int tps65987_display_port_capabilities_dp_port_capability(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DISPLAY_PORT_CAPABILITIES_DP_PORT_CAPABILITY); }
+static inline void tps65987_set_display_port_capabilities_dp_port_capability(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DISPLAY_PORT_CAPABILITIES_DP_PORT_CAPABILITY, v); }
+static inline unsigned int tps65987_display_port_capabilities_supports_dp_v1_3_signalling(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DISPLAY_PORT_CAPABILITIES_SUPPORTS_DP_V1_3_SIGNALLING); }
+static inline void tps65987_set_display_port_capabilities_supports_dp_v1_3_signalling(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DISPLAY_PORT_CAPABILITIES_SUPPORTS_DP_V1_3_SIGNALLING, v); }
+static inline unsigned int tps65987_display_port_capabilities_supports_usb_gen_2_signalling(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DISPLAY_PORT_CAPABILITIES_SUPPORTS_USB_GEN_2_SIGNALLING); }
+static inline void tps65987_set_display_port_capabilities_supports_usb_gen_2_signalling(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DISPLAY_PORT_CAPABILITIES_SUPPORTS_USB_GEN_2_SIGNALLING, v); }
+static inline unsigned int tps65987_display_port_capabilities_dp_receptacle_indication(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DISPLAY_PORT_CAPABILITIES_DP_RECEPTACLE_INDICATION); }
+static inline void tps65987_set_display_port_capabilities_dp_receptacle_indication(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DISPLAY_PORT_CAPABILITIES_DP_RECEPTACLE_INDICATION, v); }
+static inline unsigned int tps65987_display_port_capabilities_usb2_0_signalling_not_used(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DISPLAY_PORT_CAPABILITIES_USB2_0_SIGNALLING_NOT_USED); }
+static inline void tps65987_set_display_port_capabilities_usb2_0_signalling_not_used(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DISPLAY_PORT_CAPABILITIES_USB2_0_SIGNALLING_NOT_USED, v); }
+static inline unsigned int tps65987_display_port_capabilities_dfpd_receptacle_or_ufpd_plug_pin_assignment(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DISPLAY_PORT_CAPABILITIES_DFPD_RECEPTACLE_OR_UFPD_PLUG_PIN_ASSIGNMENT); }
+static inline void tps65987_set_display_port_capabilities_dfpd_receptacle_or_ufpd_plug_pin_assignment(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DISPLAY_PORT_CAPABILITIES_DFPD_RECEPTACLE_OR_UFPD_PLUG_PIN_ASSIGNMENT, v); }
+static inline unsigned int tps65987_display_port_capabilities_ufpd_receptacle_or_dfpd_plug_pin_assignment(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DISPLAY_PORT_CAPABILITIES_UFPD_RECEPTACLE_OR_DFPD_PLUG_PIN_ASSIGNMENT); }
+static inline void tps65987_set_display_port_capabilities_ufpd_receptacle_or_dfpd_plug_pin_assignment(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DISPLAY_PORT_CAPABILITIES_UFPD_RECEPTACLE_OR_DFPD_PLUG_PIN_ASSIGNMENT, v); }
+static inline unsigned int tps65987_display_port_capabilities_multifunction_preferred(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DISPLAY_PORT_CAPABILITIES_MULTIFUNCTION_PREFERRED); }
+static inline void tps65987_set_display_port_capabilities_multifunction_preferred(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DISPLAY_PORT_CAPABILITIES_MULTIFUNCTION_PREFERRED, v); }
+static inline unsigned int tps65987_display_port_capabilities_preferred_dp_role(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DISPLAY_PORT_CAPABILITIES_PREFERRED_DP_ROLE); }
+static inline void tps65987_set_display_port_capabilities_preferred_dp_role(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DISPLAY_PORT_CAPABILITIES_PREFERRED_DP_ROLE, v); }
+static inline unsigned int tps65987_display_port_capabilities_force_usb_configuration(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DISPLAY_PORT_CAPABILITIES_FORCE_USB_CONFIGURATION); }
+static inline void tps65987_set_display_port_capabilities_force_usb_configuration(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DISPLAY_PORT_CAPABILITIES_FORCE_USB_CONFIGURATION, v); }
+static inline unsigned int tps65987_display_port_capabilities_dfp_d_ufp_d_connected(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DISPLAY_PORT_CAPABILITIES_DFP_D_UFP_D_CONNECTED); }
+static inline void tps65987_set_display_port_capabilities_dfp_d_ufp_d_connected(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DISPLAY_PORT_CAPABILITIES_DFP_D_UFP_D_CONNECTED, v); }
+static inline unsigned int tps65987_display_port_capabilities_displayport_mode_auto_entry_allowed(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DISPLAY_PORT_CAPABILITIES_DISPLAYPORT_MODE_AUTO_ENTRY_ALLOWED); }
+static inline void tps65987_set_display_port_capabilities_displayport_mode_auto_entry_allowed(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_DISPLAY_PORT_CAPABILITIES_DISPLAYPORT_MODE_AUTO_ENTRY_ALLOWED, v); }
+
+/*
+* 0x52 Intel VID Config Register, 8 bytes, RW
+*/
+#define  TPS_REG_INTEL_VID_CONFIG_REGISTER                0x52
+#define  TPS_REG_INTEL_VID_CONFIG_REGISTER_LEN            8
+#define  TPS_INTEL_VID_CONFIG_REGISTER_ENABLE_INTEL_VID   0, 1
+#define  TPS_INTEL_VID_CONFIG_REGISTER_ENABLE_INTEL_THUNDERBOLT_MODE 1, 1
+#define  TPS_INTEL_VID_CONFIG_REGISTER_THUNDERBOLT_VOUT_3V3_REQUIRED 8, 1
+#define  TPS_INTEL_VID_CONFIG_REGISTER_THUNDERBOLT_EMARKER_OVERRIDE 9, 1
+#define  TPS_INTEL_VID_CONFIG_REGISTER_AN_MINIMUM_POWER_REQUIRED 10, 1
+#define  TPS_INTEL_VID_CONFIG_REGISTER_VPRO_CAPABLE       11, 1
+#define  TPS_INTEL_VID_CONFIG_REGISTER_DUAL_TBT_RETIMER_PRESENT 12, 1
+#define  TPS_INTEL_VID_CONFIG_REGISTER_TBT_RETIMER_PRESENT 13, 1
+#define  TPS_INTEL_VID_CONFIG_REGISTER_DATA_STATUS_HPD_EVENTS 14, 1
+#define  TPS_INTEL_VID_CONFIG_REGISTER_TBT_MODE_AUTOENTRY 49, 1
+static inline unsigned int tps65987_intel_vid_config_register_enable_intel_vid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTEL_VID_CONFIG_REGISTER_ENABLE_INTEL_VID); }
+static inline void tps65987_set_intel_vid_config_register_enable_intel_vid(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTEL_VID_CONFIG_REGISTER_ENABLE_INTEL_VID, v); }
+static inline unsigned int tps65987_intel_vid_config_register_enable_intel_thunderbolt_mode(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTEL_VID_CONFIG_REGISTER_ENABLE_INTEL_THUNDERBOLT_MODE); }
+static inline void tps65987_set_intel_vid_config_register_enable_intel_thunderbolt_mode(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTEL_VID_CONFIG_REGISTER_ENABLE_INTEL_THUNDERBOLT_MODE, v); }
+static inline unsigned int tps65987_intel_vid_config_register_thunderbolt_vout_3v3_required(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTEL_VID_CONFIG_REGISTER_THUNDERBOLT_VOUT_3V3_REQUIRED); }
+static inline void tps65987_set_intel_vid_config_register_thunderbolt_vout_3v3_required(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTEL_VID_CONFIG_REGISTER_THUNDERBOLT_VOUT_3V3_REQUIRED, v); }
+static inline unsigned int tps65987_intel_vid_config_register_thunderbolt_emarker_override(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTEL_VID_CONFIG_REGISTER_THUNDERBOLT_EMARKER_OVERRIDE); }
+static inline void tps65987_set_intel_vid_config_register_thunderbolt_emarker_override(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTEL_VID_CONFIG_REGISTER_THUNDERBOLT_EMARKER_OVERRIDE, v); }
+static inline unsigned int tps65987_intel_vid_config_register_an_minimum_power_required(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTEL_VID_CONFIG_REGISTER_AN_MINIMUM_POWER_REQUIRED); }
+static inline void tps65987_set_intel_vid_config_register_an_minimum_power_required(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTEL_VID_CONFIG_REGISTER_AN_MINIMUM_POWER_REQUIRED, v); }
+static inline unsigned int tps65987_intel_vid_config_register_vpro_capable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTEL_VID_CONFIG_REGISTER_VPRO_CAPABLE); }
+static inline void tps65987_set_intel_vid_config_register_vpro_capable(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTEL_VID_CONFIG_REGISTER_VPRO_CAPABLE, v); }
+static inline unsigned int tps65987_intel_vid_config_register_dual_tbt_retimer_present(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTEL_VID_CONFIG_REGISTER_DUAL_TBT_RETIMER_PRESENT); }
+static inline void tps65987_set_intel_vid_config_register_dual_tbt_retimer_present(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTEL_VID_CONFIG_REGISTER_DUAL_TBT_RETIMER_PRESENT, v); }
+static inline unsigned int tps65987_intel_vid_config_register_tbt_retimer_present(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTEL_VID_CONFIG_REGISTER_TBT_RETIMER_PRESENT); }
+static inline void tps65987_set_intel_vid_config_register_tbt_retimer_present(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTEL_VID_CONFIG_REGISTER_TBT_RETIMER_PRESENT, v); }
+static inline unsigned int tps65987_intel_vid_config_register_data_status_hpd_events(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTEL_VID_CONFIG_REGISTER_DATA_STATUS_HPD_EVENTS); }
+static inline void tps65987_set_intel_vid_config_register_data_status_hpd_events(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTEL_VID_CONFIG_REGISTER_DATA_STATUS_HPD_EVENTS, v); }
+static inline unsigned int tps65987_intel_vid_config_register_tbt_mode_autoentry(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTEL_VID_CONFIG_REGISTER_TBT_MODE_AUTOENTRY); }
+static inline void tps65987_set_intel_vid_config_register_tbt_mode_autoentry(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_INTEL_VID_CONFIG_REGISTER_TBT_MODE_AUTOENTRY, v); }
+
+/*
+* 0x54 Texas Instruments VID Config, 8 bytes, RW
+*/
+#define  TPS_REG_TEXAS_INSTRUMENTS_VID_CONFIG             0x54
+#define  TPS_REG_TEXAS_INSTRUMENTS_VID_CONFIG_LEN         8
+#define  TPS_TEXAS_INSTRUMENTS_VID_CONFIG_ENABLE_TEXAS_INSTRUMENTS_VID 0, 1
+#define  TPS_TEXAS_INSTRUMENTS_VID_CONFIG_ENABLE_PDIO_MODE 1, 1
+#define  TPS_TEXAS_INSTRUMENTS_VID_CONFIG_ENABLE_PDIO_MODE_AUTOENTRY 9, 1
+static inline unsigned int tps65987_texas_instruments_vid_config_enable_texas_instruments_vid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TEXAS_INSTRUMENTS_VID_CONFIG_ENABLE_TEXAS_INSTRUMENTS_VID); }
+static inline void tps65987_set_texas_instruments_vid_config_enable_texas_instruments_vid(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TEXAS_INSTRUMENTS_VID_CONFIG_ENABLE_TEXAS_INSTRUMENTS_VID, v); }
+static inline unsigned int tps65987_texas_instruments_vid_config_enable_pdio_mode(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TEXAS_INSTRUMENTS_VID_CONFIG_ENABLE_PDIO_MODE); }
+static inline void tps65987_set_texas_instruments_vid_config_enable_pdio_mode(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TEXAS_INSTRUMENTS_VID_CONFIG_ENABLE_PDIO_MODE, v); }
+static inline unsigned int tps65987_texas_instruments_vid_config_enable_pdio_mode_autoentry(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TEXAS_INSTRUMENTS_VID_CONFIG_ENABLE_PDIO_MODE_AUTOENTRY); }
+static inline void tps65987_set_texas_instruments_vid_config_enable_pdio_mode_autoentry(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TEXAS_INSTRUMENTS_VID_CONFIG_ENABLE_PDIO_MODE_AUTOENTRY, v); }
+
+/*
+* 0x55 Miscellaneous Control, 1 bytes, RW
+*/
+#define  TPS_REG_MISCELLANEOUS_CONTROL                    0x55
+#define  TPS_REG_MISCELLANEOUS_CONTROL_LEN                1
+#define  TPS_MISCELLANEOUS_CONTROL_VSAFE0V_DONGLE         0, 1
+#define  TPS_MISCELLANEOUS_CONTROL_AC_ADAPTER_BLOCK_SWAP_IF_NO_DATA_SUPPORT 1, 1
+#define  TPS_MISCELLANEOUS_CONTROL_EXTEND_ERROR_RECOVERY_TIMEOUT_TO_50_MSEC 2, 1
+#define  TPS_MISCELLANEOUS_CONTROL_PSRDY_DELAY            3, 2
+static inline unsigned int tps65987_miscellaneous_control_vsafe0v_dongle(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MISCELLANEOUS_CONTROL_VSAFE0V_DONGLE); }
+static inline void tps65987_set_miscellaneous_control_vsafe0v_dongle(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_MISCELLANEOUS_CONTROL_VSAFE0V_DONGLE, v); }
+static inline unsigned int tps65987_miscellaneous_control_ac_adapter_block_swap_if_no_data_support(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MISCELLANEOUS_CONTROL_AC_ADAPTER_BLOCK_SWAP_IF_NO_DATA_SUPPORT); }
+static inline void tps65987_set_miscellaneous_control_ac_adapter_block_swap_if_no_data_support(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_MISCELLANEOUS_CONTROL_AC_ADAPTER_BLOCK_SWAP_IF_NO_DATA_SUPPORT, v); }
+static inline unsigned int tps65987_miscellaneous_control_extend_error_recovery_timeout_to_50_msec(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MISCELLANEOUS_CONTROL_EXTEND_ERROR_RECOVERY_TIMEOUT_TO_50_MSEC); }
+static inline void tps65987_set_miscellaneous_control_extend_error_recovery_timeout_to_50_msec(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_MISCELLANEOUS_CONTROL_EXTEND_ERROR_RECOVERY_TIMEOUT_TO_50_MSEC, v); }
+static inline unsigned int tps65987_miscellaneous_control_psrdy_delay(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MISCELLANEOUS_CONTROL_PSRDY_DELAY); }
+static inline void tps65987_set_miscellaneous_control_psrdy_delay(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_MISCELLANEOUS_CONTROL_PSRDY_DELAY, v); }
+
+/*
+* 0x57 User VID Status Register, 2 bytes, DRO
+*/
+#define  TPS_REG_USER_VID_STATUS_REGISTER                 0x57
+#define  TPS_REG_USER_VID_STATUS_REGISTER_LEN             2
+#define  TPS_USER_VID_STATUS_REGISTER_USER_VID_DETECTED   0, 1
+#define  TPS_USER_VID_STATUS_REGISTER_USER_VID_ACTIVE     1, 1
+#define  TPS_USER_VID_STATUS_REGISTER_USER_VID_ERROR_CODE 2, 3
+#define  TPS_USER_VID_STATUS_REGISTER_USER_VID_MODE_1_STATUS 9, 1
+#define  TPS_USER_VID_STATUS_REGISTER_USER_VID_MODE_2_STATUS 10, 1
+#define  TPS_USER_VID_STATUS_REGISTER_USER_VID_MODE_3_STATUS 11, 1
+#define  TPS_USER_VID_STATUS_REGISTER_USER_VID_MODE_4_STATUS 12, 1
+static inline unsigned int tps65987_user_vid_status_register_user_vid_detected(const unsigned char *buf) { return tps65987_field_get(buf, TPS_USER_VID_STATUS_REGISTER_USER_VID_DETECTED); }
+static inline unsigned int tps65987_user_vid_status_register_user_vid_active(const unsigned char *buf) { return tps65987_field_get(buf, TPS_USER_VID_STATUS_REGISTER_USER_VID_ACTIVE); }
+static inline unsigned int tps65987_user_vid_status_register_user_vid_error_code(const unsigned char *buf) { return tps65987_field_get(buf, TPS_USER_VID_STATUS_REGISTER_USER_VID_ERROR_CODE); }
+static inline unsigned int tps65987_user_vid_status_register_user_vid_mode_1_status(const unsigned char *buf) { return tps65987_field_get(buf, TPS_USER_VID_STATUS_REGISTER_USER_VID_MODE_1_STATUS); }
+static inline unsigned int tps65987_user_vid_status_register_user_vid_mode_2_status(const unsigned char *buf) { return tps65987_field_get(buf, TPS_USER_VID_STATUS_REGISTER_USER_VID_MODE_2_STATUS); }
+static inline unsigned int tps65987_user_vid_status_register_user_vid_mode_3_status(const unsigned char *buf) { return tps65987_field_get(buf, TPS_USER_VID_STATUS_REGISTER_USER_VID_MODE_3_STATUS); }
+static inline unsigned int tps65987_user_vid_status_register_user_vid_mode_4_status(const unsigned char *buf) { return tps65987_field_get(buf, TPS_USER_VID_STATUS_REGISTER_USER_VID_MODE_4_STATUS); }
+
+/*
+* 0x58 DP SID Status, 33 bytes, DRO
+*/
+#define  TPS_REG_DP_SID_STATUS                            0x58
+#define  TPS_REG_DP_SID_STATUS_LEN                        33
+#define  TPS_DP_SID_STATUS_DP_SID_DETECTED                0, 1
+#define  TPS_DP_SID_STATUS_DP_MODE_ACTIVE                 1, 1
+#define  TPS_DP_SID_STATUS_ERROR_CODE                     2, 3
+static inline unsigned int tps65987_dp_sid_status_dp_sid_detected(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DP_SID_STATUS_DP_SID_DETECTED); }
+static inline unsigned int tps65987_dp_sid_status_dp_mode_active(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DP_SID_STATUS_DP_MODE_ACTIVE); }
+static inline unsigned int tps65987_dp_sid_status_error_code(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DP_SID_STATUS_ERROR_CODE); }
+
+/*
+* 0x59 Intel VID Status, 11 bytes, DRO
+*/
+#define  TPS_REG_INTEL_VID_STATUS                         0x59
+#define  TPS_REG_INTEL_VID_STATUS_LEN                     11
+#define  TPS_INTEL_VID_STATUS_INTEL_VID_DETECTED          0, 1
+#define  TPS_INTEL_VID_STATUS_THUNDERBOLT_MODE_ACTIVE     1, 1
+#define  TPS_INTEL_VID_STATUS_ERROR_CODE                  2, 3
+#define  TPS_INTEL_VID_STATUS_TBT_ATTENTION_DATA          8, 32
+static inline unsigned int tps65987_intel_vid_status_intel_vid_detected(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTEL_VID_STATUS_INTEL_VID_DETECTED); }
+static inline unsigned int tps65987_intel_vid_status_thunderbolt_mode_active(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTEL_VID_STATUS_THUNDERBOLT_MODE_ACTIVE); }
+static inline unsigned int tps65987_intel_vid_status_error_code(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTEL_VID_STATUS_ERROR_CODE); }
+static inline unsigned int tps65987_intel_vid_status_tbt_attention_data(const unsigned char *buf) { return tps65987_field_get(buf, TPS_INTEL_VID_STATUS_TBT_ATTENTION_DATA); }
+
+/*
+* 0x5B TI VID Status Register, 1 bytes, DRO
+*/
+#define  TPS_REG_TI_VID_STATUS_REGISTER                   0x5B
+#define  TPS_REG_TI_VID_STATUS_REGISTER_LEN               1
+#define  TPS_TI_VID_STATUS_REGISTER_TI_VID_STATUS         0, 1
+#define  TPS_TI_VID_STATUS_REGISTER_TI_PDIO_STATUS        1, 1
+#define  TPS_TI_VID_STATUS_REGISTER_TI_VID_ERROR_CODE     2, 3
+static inline unsigned int tps65987_ti_vid_status_register_ti_vid_status(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TI_VID_STATUS_REGISTER_TI_VID_STATUS); }
+static inline unsigned int tps65987_ti_vid_status_register_ti_pdio_status(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TI_VID_STATUS_REGISTER_TI_PDIO_STATUS); }
+static inline unsigned int tps65987_ti_vid_status_register_ti_vid_error_code(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TI_VID_STATUS_REGISTER_TI_VID_ERROR_CODE); }
+
+/*
+* 0x5C I/O Config, 64 bytes, RO
+*/
+#define  TPS_REG_I_O_CONFIG                               0x5C
+#define  TPS_REG_I_O_CONFIG_LEN                           64
+
+/*
+* 0x5D Retimer Debug Register, 4 bytes, RW
+*/
+#define  TPS_REG_RETIMER_DEBUG_REGISTER                   0x5D
+#define  TPS_REG_RETIMER_DEBUG_REGISTER_LEN               4
+#define  TPS_RETIMER_DEBUG_REGISTER_AMP_ICL               0, 2
+#define  TPS_RETIMER_DEBUG_REGISTER_EMPHASIS_ICL          2, 2
+#define  TPS_RETIMER_DEBUG_REGISTER_REQUESTED_WINDOW_SIZE 4, 2
+#define  TPS_RETIMER_DEBUG_REGISTER_TPS_TYPE              6, 2
+#define  TPS_RETIMER_DEBUG_REGISTER_DEBUG_RX_LOCKED       15, 1
+#define  TPS_RETIMER_DEBUG_REGISTER_AMP_DB                16, 2
+#define  TPS_RETIMER_DEBUG_REGISTER_EMPHASIS_DB           18, 2
+#define  TPS_RETIMER_DEBUG_REGISTER_FREQUENCY             20, 2
+#define  TPS_RETIMER_DEBUG_REGISTER_LANE_COUNT            22, 2
+#define  TPS_RETIMER_DEBUG_REGISTER_ADDITIONAL_SKEW       24, 3
+#define  TPS_RETIMER_DEBUG_REGISTER_DEBUG_MODE_TYPE       28, 2
+#define  TPS_RETIMER_DEBUG_REGISTER_ENABLE                30, 1
+#define  TPS_RETIMER_DEBUG_REGISTER_TRACE_MODE            31, 1
+static inline unsigned int tps65987_retimer_debug_register_amp_icl(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RETIMER_DEBUG_REGISTER_AMP_ICL); }
+static inline void tps65987_set_retimer_debug_register_amp_icl(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_RETIMER_DEBUG_REGISTER_AMP_ICL, v); }
+static inline unsigned int tps65987_retimer_debug_register_emphasis_icl(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RETIMER_DEBUG_REGISTER_EMPHASIS_ICL); }
+static inline void tps65987_set_retimer_debug_register_emphasis_icl(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_RETIMER_DEBUG_REGISTER_EMPHASIS_ICL, v); }
+static inline unsigned int tps65987_retimer_debug_register_requested_window_size(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RETIMER_DEBUG_REGISTER_REQUESTED_WINDOW_SIZE); }
+static inline void tps65987_set_retimer_debug_register_requested_window_size(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_RETIMER_DEBUG_REGISTER_REQUESTED_WINDOW_SIZE, v); }
+static inline unsigned int tps65987_retimer_debug_register_tps_type(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RETIMER_DEBUG_REGISTER_TPS_TYPE); }
+static inline void tps65987_set_retimer_debug_register_tps_type(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_RETIMER_DEBUG_REGISTER_TPS_TYPE, v); }
+static inline unsigned int tps65987_retimer_debug_register_debug_rx_locked(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RETIMER_DEBUG_REGISTER_DEBUG_RX_LOCKED); }
+static inline void tps65987_set_retimer_debug_register_debug_rx_locked(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_RETIMER_DEBUG_REGISTER_DEBUG_RX_LOCKED, v); }
+static inline unsigned int tps65987_retimer_debug_register_amp_db(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RETIMER_DEBUG_REGISTER_AMP_DB); }
+static inline void tps65987_set_retimer_debug_register_amp_db(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_RETIMER_DEBUG_REGISTER_AMP_DB, v); }
+static inline unsigned int tps65987_retimer_debug_register_emphasis_db(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RETIMER_DEBUG_REGISTER_EMPHASIS_DB); }
+static inline void tps65987_set_retimer_debug_register_emphasis_db(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_RETIMER_DEBUG_REGISTER_EMPHASIS_DB, v); }
+static inline unsigned int tps65987_retimer_debug_register_frequency(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RETIMER_DEBUG_REGISTER_FREQUENCY); }
+static inline void tps65987_set_retimer_debug_register_frequency(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_RETIMER_DEBUG_REGISTER_FREQUENCY, v); }
+static inline unsigned int tps65987_retimer_debug_register_lane_count(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RETIMER_DEBUG_REGISTER_LANE_COUNT); }
+static inline void tps65987_set_retimer_debug_register_lane_count(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_RETIMER_DEBUG_REGISTER_LANE_COUNT, v); }
+static inline unsigned int tps65987_retimer_debug_register_additional_skew(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RETIMER_DEBUG_REGISTER_ADDITIONAL_SKEW); }
+static inline void tps65987_set_retimer_debug_register_additional_skew(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_RETIMER_DEBUG_REGISTER_ADDITIONAL_SKEW, v); }
+static inline unsigned int tps65987_retimer_debug_register_debug_mode_type(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RETIMER_DEBUG_REGISTER_DEBUG_MODE_TYPE); }
+static inline void tps65987_set_retimer_debug_register_debug_mode_type(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_RETIMER_DEBUG_REGISTER_DEBUG_MODE_TYPE, v); }
+static inline unsigned int tps65987_retimer_debug_register_enable(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RETIMER_DEBUG_REGISTER_ENABLE); }
+static inline void tps65987_set_retimer_debug_register_enable(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_RETIMER_DEBUG_REGISTER_ENABLE, v); }
+static inline unsigned int tps65987_retimer_debug_register_trace_mode(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RETIMER_DEBUG_REGISTER_TRACE_MODE); }
+static inline void tps65987_set_retimer_debug_register_trace_mode(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_RETIMER_DEBUG_REGISTER_TRACE_MODE, v); }
+
+/*
+* 0x5E Miscellaneous Configuration, 64 bytes, RW
+*/
+#define  TPS_REG_MISCELLANEOUS_CONFIGURATION_5E           0x5E
+#define  TPS_REG_MISCELLANEOUS_CONFIGURATION_5E_LEN       64
+#define  TPS_MISCELLANEOUS_CONFIGURATION_5E_DP_HOT_PLUG_DETECT_GPIO 3, 2
+#define  TPS_MISCELLANEOUS_CONFIGURATION_5E_EXTERNAL_RESET_FROM_MRESET 8, 1
+#define  TPS_MISCELLANEOUS_CONFIGURATION_5E_EXTERNAL_RESET_POLARITY 9, 1
+#define  TPS_MISCELLANEOUS_CONFIGURATION_5E_IGNORE_GOOD_CRC_MISMATCH 17, 1
+#define  TPS_MISCELLANEOUS_CONFIGURATION_5E_LOCK_3V3_OUTPUT 19, 1
+#define  TPS_MISCELLANEOUS_CONFIGURATION_5E_USE_3V3_FOR_I2C1_LEVEL 20, 1
+#define  TPS_MISCELLANEOUS_CONFIGURATION_5E_USE_3V3_FOR_I2C2_LEVEL 21, 1
+static inline unsigned int tps65987_miscellaneous_configuration_5e_dp_hot_plug_detect_gpio(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MISCELLANEOUS_CONFIGURATION_5E_DP_HOT_PLUG_DETECT_GPIO); }
+static inline void tps65987_set_miscellaneous_configuration_5e_dp_hot_plug_detect_gpio(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_MISCELLANEOUS_CONFIGURATION_5E_DP_HOT_PLUG_DETECT_GPIO, v); }
+static inline unsigned int tps65987_miscellaneous_configuration_5e_external_reset_from_mreset(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MISCELLANEOUS_CONFIGURATION_5E_EXTERNAL_RESET_FROM_MRESET); }
+static inline void tps65987_set_miscellaneous_configuration_5e_external_reset_from_mreset(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_MISCELLANEOUS_CONFIGURATION_5E_EXTERNAL_RESET_FROM_MRESET, v); }
+static inline unsigned int tps65987_miscellaneous_configuration_5e_external_reset_polarity(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MISCELLANEOUS_CONFIGURATION_5E_EXTERNAL_RESET_POLARITY); }
+static inline void tps65987_set_miscellaneous_configuration_5e_external_reset_polarity(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_MISCELLANEOUS_CONFIGURATION_5E_EXTERNAL_RESET_POLARITY, v); }
+static inline unsigned int tps65987_miscellaneous_configuration_5e_ignore_good_crc_mismatch(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MISCELLANEOUS_CONFIGURATION_5E_IGNORE_GOOD_CRC_MISMATCH); }
+static inline void tps65987_set_miscellaneous_configuration_5e_ignore_good_crc_mismatch(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_MISCELLANEOUS_CONFIGURATION_5E_IGNORE_GOOD_CRC_MISMATCH, v); }
+static inline unsigned int tps65987_miscellaneous_configuration_5e_lock_3v3_output(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MISCELLANEOUS_CONFIGURATION_5E_LOCK_3V3_OUTPUT); }
+static inline void tps65987_set_miscellaneous_configuration_5e_lock_3v3_output(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_MISCELLANEOUS_CONFIGURATION_5E_LOCK_3V3_OUTPUT, v); }
+static inline unsigned int tps65987_miscellaneous_configuration_5e_use_3v3_for_i2c1_level(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MISCELLANEOUS_CONFIGURATION_5E_USE_3V3_FOR_I2C1_LEVEL); }
+static inline void tps65987_set_miscellaneous_configuration_5e_use_3v3_for_i2c1_level(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_MISCELLANEOUS_CONFIGURATION_5E_USE_3V3_FOR_I2C1_LEVEL, v); }
+static inline unsigned int tps65987_miscellaneous_configuration_5e_use_3v3_for_i2c2_level(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MISCELLANEOUS_CONFIGURATION_5E_USE_3V3_FOR_I2C2_LEVEL); }
+static inline void tps65987_set_miscellaneous_configuration_5e_use_3v3_for_i2c2_level(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_MISCELLANEOUS_CONFIGURATION_5E_USE_3V3_FOR_I2C2_LEVEL, v); }
+
+/*
+* 0x5F Data Status, 5 bytes, DRO
+*/
+#define  TPS_REG_DATA_STATUS                              0x5F
+#define  TPS_REG_DATA_STATUS_LEN                          5
+#define  TPS_DATA_STATUS_DATA_CONNECTION                  0, 1
+#define  TPS_DATA_STATUS_DATA_ORIENTATION                 1, 1
+#define  TPS_DATA_STATUS_CABLE_ACTIVE_ORIENTATION         2, 1
+#define  TPS_DATA_STATUS_OVER_CURRENT_OR_TEMPERATURE      3, 1
+#define  TPS_DATA_STATUS_USB2_CONNECTION                  4, 1
+#define  TPS_DATA_STATUS_USB3_CONNECTION                  5, 1
+#define  TPS_DATA_STATUS_USB3_SPEED                       6, 1
+#define  TPS_DATA_STATUS_USB_DATA_ROLE                    7, 1
+#define  TPS_DATA_STATUS_DISPLAYPORT_CONNECTION           8, 1
+#define  TPS_DATA_STATUS_DISPLAYPORT_SOURCE_OR_SINK       9, 1
+#define  TPS_DATA_STATUS_DISPLAYPORT_PIN_ASSIGNMENT       10, 2
+#define  TPS_DATA_STATUS_DEBUG_ACCESSORY_MODE             12, 1
+#define  TPS_DATA_STATUS_IRQ_ACK                          13, 1
+#define  TPS_DATA_STATUS_HPD_IRQ_STICKY                   14, 1
+#define  TPS_DATA_STATUS_HPD_LEVEL                        15, 1
+#define  TPS_DATA_STATUS_TBT_CONNECTION                   16, 1
+#define  TPS_DATA_STATUS_TBT_TYPE                         17, 1
+#define  TPS_DATA_STATUS_CABLE_TYPE                       18, 1
+#define  TPS_DATA_STATUS_VPRO_DOCK_DETECTED               19, 1
+#define  TPS_DATA_STATUS_ACTIVE_LINK_TRAINING             20, 1
+#define  TPS_DATA_STATUS_DEBUG_ALTERNATE_MODE_CONNECTED   21, 1
+#define  TPS_DATA_STATUS_DEBUG_ALTERNATE_MODE_TYPE        22, 1
+#define  TPS_DATA_STATUS_FORCE_LSX                        23, 1
+#define  TPS_DATA_STATUS_CAPABILITY_MISMATCH              24, 1
+#define  TPS_DATA_STATUS_THUNDERBOLT_CABLE_SPEED_SUPPORT  25, 3
+#define  TPS_DATA_STATUS_THUNDERBOLT_CABLE_GEN            28, 2
+#define  TPS_DATA_STATUS_RETIMER_DATA_VALID               30, 1
+#define  TPS_DATA_STATUS_DEBUG_ALTERNATE_MODE_ID          32, 8
+static inline unsigned int tps65987_data_status_data_connection(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_DATA_CONNECTION); }
+static inline unsigned int tps65987_data_status_data_orientation(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_DATA_ORIENTATION); }
+static inline unsigned int tps65987_data_status_cable_active_orientation(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_CABLE_ACTIVE_ORIENTATION); }
+static inline unsigned int tps65987_data_status_over_current_or_temperature(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_OVER_CURRENT_OR_TEMPERATURE); }
+static inline unsigned int tps65987_data_status_usb2_connection(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_USB2_CONNECTION); }
+static inline unsigned int tps65987_data_status_usb3_connection(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_USB3_CONNECTION); }
+static inline unsigned int tps65987_data_status_usb3_speed(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_USB3_SPEED); }
+static inline unsigned int tps65987_data_status_usb_data_role(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_USB_DATA_ROLE); }
+static inline unsigned int tps65987_data_status_displayport_connection(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_DISPLAYPORT_CONNECTION); }
+static inline unsigned int tps65987_data_status_displayport_source_or_sink(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_DISPLAYPORT_SOURCE_OR_SINK); }
+static inline unsigned int tps65987_data_status_displayport_pin_assignment(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_DISPLAYPORT_PIN_ASSIGNMENT); }
+static inline unsigned int tps65987_data_status_debug_accessory_mode(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_DEBUG_ACCESSORY_MODE); }
+static inline unsigned int tps65987_data_status_irq_ack(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_IRQ_ACK); }
+static inline unsigned int tps65987_data_status_hpd_irq_sticky(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_HPD_IRQ_STICKY); }
+static inline unsigned int tps65987_data_status_hpd_level(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_HPD_LEVEL); }
+static inline unsigned int tps65987_data_status_tbt_connection(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_TBT_CONNECTION); }
+static inline unsigned int tps65987_data_status_tbt_type(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_TBT_TYPE); }
+static inline unsigned int tps65987_data_status_cable_type(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_CABLE_TYPE); }
+static inline unsigned int tps65987_data_status_vpro_dock_detected(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_VPRO_DOCK_DETECTED); }
+static inline unsigned int tps65987_data_status_active_link_training(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_ACTIVE_LINK_TRAINING); }
+static inline unsigned int tps65987_data_status_debug_alternate_mode_connected(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_DEBUG_ALTERNATE_MODE_CONNECTED); }
+static inline unsigned int tps65987_data_status_debug_alternate_mode_type(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_DEBUG_ALTERNATE_MODE_TYPE); }
+static inline unsigned int tps65987_data_status_force_lsx(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_FORCE_LSX); }
+static inline unsigned int tps65987_data_status_capability_mismatch(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_CAPABILITY_MISMATCH); }
+static inline unsigned int tps65987_data_status_thunderbolt_cable_speed_support(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_THUNDERBOLT_CABLE_SPEED_SUPPORT); }
+static inline unsigned int tps65987_data_status_thunderbolt_cable_gen(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_THUNDERBOLT_CABLE_GEN); }
+static inline unsigned int tps65987_data_status_retimer_data_valid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_RETIMER_DATA_VALID); }
+static inline unsigned int tps65987_data_status_debug_alternate_mode_id(const unsigned char *buf) { return tps65987_field_get(buf, TPS_DATA_STATUS_DEBUG_ALTERNATE_MODE_ID); }
+
+/*
+* 0x60 RX User VID Attention VDM Register, 29 bytes, DRO
+*/
+#define  TPS_REG_RX_USER_VID_ATTENTION_VDM_REGISTER       0x60
+#define  TPS_REG_RX_USER_VID_ATTENTION_VDM_REGISTER_LEN   29
+#define  TPS_RX_USER_VID_ATTENTION_VDM_REGISTER_NUMBER_OF_VALID_VDOS 0, 3
+#define  TPS_RX_USER_VID_ATTENTION_VDM_REGISTER_NUMBER_OF_REGISTER_UPDATES 5, 3
+static inline unsigned int tps65987_rx_user_vid_attention_vdm_register_number_of_valid_vdos(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RX_USER_VID_ATTENTION_VDM_REGISTER_NUMBER_OF_VALID_VDOS); }
+static inline unsigned int tps65987_rx_user_vid_attention_vdm_register_number_of_register_updates(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RX_USER_VID_ATTENTION_VDM_REGISTER_NUMBER_OF_REGISTER_UPDATES); }
+
+/*
+* 0x61 RX User VID Other VDM Register, 29 bytes, DRO
+*/
+#define  TPS_REG_RX_USER_VID_OTHER_VDM_REGISTER           0x61
+#define  TPS_REG_RX_USER_VID_OTHER_VDM_REGISTER_LEN       29
+#define  TPS_RX_USER_VID_OTHER_VDM_REGISTER_NUMBER_OF_VALID_VDOS 0, 3
+#define  TPS_RX_USER_VID_OTHER_VDM_REGISTER_NUMBER_OF_REGISTER_UPDATES 5, 3
+static inline unsigned int tps65987_rx_user_vid_other_vdm_register_number_of_valid_vdos(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RX_USER_VID_OTHER_VDM_REGISTER_NUMBER_OF_VALID_VDOS); }
+static inline unsigned int tps65987_rx_user_vid_other_vdm_register_number_of_register_updates(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RX_USER_VID_OTHER_VDM_REGISTER_NUMBER_OF_REGISTER_UPDATES); }
+
+/*
+* 0x62 App Config Binary Data Indices, 10 bytes, RO
+*/
+#define  TPS_REG_APP_CONFIG_BINARY_DATA_INDICES           0x62
+#define  TPS_REG_APP_CONFIG_BINARY_DATA_INDICES_LEN       10
+#define  TPS_APP_CONFIG_BINARY_DATA_INDICES_COUNTRY_CODES_START_INDEX 0, 8
+#define  TPS_APP_CONFIG_BINARY_DATA_INDICES_COUNTRY_CODES_NUMBER_OF_INDICES 8, 8
+#define  TPS_APP_CONFIG_BINARY_DATA_INDICES_COMMON_I2C_RECORD_START_INDEX 16, 8
+#define  TPS_APP_CONFIG_BINARY_DATA_INDICES_COMMON_I2C_RECORD_NUMBER_OF_INDICES 24, 8
+#define  TPS_APP_CONFIG_BINARY_DATA_INDICES_PORT_1_I2C_RECORD_START_INDEX 32, 8
+#define  TPS_APP_CONFIG_BINARY_DATA_INDICES_PORT_1_I2C_RECORD_NUMBER_OF_INDICES 40, 8
+#define  TPS_APP_CONFIG_BINARY_DATA_INDICES_PORT_2_I2C_RECORD_START_INDEX 48, 8
+#define  TPS_APP_CONFIG_BINARY_DATA_INDICES_PORT_2_I2C_RECORD_NUMBER_OF_INDICES 56, 8
+#define  TPS_APP_CONFIG_BINARY_DATA_INDICES_FUTURE_USE_1  64, 8
+#define  TPS_APP_CONFIG_BINARY_DATA_INDICES_FUTURE_USE_2  72, 8
+static inline unsigned int tps65987_app_config_binary_data_indices_country_codes_start_index(const unsigned char *buf) { return tps65987_field_get(buf, TPS_APP_CONFIG_BINARY_DATA_INDICES_COUNTRY_CODES_START_INDEX); }
+static inline unsigned int tps65987_app_config_binary_data_indices_country_codes_number_of_indices(const unsigned char *buf) { return tps65987_field_get(buf, TPS_APP_CONFIG_BINARY_DATA_INDICES_COUNTRY_CODES_NUMBER_OF_INDICES); }
+static inline unsigned int tps65987_app_config_binary_data_indices_common_i2c_record_start_index(const unsigned char *buf) { return tps65987_field_get(buf, TPS_APP_CONFIG_BINARY_DATA_INDICES_COMMON_I2C_RECORD_START_INDEX); }
+static inline unsigned int tps65987_app_config_binary_data_indices_common_i2c_record_number_of_indices(const unsigned char *buf) { return tps65987_field_get(buf, TPS_APP_CONFIG_BINARY_DATA_INDICES_COMMON_I2C_RECORD_NUMBER_OF_INDICES); }
+static inline unsigned int tps65987_app_config_binary_data_indices_port_1_i2c_record_start_index(const unsigned char *buf) { return tps65987_field_get(buf, TPS_APP_CONFIG_BINARY_DATA_INDICES_PORT_1_I2C_RECORD_START_INDEX); }
+static inline unsigned int tps65987_app_config_binary_data_indices_port_1_i2c_record_number_of_indices(const unsigned char *buf) { return tps65987_field_get(buf, TPS_APP_CONFIG_BINARY_DATA_INDICES_PORT_1_I2C_RECORD_NUMBER_OF_INDICES); }
+static inline unsigned int tps65987_app_config_binary_data_indices_port_2_i2c_record_start_index(const unsigned char *buf) { return tps65987_field_get(buf, TPS_APP_CONFIG_BINARY_DATA_INDICES_PORT_2_I2C_RECORD_START_INDEX); }
+static inline unsigned int tps65987_app_config_binary_data_indices_port_2_i2c_record_number_of_indices(const unsigned char *buf) { return tps65987_field_get(buf, TPS_APP_CONFIG_BINARY_DATA_INDICES_PORT_2_I2C_RECORD_NUMBER_OF_INDICES); }
+static inline unsigned int tps65987_app_config_binary_data_indices_future_use_1(const unsigned char *buf) { return tps65987_field_get(buf, TPS_APP_CONFIG_BINARY_DATA_INDICES_FUTURE_USE_1); }
+static inline unsigned int tps65987_app_config_binary_data_indices_future_use_2(const unsigned char *buf) { return tps65987_field_get(buf, TPS_APP_CONFIG_BINARY_DATA_INDICES_FUTURE_USE_2); }
+
+/*
+* 0x63 MIPI VID Status, 1 bytes, DRO
+*/
+#define  TPS_REG_MIPI_VID_STATUS                          0x63
+#define  TPS_REG_MIPI_VID_STATUS_LEN                      1
+#define  TPS_MIPI_VID_STATUS_MIPI_VID_DETECTED            0, 1
+#define  TPS_MIPI_VID_STATUS_MIPI_DEBUG_MODE_ENTERED      1, 1
+#define  TPS_MIPI_VID_STATUS_ERROR_CODE                   2, 3
+static inline unsigned int tps65987_mipi_vid_status_mipi_vid_detected(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MIPI_VID_STATUS_MIPI_VID_DETECTED); }
+static inline unsigned int tps65987_mipi_vid_status_mipi_debug_mode_entered(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MIPI_VID_STATUS_MIPI_DEBUG_MODE_ENTERED); }
+static inline unsigned int tps65987_mipi_vid_status_error_code(const unsigned char *buf) { return tps65987_field_get(buf, TPS_MIPI_VID_STATUS_ERROR_CODE); }
+
+/*
+* 0x64 I2C Master Configuration, 20 bytes, RO
+*/
+#define  TPS_REG_I2C_MASTER_CONFIGURATION                 0x64
+#define  TPS_REG_I2C_MASTER_CONFIGURATION_LEN             20
+
+/*
+* 0x69 Type C State Register, 4 bytes, DRO
+*/
+#define  TPS_REG_TYPE_C_STATE_REGISTER                    0x69
+#define  TPS_REG_TYPE_C_STATE_REGISTER_LEN                4
+#define  TPS_TYPE_C_STATE_REGISTER_CC_PIN_FOR_PD          0, 8
+#define  TPS_TYPE_C_STATE_REGISTER_CC1_PIN_STATE          8, 8
+#define  TPS_TYPE_C_STATE_REGISTER_CC2_PIN_STATE          16, 8
+#define  TPS_TYPE_C_STATE_REGISTER_TYPE_C_PORT_STATE      24, 8
+static inline unsigned int tps65987_type_c_state_register_cc_pin_for_pd(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TYPE_C_STATE_REGISTER_CC_PIN_FOR_PD); }
+static inline unsigned int tps65987_type_c_state_register_cc1_pin_state(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TYPE_C_STATE_REGISTER_CC1_PIN_STATE); }
+static inline unsigned int tps65987_type_c_state_register_cc2_pin_state(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TYPE_C_STATE_REGISTER_CC2_PIN_STATE); }
+static inline unsigned int tps65987_type_c_state_register_type_c_port_state(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TYPE_C_STATE_REGISTER_TYPE_C_PORT_STATE); }
+
+/*
+* 0x6A ADC results Register, 10 bytes, DRO
+*/
+#define  TPS_REG_ADC_RESULTS_REGISTER                     0x6A
+#define  TPS_REG_ADC_RESULTS_REGISTER_LEN                 10
+#define  TPS_ADC_RESULTS_REGISTER_SINGLE_ADC_CONVERSION   0, 10
+#define  TPS_ADC_RESULTS_REGISTER_CHANNEL_1_ADC_CONVERSION 16, 10
+#define  TPS_ADC_RESULTS_REGISTER_CHANNEL_2_ADC_CONVERSION 32, 10
+#define  TPS_ADC_RESULTS_REGISTER_CHANNEL_3_ADC_CONVERSION 48, 10
+#define  TPS_ADC_RESULTS_REGISTER_CHANNEL_4_ADC_CONVERSION 64, 10
+static inline unsigned int tps65987_adc_results_register_single_adc_conversion(const unsigned char *buf) { return tps65987_field_get(buf, TPS_ADC_RESULTS_REGISTER_SINGLE_ADC_CONVERSION); }
+static inline unsigned int tps65987_adc_results_register_channel_1_adc_conversion(const unsigned char *buf) { return tps65987_field_get(buf, TPS_ADC_RESULTS_REGISTER_CHANNEL_1_ADC_CONVERSION); }
+static inline unsigned int tps65987_adc_results_register_channel_2_adc_conversion(const unsigned char *buf) { return tps65987_field_get(buf, TPS_ADC_RESULTS_REGISTER_CHANNEL_2_ADC_CONVERSION); }
+static inline unsigned int tps65987_adc_results_register_channel_3_adc_conversion(const unsigned char *buf) { return tps65987_field_get(buf, TPS_ADC_RESULTS_REGISTER_CHANNEL_3_ADC_CONVERSION); }
+static inline unsigned int tps65987_adc_results_register_channel_4_adc_conversion(const unsigned char *buf) { return tps65987_field_get(buf, TPS_ADC_RESULTS_REGISTER_CHANNEL_4_ADC_CONVERSION); }
+
+/*
+* 0x6B HW control Register, 12 bytes, DRW
+*/
+#define  TPS_REG_HW_CONTROL_REGISTER                      0x6B
+#define  TPS_REG_HW_CONTROL_REGISTER_LEN                  12
+#define  TPS_HW_CONTROL_REGISTER_ENABLE_OF_PWM1           0, 1
+#define  TPS_HW_CONTROL_REGISTER_PWM1_CLOCK_SOURCE        1, 1
+#define  TPS_HW_CONTROL_REGISTER_PWM1_CLOCK_PERIOD        8, 4
+#define  TPS_HW_CONTROL_REGISTER_PWM1_PULSE_WIDTH         16, 8
+#define  TPS_HW_CONTROL_REGISTER_ENABLE_OF_PWM2           32, 1
+#define  TPS_HW_CONTROL_REGISTER_PWM2_CLOCK_SOURCE        33, 1
+#define  TPS_HW_CONTROL_REGISTER_PWM2_CLOCK_PERIOD        40, 4
+#define  TPS_HW_CONTROL_REGISTER_PWM2_PULSE_WIDTH         48, 8
+static inline unsigned int tps65987_hw_control_register_enable_of_pwm1(const unsigned char *buf) { return tps65987_field_get(buf, TPS_HW_CONTROL_REGISTER_ENABLE_OF_PWM1); }
+static inline void tps65987_set_hw_control_register_enable_of_pwm1(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_HW_CONTROL_REGISTER_ENABLE_OF_PWM1, v); }
+static inline unsigned int tps65987_hw_control_register_pwm1_clock_source(const unsigned char *buf) { return tps65987_field_get(buf, TPS_HW_CONTROL_REGISTER_PWM1_CLOCK_SOURCE); }
+static inline void tps65987_set_hw_control_register_pwm1_clock_source(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_HW_CONTROL_REGISTER_PWM1_CLOCK_SOURCE, v); }
+static inline unsigned int tps65987_hw_control_register_pwm1_clock_period(const unsigned char *buf) { return tps65987_field_get(buf, TPS_HW_CONTROL_REGISTER_PWM1_CLOCK_PERIOD); }
+static inline void tps65987_set_hw_control_register_pwm1_clock_period(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_HW_CONTROL_REGISTER_PWM1_CLOCK_PERIOD, v); }
+static inline unsigned int tps65987_hw_control_register_pwm1_pulse_width(const unsigned char *buf) { return tps65987_field_get(buf, TPS_HW_CONTROL_REGISTER_PWM1_PULSE_WIDTH); }
+static inline void tps65987_set_hw_control_register_pwm1_pulse_width(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_HW_CONTROL_REGISTER_PWM1_PULSE_WIDTH, v); }
+static inline unsigned int tps65987_hw_control_register_enable_of_pwm2(const unsigned char *buf) { return tps65987_field_get(buf, TPS_HW_CONTROL_REGISTER_ENABLE_OF_PWM2); }
+static inline void tps65987_set_hw_control_register_enable_of_pwm2(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_HW_CONTROL_REGISTER_ENABLE_OF_PWM2, v); }
+static inline unsigned int tps65987_hw_control_register_pwm2_clock_source(const unsigned char *buf) { return tps65987_field_get(buf, TPS_HW_CONTROL_REGISTER_PWM2_CLOCK_SOURCE); }
+static inline void tps65987_set_hw_control_register_pwm2_clock_source(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_HW_CONTROL_REGISTER_PWM2_CLOCK_SOURCE, v); }
+static inline unsigned int tps65987_hw_control_register_pwm2_clock_period(const unsigned char *buf) { return tps65987_field_get(buf, TPS_HW_CONTROL_REGISTER_PWM2_CLOCK_PERIOD); }
+static inline void tps65987_set_hw_control_register_pwm2_clock_period(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_HW_CONTROL_REGISTER_PWM2_CLOCK_PERIOD, v); }
+static inline unsigned int tps65987_hw_control_register_pwm2_pulse_width(const unsigned char *buf) { return tps65987_field_get(buf, TPS_HW_CONTROL_REGISTER_PWM2_PULSE_WIDTH); }
+static inline void tps65987_set_hw_control_register_pwm2_pulse_width(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_HW_CONTROL_REGISTER_PWM2_PULSE_WIDTH, v); }
+
+/*
+* 0x6C App configuration Register, 60 bytes, RW
+*/
+#define  TPS_REG_APP_CONFIGURATION_REGISTER               0x6C
+#define  TPS_REG_APP_CONFIGURATION_REGISTER_LEN           60
+
+/*
+* 0x70 Sleep Control Register, 1 bytes, RW
+*/
+#define  TPS_REG_SLEEP_CONTROL_REGISTER                   0x70
+#define  TPS_REG_SLEEP_CONTROL_REGISTER_LEN               1
+#define  TPS_SLEEP_CONTROL_REGISTER_SLEEP_MODE_ALLOWED    0, 1
+#define  TPS_SLEEP_CONTROL_REGISTER_DELAY_100_MS_BEFORE_SLEEP 1, 1
+#define  TPS_SLEEP_CONTROL_REGISTER_DELAY_1000_MS_BEFORE_SLEEP 2, 1
+#define  TPS_SLEEP_CONTROL_REGISTER_DELAY_30000_MS_BEFORE_SLEEP 4, 1
+#define  TPS_SLEEP_CONTROL_REGISTER_SLEEP_ON_5V_NON_PD_LOAD 3, 1
+static inline unsigned int tps65987_sleep_control_register_sleep_mode_allowed(const unsigned char *buf) { return tps65987_field_get(buf, TPS_SLEEP_CONTROL_REGISTER_SLEEP_MODE_ALLOWED); }
+static inline void tps65987_set_sleep_control_register_sleep_mode_allowed(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_SLEEP_CONTROL_REGISTER_SLEEP_MODE_ALLOWED, v); }
+static inline unsigned int tps65987_sleep_control_register_delay_100_ms_before_sleep(const unsigned char *buf) { return tps65987_field_get(buf, TPS_SLEEP_CONTROL_REGISTER_DELAY_100_MS_BEFORE_SLEEP); }
+static inline void tps65987_set_sleep_control_register_delay_100_ms_before_sleep(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_SLEEP_CONTROL_REGISTER_DELAY_100_MS_BEFORE_SLEEP, v); }
+static inline unsigned int tps65987_sleep_control_register_delay_1000_ms_before_sleep(const unsigned char *buf) { return tps65987_field_get(buf, TPS_SLEEP_CONTROL_REGISTER_DELAY_1000_MS_BEFORE_SLEEP); }
+static inline void tps65987_set_sleep_control_register_delay_1000_ms_before_sleep(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_SLEEP_CONTROL_REGISTER_DELAY_1000_MS_BEFORE_SLEEP, v); }
+static inline unsigned int tps65987_sleep_control_register_delay_30000_ms_before_sleep(const unsigned char *buf) { return tps65987_field_get(buf, TPS_SLEEP_CONTROL_REGISTER_DELAY_30000_MS_BEFORE_SLEEP); }
+static inline void tps65987_set_sleep_control_register_delay_30000_ms_before_sleep(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_SLEEP_CONTROL_REGISTER_DELAY_30000_MS_BEFORE_SLEEP, v); }
+static inline unsigned int tps65987_sleep_control_register_sleep_on_5v_non_pd_load(const unsigned char *buf) { return tps65987_field_get(buf, TPS_SLEEP_CONTROL_REGISTER_SLEEP_ON_5V_NON_PD_LOAD); }
+static inline void tps65987_set_sleep_control_register_sleep_on_5v_non_pd_load(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_SLEEP_CONTROL_REGISTER_SLEEP_ON_5V_NON_PD_LOAD, v); }
+
+/*
+* 0x71 Received Manufacturer Info Data Block SOP, 26 bytes, DRO
+*/
+#define  TPS_REG_RECEIVED_MANUFACTURER_INFO_DATA_BLOCK_SOP 0x71
+#define  TPS_REG_RECEIVED_MANUFACTURER_INFO_DATA_BLOCK_SOP_LEN 26
+#define  TPS_RECEIVED_MANUFACTURER_INFO_DATA_BLOCK_SOP_VID 0, 16
+#define  TPS_RECEIVED_MANUFACTURER_INFO_DATA_BLOCK_SOP_PID 16, 16
+#define  TPS_RECEIVED_MANUFACTURER_INFO_DATA_BLOCK_SOP_MANUFACTURERSTRING 16, 16
+static inline unsigned int tps65987_received_manufacturer_info_data_block_sop_vid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_MANUFACTURER_INFO_DATA_BLOCK_SOP_VID); }
+static inline unsigned int tps65987_received_manufacturer_info_data_block_sop_pid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_MANUFACTURER_INFO_DATA_BLOCK_SOP_PID); }
+static inline unsigned int tps65987_received_manufacturer_info_data_block_sop_manufacturerstring(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_MANUFACTURER_INFO_DATA_BLOCK_SOP_MANUFACTURERSTRING); }
+
+/*
+* 0x72 GPIO Status Register, 8 bytes, DRO
+*/
+#define  TPS_REG_GPIO_STATUS_REGISTER                     0x72
+#define  TPS_REG_GPIO_STATUS_REGISTER_LEN                 8
+
+/*
+* 0x73 Tx Manufacturer Info SOP, 26 bytes, RW
+*/
+#define  TPS_REG_TX_MANUFACTURER_INFO_SOP                 0x73
+#define  TPS_REG_TX_MANUFACTURER_INFO_SOP_LEN             26
+#define  TPS_TX_MANUFACTURER_INFO_SOP_VENDOR_ID           0, 16
+#define  TPS_TX_MANUFACTURER_INFO_SOP_PRODUCT_ID          16, 16
+#define  TPS_TX_MANUFACTURER_INFO_SOP_MANUFACTURER_STRING 32, 176
+static inline unsigned int tps65987_tx_manufacturer_info_sop_vendor_id(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_MANUFACTURER_INFO_SOP_VENDOR_ID); }
+static inline void tps65987_set_tx_manufacturer_info_sop_vendor_id(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_MANUFACTURER_INFO_SOP_VENDOR_ID, v); }
+static inline unsigned int tps65987_tx_manufacturer_info_sop_product_id(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_MANUFACTURER_INFO_SOP_PRODUCT_ID); }
+static inline void tps65987_set_tx_manufacturer_info_sop_product_id(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_MANUFACTURER_INFO_SOP_PRODUCT_ID, v); }
+
+/*
+* 0x74 Received Alert Data Object (ADO) Register, 4 bytes, DRO
+*/
+#define  TPS_REG_RECEIVED_ALERT_DATA_OBJECT_ADO_REGISTER  0x74
+#define  TPS_REG_RECEIVED_ALERT_DATA_OBJECT_ADO_REGISTER_LEN 4
+#define  TPS_RECEIVED_ALERT_DATA_OBJECT_ADO_REGISTER_HOT_SWAP_BATTERIES 16, 4
+#define  TPS_RECEIVED_ALERT_DATA_OBJECT_ADO_REGISTER_FIXED_BATTERIES 20, 4
+#define  TPS_RECEIVED_ALERT_DATA_OBJECT_ADO_REGISTER_ALERT_TYPE 24, 8
+static inline unsigned int tps65987_received_alert_data_object_ado_register_hot_swap_batteries(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_ALERT_DATA_OBJECT_ADO_REGISTER_HOT_SWAP_BATTERIES); }
+static inline unsigned int tps65987_received_alert_data_object_ado_register_fixed_batteries(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_ALERT_DATA_OBJECT_ADO_REGISTER_FIXED_BATTERIES); }
+static inline unsigned int tps65987_received_alert_data_object_ado_register_alert_type(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_ALERT_DATA_OBJECT_ADO_REGISTER_ALERT_TYPE); }
+
+/*
+* 0x75 Transmit Alert Data Object (ADO) Register, 4 bytes, DRW
+*/
+#define  TPS_REG_TRANSMIT_ALERT_DATA_OBJECT_ADO_REGISTER  0x75
+#define  TPS_REG_TRANSMIT_ALERT_DATA_OBJECT_ADO_REGISTER_LEN 4
+#define  TPS_TRANSMIT_ALERT_DATA_OBJECT_ADO_REGISTER_HOT_SWAP_BATTERIES 16, 4
+#define  TPS_TRANSMIT_ALERT_DATA_OBJECT_ADO_REGISTER_FIXED_BATTERIES 20, 4
+#define  TPS_TRANSMIT_ALERT_DATA_OBJECT_ADO_REGISTER_ALERT_TYPE 24, 8
+static inline unsigned int tps65987_transmit_alert_data_object_ado_register_hot_swap_batteries(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMIT_ALERT_DATA_OBJECT_ADO_REGISTER_HOT_SWAP_BATTERIES); }
+static inline void tps65987_set_transmit_alert_data_object_ado_register_hot_swap_batteries(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMIT_ALERT_DATA_OBJECT_ADO_REGISTER_HOT_SWAP_BATTERIES, v); }
+static inline unsigned int tps65987_transmit_alert_data_object_ado_register_fixed_batteries(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMIT_ALERT_DATA_OBJECT_ADO_REGISTER_FIXED_BATTERIES); }
+static inline void tps65987_set_transmit_alert_data_object_ado_register_fixed_batteries(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMIT_ALERT_DATA_OBJECT_ADO_REGISTER_FIXED_BATTERIES, v); }
+static inline unsigned int tps65987_transmit_alert_data_object_ado_register_alert_type(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMIT_ALERT_DATA_OBJECT_ADO_REGISTER_ALERT_TYPE); }
+static inline void tps65987_set_transmit_alert_data_object_ado_register_alert_type(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMIT_ALERT_DATA_OBJECT_ADO_REGISTER_ALERT_TYPE, v); }
+
+/*
+* 0x76 Received Source Capabilities Extended Data Block (SCEDB) Register, 24 bytes, DRO
+*/
+#define  TPS_REG_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER 0x76
+#define  TPS_REG_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_LEN 24
+#define  TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_VID 0, 16
+#define  TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_PID 16, 16
+#define  TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_PXD 32, 32
+#define  TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_FW_VERSION 64, 8
+#define  TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_HW_VERSION 72, 8
+#define  TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_VOLTAGEREGULATION 80, 8
+#define  TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_HOLDUP_TIME 88, 8
+#define  TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_COMPLIANCE 96, 8
+#define  TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_TOUCHCURRENT 104, 8
+#define  TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_PEAK_CURRENT_1 112, 16
+#define  TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_PEAK_CURRENT_2 128, 16
+#define  TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_PEAK_CURRENT_3 144, 16
+#define  TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_TOUCH_TEMPERATURE 160, 8
+#define  TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_SOURCE_INPUTS 168, 8
+#define  TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_BATTERIES 176, 8
+static inline unsigned int tps65987_received_source_capabilities_extended_data_block_scedb_register_vid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_VID); }
+static inline unsigned int tps65987_received_source_capabilities_extended_data_block_scedb_register_pid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_PID); }
+static inline unsigned int tps65987_received_source_capabilities_extended_data_block_scedb_register_pxd(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_PXD); }
+static inline unsigned int tps65987_received_source_capabilities_extended_data_block_scedb_register_fw_version(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_FW_VERSION); }
+static inline unsigned int tps65987_received_source_capabilities_extended_data_block_scedb_register_hw_version(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_HW_VERSION); }
+static inline unsigned int tps65987_received_source_capabilities_extended_data_block_scedb_register_voltageregulation(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_VOLTAGEREGULATION); }
+static inline unsigned int tps65987_received_source_capabilities_extended_data_block_scedb_register_holdup_time(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_HOLDUP_TIME); }
+static inline unsigned int tps65987_received_source_capabilities_extended_data_block_scedb_register_compliance(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_COMPLIANCE); }
+static inline unsigned int tps65987_received_source_capabilities_extended_data_block_scedb_register_touchcurrent(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_TOUCHCURRENT); }
+static inline unsigned int tps65987_received_source_capabilities_extended_data_block_scedb_register_peak_current_1(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_PEAK_CURRENT_1); }
+static inline unsigned int tps65987_received_source_capabilities_extended_data_block_scedb_register_peak_current_2(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_PEAK_CURRENT_2); }
+static inline unsigned int tps65987_received_source_capabilities_extended_data_block_scedb_register_peak_current_3(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_PEAK_CURRENT_3); }
+static inline unsigned int tps65987_received_source_capabilities_extended_data_block_scedb_register_touch_temperature(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_TOUCH_TEMPERATURE); }
+static inline unsigned int tps65987_received_source_capabilities_extended_data_block_scedb_register_source_inputs(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_SOURCE_INPUTS); }
+static inline unsigned int tps65987_received_source_capabilities_extended_data_block_scedb_register_batteries(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_SCEDB_REGISTER_BATTERIES); }
+
+/*
+* 0x77 Tx Source Capabilities Extended Data Block, 24 bytes, RW
+*/
+#define  TPS_REG_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK 0x77
+#define  TPS_REG_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_LEN 24
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_VENDOR_ID_VID 0, 16
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_PRODUCT_ID_PID 16, 16
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_MANUFACTURER_ID_XID 32, 32
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_FIRMWARE_VERSION 64, 8
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_HARDWARE_VERSION 72, 8
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_LOAD_STEP 80, 2
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_IOC 82, 1
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_HOLDUP_TIME 88, 8
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_LPS_COMPLIANT 96, 1
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_PS1_COMPLIANT 97, 1
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_PS2_COMPLIANT 98, 1
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_LOW_TOUCH_CURRENT_EPS 104, 1
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_GROUND_PIN_SUPPORTED 105, 1
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_GROUND_PIN_INTENDED_FOR_PROTECTIVE_EARTH 106, 1
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_TOUCH_TEMPERATURE 160, 8
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_EXTERNAL_SUPPLY_PRESENT 168, 1
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_EXTERNAL_SUPPLY_IS_UNCONSTRAINED 169, 1
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_INTERNAL_BATTERY_PRESENT 170, 1
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_NUMBER_OF_FIXED_BATTERIES 176, 4
+#define  TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_NUMBER_OF_HOT_SWAPPABLE_BATTERIES 180, 4
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_vendor_id_vid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_VENDOR_ID_VID); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_vendor_id_vid(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_VENDOR_ID_VID, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_product_id_pid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_PRODUCT_ID_PID); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_product_id_pid(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_PRODUCT_ID_PID, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_manufacturer_id_xid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_MANUFACTURER_ID_XID); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_manufacturer_id_xid(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_MANUFACTURER_ID_XID, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_firmware_version(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_FIRMWARE_VERSION); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_firmware_version(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_FIRMWARE_VERSION, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_hardware_version(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_HARDWARE_VERSION); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_hardware_version(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_HARDWARE_VERSION, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_load_step(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_LOAD_STEP); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_load_step(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_LOAD_STEP, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_ioc(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_IOC); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_ioc(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_IOC, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_holdup_time(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_HOLDUP_TIME); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_holdup_time(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_HOLDUP_TIME, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_lps_compliant(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_LPS_COMPLIANT); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_lps_compliant(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_LPS_COMPLIANT, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_ps1_compliant(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_PS1_COMPLIANT); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_ps1_compliant(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_PS1_COMPLIANT, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_ps2_compliant(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_PS2_COMPLIANT); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_ps2_compliant(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_PS2_COMPLIANT, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_low_touch_current_eps(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_LOW_TOUCH_CURRENT_EPS); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_low_touch_current_eps(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_LOW_TOUCH_CURRENT_EPS, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_ground_pin_supported(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_GROUND_PIN_SUPPORTED); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_ground_pin_supported(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_GROUND_PIN_SUPPORTED, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_ground_pin_intended_for_protective_earth(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_GROUND_PIN_INTENDED_FOR_PROTECTIVE_EARTH); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_ground_pin_intended_for_protective_earth(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_GROUND_PIN_INTENDED_FOR_PROTECTIVE_EARTH, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_touch_temperature(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_TOUCH_TEMPERATURE); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_touch_temperature(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_TOUCH_TEMPERATURE, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_external_supply_present(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_EXTERNAL_SUPPLY_PRESENT); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_external_supply_present(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_EXTERNAL_SUPPLY_PRESENT, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_external_supply_is_unconstrained(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_EXTERNAL_SUPPLY_IS_UNCONSTRAINED); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_external_supply_is_unconstrained(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_EXTERNAL_SUPPLY_IS_UNCONSTRAINED, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_internal_battery_present(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_INTERNAL_BATTERY_PRESENT); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_internal_battery_present(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_INTERNAL_BATTERY_PRESENT, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_number_of_fixed_batteries(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_NUMBER_OF_FIXED_BATTERIES); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_number_of_fixed_batteries(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_NUMBER_OF_FIXED_BATTERIES, v); }
+static inline unsigned int tps65987_tx_source_capabilities_extended_data_block_number_of_hot_swappable_batteries(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_NUMBER_OF_HOT_SWAPPABLE_BATTERIES); }
+static inline void tps65987_set_tx_source_capabilities_extended_data_block_number_of_hot_swappable_batteries(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_SOURCE_CAPABILITIES_EXTENDED_DATA_BLOCK_NUMBER_OF_HOT_SWAPPABLE_BATTERIES, v); }
+
+/*
+* 0x78 Received Status Data Block (SDB) Register, 5 bytes, DRO
+*/
+#define  TPS_REG_RECEIVED_STATUS_DATA_BLOCK_SDB_REGISTER  0x78
+#define  TPS_REG_RECEIVED_STATUS_DATA_BLOCK_SDB_REGISTER_LEN 5
+#define  TPS_RECEIVED_STATUS_DATA_BLOCK_SDB_REGISTER_INTERNAL_TEMPERATURE 0, 8
+#define  TPS_RECEIVED_STATUS_DATA_BLOCK_SDB_REGISTER_PRESENT_INPUT 8, 8
+#define  TPS_RECEIVED_STATUS_DATA_BLOCK_SDB_REGISTER_PRESENT_BATTERY_INPUT 16, 8
+#define  TPS_RECEIVED_STATUS_DATA_BLOCK_SDB_REGISTER_EVENT_FLAGS 24, 8
+#define  TPS_RECEIVED_STATUS_DATA_BLOCK_SDB_REGISTER_TEMPERATURE_STATUS 32, 8
+static inline unsigned int tps65987_received_status_data_block_sdb_register_internal_temperature(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_STATUS_DATA_BLOCK_SDB_REGISTER_INTERNAL_TEMPERATURE); }
+static inline unsigned int tps65987_received_status_data_block_sdb_register_present_input(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_STATUS_DATA_BLOCK_SDB_REGISTER_PRESENT_INPUT); }
+static inline unsigned int tps65987_received_status_data_block_sdb_register_present_battery_input(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_STATUS_DATA_BLOCK_SDB_REGISTER_PRESENT_BATTERY_INPUT); }
+static inline unsigned int tps65987_received_status_data_block_sdb_register_event_flags(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_STATUS_DATA_BLOCK_SDB_REGISTER_EVENT_FLAGS); }
+static inline unsigned int tps65987_received_status_data_block_sdb_register_temperature_status(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_STATUS_DATA_BLOCK_SDB_REGISTER_TEMPERATURE_STATUS); }
+
+/*
+* 0x79 Transmitted Status Data Block (SDB) Register, 5 bytes, DRW
+*/
+#define  TPS_REG_TRANSMITTED_STATUS_DATA_BLOCK_SDB_REGISTER 0x79
+#define  TPS_REG_TRANSMITTED_STATUS_DATA_BLOCK_SDB_REGISTER_LEN 5
+#define  TPS_TRANSMITTED_STATUS_DATA_BLOCK_SDB_REGISTER_INTERNAL_TEMPERATURE 0, 8
+#define  TPS_TRANSMITTED_STATUS_DATA_BLOCK_SDB_REGISTER_PRESENT_INPUT 8, 8
+#define  TPS_TRANSMITTED_STATUS_DATA_BLOCK_SDB_REGISTER_PRESENT_BATTERY_INPUT 16, 8
+#define  TPS_TRANSMITTED_STATUS_DATA_BLOCK_SDB_REGISTER_EVENT_FLAGS 24, 8
+#define  TPS_TRANSMITTED_STATUS_DATA_BLOCK_SDB_REGISTER_TEMPERATURE_STATUS 32, 8
+static inline unsigned int tps65987_transmitted_status_data_block_sdb_register_internal_temperature(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMITTED_STATUS_DATA_BLOCK_SDB_REGISTER_INTERNAL_TEMPERATURE); }
+static inline void tps65987_set_transmitted_status_data_block_sdb_register_internal_temperature(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMITTED_STATUS_DATA_BLOCK_SDB_REGISTER_INTERNAL_TEMPERATURE, v); }
+static inline unsigned int tps65987_transmitted_status_data_block_sdb_register_present_input(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMITTED_STATUS_DATA_BLOCK_SDB_REGISTER_PRESENT_INPUT); }
+static inline void tps65987_set_transmitted_status_data_block_sdb_register_present_input(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMITTED_STATUS_DATA_BLOCK_SDB_REGISTER_PRESENT_INPUT, v); }
+static inline unsigned int tps65987_transmitted_status_data_block_sdb_register_present_battery_input(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMITTED_STATUS_DATA_BLOCK_SDB_REGISTER_PRESENT_BATTERY_INPUT); }
+static inline void tps65987_set_transmitted_status_data_block_sdb_register_present_battery_input(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMITTED_STATUS_DATA_BLOCK_SDB_REGISTER_PRESENT_BATTERY_INPUT, v); }
+static inline unsigned int tps65987_transmitted_status_data_block_sdb_register_event_flags(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMITTED_STATUS_DATA_BLOCK_SDB_REGISTER_EVENT_FLAGS); }
+static inline void tps65987_set_transmitted_status_data_block_sdb_register_event_flags(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMITTED_STATUS_DATA_BLOCK_SDB_REGISTER_EVENT_FLAGS, v); }
+static inline unsigned int tps65987_transmitted_status_data_block_sdb_register_temperature_status(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMITTED_STATUS_DATA_BLOCK_SDB_REGISTER_TEMPERATURE_STATUS); }
+static inline void tps65987_set_transmitted_status_data_block_sdb_register_temperature_status(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMITTED_STATUS_DATA_BLOCK_SDB_REGISTER_TEMPERATURE_STATUS, v); }
+
+/*
+* 0x7A Received Battery Status Data Objects (BSDO) Register, 32 bytes, DRO
+*/
+#define  TPS_REG_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER 0x7A
+#define  TPS_REG_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LEN 32
+#define  TPS_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_BATTERY_INFO 8, 8
+#define  TPS_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_BATTERY_STATE_OF_CHARGE_SOC 16, 16
+#define  TPS_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_0 32, 32
+#define  TPS_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_1 64, 32
+#define  TPS_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_2 96, 32
+#define  TPS_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_3 128, 32
+#define  TPS_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_HOT_SWAPPABLE_BATTERY_0 160, 32
+#define  TPS_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_HOT_SWAPPABLE_BATTERY_1 192, 32
+#define  TPS_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_HOT_SWAPPABLE_BATTERY_2 224, 32
+static inline unsigned int tps65987_received_battery_status_data_objects_bsdo_register_battery_info(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_BATTERY_INFO); }
+static inline unsigned int tps65987_received_battery_status_data_objects_bsdo_register_battery_state_of_charge_soc(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_BATTERY_STATE_OF_CHARGE_SOC); }
+static inline unsigned int tps65987_received_battery_status_data_objects_bsdo_register_latest_bsdo_fixed_battery_0(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_0); }
+static inline unsigned int tps65987_received_battery_status_data_objects_bsdo_register_latest_bsdo_fixed_battery_1(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_1); }
+static inline unsigned int tps65987_received_battery_status_data_objects_bsdo_register_latest_bsdo_fixed_battery_2(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_2); }
+static inline unsigned int tps65987_received_battery_status_data_objects_bsdo_register_latest_bsdo_fixed_battery_3(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_3); }
+static inline unsigned int tps65987_received_battery_status_data_objects_bsdo_register_latest_bsdo_hot_swappable_battery_0(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_HOT_SWAPPABLE_BATTERY_0); }
+static inline unsigned int tps65987_received_battery_status_data_objects_bsdo_register_latest_bsdo_hot_swappable_battery_1(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_HOT_SWAPPABLE_BATTERY_1); }
+static inline unsigned int tps65987_received_battery_status_data_objects_bsdo_register_latest_bsdo_hot_swappable_battery_2(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_HOT_SWAPPABLE_BATTERY_2); }
+
+/*
+* 0x7B Transmitted Battery Status Data Objects (BSDO) Register, 32 bytes, DRW
+*/
+#define  TPS_REG_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER 0x7B
+#define  TPS_REG_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LEN 32
+#define  TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_BATTERY_INFO 8, 8
+#define  TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_BATTERY_STATE_OF_CHARGE_SOC 16, 16
+#define  TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_0 32, 32
+#define  TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_1 64, 32
+#define  TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_2 96, 32
+#define  TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_3 128, 32
+#define  TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_HOT_SWAPPABLE_BATTERY_0 160, 32
+#define  TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_HOT_SWAPPABLE_BATTERY_1 192, 32
+#define  TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_HOT_SWAPPABLE_BATTERY_2 224, 32
+static inline unsigned int tps65987_transmitted_battery_status_data_objects_bsdo_register_battery_info(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_BATTERY_INFO); }
+static inline void tps65987_set_transmitted_battery_status_data_objects_bsdo_register_battery_info(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_BATTERY_INFO, v); }
+static inline unsigned int tps65987_transmitted_battery_status_data_objects_bsdo_register_battery_state_of_charge_soc(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_BATTERY_STATE_OF_CHARGE_SOC); }
+static inline void tps65987_set_transmitted_battery_status_data_objects_bsdo_register_battery_state_of_charge_soc(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_BATTERY_STATE_OF_CHARGE_SOC, v); }
+static inline unsigned int tps65987_transmitted_battery_status_data_objects_bsdo_register_latest_bsdo_fixed_battery_0(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_0); }
+static inline void tps65987_set_transmitted_battery_status_data_objects_bsdo_register_latest_bsdo_fixed_battery_0(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_0, v); }
+static inline unsigned int tps65987_transmitted_battery_status_data_objects_bsdo_register_latest_bsdo_fixed_battery_1(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_1); }
+static inline void tps65987_set_transmitted_battery_status_data_objects_bsdo_register_latest_bsdo_fixed_battery_1(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_1, v); }
+static inline unsigned int tps65987_transmitted_battery_status_data_objects_bsdo_register_latest_bsdo_fixed_battery_2(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_2); }
+static inline void tps65987_set_transmitted_battery_status_data_objects_bsdo_register_latest_bsdo_fixed_battery_2(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_2, v); }
+static inline unsigned int tps65987_transmitted_battery_status_data_objects_bsdo_register_latest_bsdo_fixed_battery_3(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_3); }
+static inline void tps65987_set_transmitted_battery_status_data_objects_bsdo_register_latest_bsdo_fixed_battery_3(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_FIXED_BATTERY_3, v); }
+static inline unsigned int tps65987_transmitted_battery_status_data_objects_bsdo_register_latest_bsdo_hot_swappable_battery_0(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_HOT_SWAPPABLE_BATTERY_0); }
+static inline void tps65987_set_transmitted_battery_status_data_objects_bsdo_register_latest_bsdo_hot_swappable_battery_0(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_HOT_SWAPPABLE_BATTERY_0, v); }
+static inline unsigned int tps65987_transmitted_battery_status_data_objects_bsdo_register_latest_bsdo_hot_swappable_battery_1(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_HOT_SWAPPABLE_BATTERY_1); }
+static inline void tps65987_set_transmitted_battery_status_data_objects_bsdo_register_latest_bsdo_hot_swappable_battery_1(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_HOT_SWAPPABLE_BATTERY_1, v); }
+static inline unsigned int tps65987_transmitted_battery_status_data_objects_bsdo_register_latest_bsdo_hot_swappable_battery_2(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_HOT_SWAPPABLE_BATTERY_2); }
+static inline void tps65987_set_transmitted_battery_status_data_objects_bsdo_register_latest_bsdo_hot_swappable_battery_2(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TRANSMITTED_BATTERY_STATUS_DATA_OBJECTS_BSDO_REGISTER_LATEST_BSDO_HOT_SWAPPABLE_BATTERY_2, v); }
+
+/*
+* 0x7C Received Battery Capability Data Block (BCDB) Register, 9 bytes, DRO
+*/
+#define  TPS_REG_RECEIVED_BATTERY_CAPABILITY_DATA_BLOCK_BCDB_REGISTER 0x7C
+#define  TPS_REG_RECEIVED_BATTERY_CAPABILITY_DATA_BLOCK_BCDB_REGISTER_LEN 9
+#define  TPS_RECEIVED_BATTERY_CAPABILITY_DATA_BLOCK_BCDB_REGISTER_VID 0, 16
+#define  TPS_RECEIVED_BATTERY_CAPABILITY_DATA_BLOCK_BCDB_REGISTER_PID 16, 16
+#define  TPS_RECEIVED_BATTERY_CAPABILITY_DATA_BLOCK_BCDB_REGISTER_BATTERY_DESIGN_CAPACITY 32, 16
+#define  TPS_RECEIVED_BATTERY_CAPABILITY_DATA_BLOCK_BCDB_REGISTER_BATTERY_LAST_FULL_CHARGE_CAPACITY 48, 16
+#define  TPS_RECEIVED_BATTERY_CAPABILITY_DATA_BLOCK_BCDB_REGISTER_BATTERY_TYPE 64, 8
+static inline unsigned int tps65987_received_battery_capability_data_block_bcdb_register_vid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_BATTERY_CAPABILITY_DATA_BLOCK_BCDB_REGISTER_VID); }
+static inline unsigned int tps65987_received_battery_capability_data_block_bcdb_register_pid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_BATTERY_CAPABILITY_DATA_BLOCK_BCDB_REGISTER_PID); }
+static inline unsigned int tps65987_received_battery_capability_data_block_bcdb_register_battery_design_capacity(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_BATTERY_CAPABILITY_DATA_BLOCK_BCDB_REGISTER_BATTERY_DESIGN_CAPACITY); }
+static inline unsigned int tps65987_received_battery_capability_data_block_bcdb_register_battery_last_full_charge_capacity(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_BATTERY_CAPABILITY_DATA_BLOCK_BCDB_REGISTER_BATTERY_LAST_FULL_CHARGE_CAPACITY); }
+static inline unsigned int tps65987_received_battery_capability_data_block_bcdb_register_battery_type(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_BATTERY_CAPABILITY_DATA_BLOCK_BCDB_REGISTER_BATTERY_TYPE); }
+
+/*
+* 0x7D Tx Battery Capabilities, 63 bytes, RW
+*/
+#define  TPS_REG_TX_BATTERY_CAPABILITIES                  0x7D
+#define  TPS_REG_TX_BATTERY_CAPABILITIES_LEN              63
+
+/*
+* 0x7E Received Manufacturer Info Data Block SOPp (MIDB) Register, 26 bytes, DRO
+*/
+#define  TPS_REG_RECEIVED_MANUFACTURER_INFO_DATA_BLOCK_SOPP_MIDB_REGISTER 0x7E
+#define  TPS_REG_RECEIVED_MANUFACTURER_INFO_DATA_BLOCK_SOPP_MIDB_REGISTER_LEN 26
+#define  TPS_RECEIVED_MANUFACTURER_INFO_DATA_BLOCK_SOPP_MIDB_REGISTER_VID 0, 16
+#define  TPS_RECEIVED_MANUFACTURER_INFO_DATA_BLOCK_SOPP_MIDB_REGISTER_PID 16, 16
+#define  TPS_RECEIVED_MANUFACTURER_INFO_DATA_BLOCK_SOPP_MIDB_REGISTER_MANUFACTURER_STRING 32, 176
+static inline unsigned int tps65987_received_manufacturer_info_data_block_sopp_midb_register_vid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_MANUFACTURER_INFO_DATA_BLOCK_SOPP_MIDB_REGISTER_VID); }
+static inline unsigned int tps65987_received_manufacturer_info_data_block_sopp_midb_register_pid(const unsigned char *buf) { return tps65987_field_get(buf, TPS_RECEIVED_MANUFACTURER_INFO_DATA_BLOCK_SOPP_MIDB_REGISTER_PID); }
+
+/*
+* 0x7F Tx Manufacturer Info SOP Prime, 26 bytes, RW
+*/
+#define  TPS_REG_TX_MANUFACTURER_INFO_SOP_PRIME           0x7F
+#define  TPS_REG_TX_MANUFACTURER_INFO_SOP_PRIME_LEN       26
+#define  TPS_TX_MANUFACTURER_INFO_SOP_PRIME_VENDOR_ID     0, 16
+#define  TPS_TX_MANUFACTURER_INFO_SOP_PRIME_PRODUCT_ID    16, 16
+#define  TPS_TX_MANUFACTURER_INFO_SOP_PRIME_MANUFACTURER_STRING 32, 176
+static inline unsigned int tps65987_tx_manufacturer_info_sop_prime_vendor_id(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_MANUFACTURER_INFO_SOP_PRIME_VENDOR_ID); }
+static inline void tps65987_set_tx_manufacturer_info_sop_prime_vendor_id(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_MANUFACTURER_INFO_SOP_PRIME_VENDOR_ID, v); }
+static inline unsigned int tps65987_tx_manufacturer_info_sop_prime_product_id(const unsigned char *buf) { return tps65987_field_get(buf, TPS_TX_MANUFACTURER_INFO_SOP_PRIME_PRODUCT_ID); }
+static inline void tps65987_set_tx_manufacturer_info_sop_prime_product_id(unsigned char *buf, unsigned int v) { tps65987_field_set(buf, TPS_TX_MANUFACTURER_INFO_SOP_PRIME_PRODUCT_ID, v); }
+
+#endif
@@ -0,0 +1,577 @@
+/**
+*  @file      tps65987_replay.c
+*  @brief     tps65987 bus capture and replay transports
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include<errno.h>
+#include<pthread.h>
+
+#include "tps65987_replay.h"
+#include "tps65987_latency.h"
+
+#define  REPLAY_NUM_ADDRS       128
+#define  RECORD_BUF_SIZE        (256 * 1024)
+
+
+typedef struct
+{
+    s_TPS_transport     transport;
+
+    s_TPS_transport     *bus;
+    FILE                *fp;
+    pthread_mutex_t     lock;
+
+    unsigned long long  last_us;
+} s_TPS_record;
+
+
+typedef struct
+{
+    unsigned long long  ts_us;          //since the start of the capture
+    unsigned int        dur_us;
+    int                 result;
+    unsigned char       nmsgs;
+    unsigned char       addr;
+    unsigned char       writes;         //changes the controller's state, see IsWrite()
+    const unsigned char *msgs;          //first message header in the file
+} s_TPS_replay_rec;
+
+
+typedef struct
+{
+    s_TPS_transport     transport;
+
+    unsigned char       *file;
+    s_TPS_replay_rec    *recs;
+    unsigned int        num_recs;
+
+    double              time_scale;
+    pthread_mutex_t     lock;
+
+    //per i2c address: next record, and when its last write ended recorded / now
+    unsigned int        cursor[REPLAY_NUM_ADDRS];
+    unsigned char       polled[REPLAY_NUM_ADDRS];       //the cursor record answered a poll
+    unsigned char       started[REPLAY_NUM_ADDRS];
+    unsigned long long  anchor_rec_us[REPLAY_NUM_ADDRS];
+    unsigned long long  anchor_now_us[REPLAY_NUM_ADDRS];
+
+    s_TPS_replay_stats  stats;
+} s_TPS_replay;
+
+
+/*
+* register writes are [reg, len, ...]; a read starts with a 1 byte [reg]
+*/
+static int IsWrite(const struct i2c_msg *msgs, int nmsgs)
+{
+    int i;
+
+    for(i = 0; i < nmsgs; i++)
+    {
+        if(!(msgs[i].flags & I2C_M_RD) && msgs[i].len >= 2)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+
+static int record_transfer(void *priv, struct i2c_msg *msgs, int nmsgs)
+{
+    s_TPS_record *p_rec = priv;
+    s_TPS_replay_rec_hdr rec_hdr;
+    s_TPS_replay_msg_hdr msg_hdr;
+    unsigned long long start;
+    int ret;
+    int i;
+
+    start = tps65987_now_us();
+    ret = tps65987_transfer(p_rec->bus, msgs, nmsgs);
+
+    memset(&rec_hdr, 0, sizeof(rec_hdr));
+    rec_hdr.dur_us = tps65987_now_us() - start;
+    rec_hdr.result = ret < 0 ? -1 : 0;
+    rec_hdr.nmsgs = nmsgs;
+
+    pthread_mutex_lock(&p_rec->lock);
+
+    rec_hdr.delta_us = start - p_rec->last_us;
+    p_rec->last_us = start;
+
+    fwrite(&rec_hdr, sizeof(rec_hdr), 1, p_rec->fp);
+
+    for(i = 0; i < nmsgs; i++)
+    {
+        msg_hdr.addr = msgs[i].addr;
+        msg_hdr.flags = msgs[i].flags;
+        msg_hdr.len = msgs[i].len;
+
+        fwrite(&msg_hdr, sizeof(msg_hdr), 1, p_rec->fp);
+
+        if(!(msgs[i].flags & I2C_M_RD) || ret >= 0)
+        {
+            fwrite(msgs[i].buf, 1, msgs[i].len, p_rec->fp);
+        }
+    }
+
+    pthread_mutex_unlock(&p_rec->lock);
+
+    return ret;
+}
+
+
+static void record_close(void *priv)
+{
+    s_TPS_record *p_rec = priv;
+
+    fclose(p_rec->fp);
+
+    if(p_rec->bus->close != NULL)
+    {
+        p_rec->bus->close(p_rec->bus->priv);
+    }
+
+    pthread_mutex_destroy(&p_rec->lock);
+    free(p_rec);
+}
+
+
+s_TPS_transport *tps65987_record_transport(s_TPS_transport *p_bus, const char *file_name)
+{
+    s_TPS_replay_file_hdr hdr;
+    s_TPS_record *p_rec;
+
+    if(p_bus == NULL)
+    {
+        return NULL;
+    }
+
+    p_rec = calloc(1, sizeof(*p_rec));
+    if(p_rec == NULL)
+    {
+        return NULL;
+    }
+
+    p_rec->fp = fopen(file_name, "wb");
+    if(p_rec->fp == NULL)
+    {
+        printf("fail to create capture %s\n", file_name);
+        free(p_rec);
+        return NULL;
+    }
+
+    setvbuf(p_rec->fp, NULL, _IOFBF, RECORD_BUF_SIZE);
+
+    p_rec->bus = p_bus;
+    p_rec->last_us = tps65987_now_us();
+    pthread_mutex_init(&p_rec->lock, NULL);
+
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, REPLAY_FILE_MAGIC, 4);
+    hdr.version = REPLAY_FILE_VERSION;
+    hdr.caps = p_bus->caps;
+    hdr.start_ns = p_rec->last_us * 1000ULL;
+    fwrite(&hdr, sizeof(hdr), 1, p_rec->fp);
+
+    p_rec->transport.name = "record";
+    p_rec->transport.caps = p_bus->caps;
+    p_rec->transport.transfer = record_transfer;
+    p_rec->transport.close = record_close;
+    p_rec->transport.priv = p_rec;
+
+    return &p_rec->transport;
+}
+
+
+/*
+* Same messages, and the same data in the ones that write. 'fill' copies the
+* recorded reads into msgs instead of comparing.
+*/
+static int MatchRec(const s_TPS_replay_rec *p_rec, struct i2c_msg *msgs, int nmsgs, int fill)
+{
+    const unsigned char *p = p_rec->msgs;
+    s_TPS_replay_msg_hdr msg_hdr;
+    int i;
+
+    if(p_rec->nmsgs != nmsgs)
+    {
+        return 0;
+    }
+
+    for(i = 0; i < nmsgs; i++)
+    {
+        memcpy(&msg_hdr, p, sizeof(msg_hdr));
+        p += sizeof(msg_hdr);
+
+        if(msg_hdr.addr != msgs[i].addr || msg_hdr.flags != msgs[i].flags || msg_hdr.len != msgs[i].len)
+        {
+            return 0;
+        }
+
+        if(!(msg_hdr.flags & I2C_M_RD))
+        {
+            if(memcmp(p, msgs[i].buf, msg_hdr.len) != 0)
+            {
+                return 0;
+            }
+        }
+        else if(p_rec->result < 0)
+        {
+            continue;   //no data
+        }
+        else if(fill)
+        {
+            memcpy(msgs[i].buf, p, msg_hdr.len);
+        }
+
+        p += msg_hdr.len;
+    }
+
+    return 1;
+}
+
+
+/*
+* recorded transfers of this address in [from, to)
+*/
+static unsigned int CountAddr(const s_TPS_replay *p_replay, unsigned char addr, unsigned int from, unsigned int to)
+{
+    unsigned int n = 0;
+
+    for(; from < to; from++)
+    {
+        n += p_replay->recs[from].addr == addr;
+    }
+
+    return n;
+}
+
+
+static int FindWrite(s_TPS_replay *p_replay, unsigned char addr, struct i2c_msg *msgs, int nmsgs)
+{
+    unsigned int k;
+
+    for(k = p_replay->cursor[addr]; k < p_replay->num_recs && k < p_replay->cursor[addr] + REPLAY_WINDOW; k++)
+    {
+        if(p_replay->recs[k].addr == addr && MatchRec(&p_replay->recs[k], msgs, nmsgs, 0))
+        {
+            return k;
+        }
+    }
+
+    return -1;
+}
+
+
+/*
+* the last recorded answer before the next write that was already there
+* 'elapsed_us' after the last write, or the first one if the driver polls
+* sooner than it did when recorded
+*/
+static int FindPoll(s_TPS_replay *p_replay, unsigned char addr, struct i2c_msg *msgs, int nmsgs, unsigned long long elapsed_us)
+{
+    const s_TPS_replay_rec *p_rec;
+    unsigned int k;
+    int best = -1;
+
+    for(k = p_replay->cursor[addr]; k < p_replay->num_recs && k < p_replay->cursor[addr] + REPLAY_WINDOW; k++)
+    {
+        p_rec = &p_replay->recs[k];
+
+        if(p_rec->addr != addr)
+        {
+            continue;
+        }
+
+        if(p_rec->writes)
+        {
+            break;
+        }
+
+        if(!MatchRec(p_rec, msgs, nmsgs, 0))
+        {
+            continue;
+        }
+
+        if(best >= 0 && (p_rec->ts_us - p_replay->anchor_rec_us[addr]) * p_replay->time_scale > elapsed_us)
+        {
+            break;
+        }
+
+        best = k;
+    }
+
+    return best;
+}
+
+
+static int FindStale(s_TPS_replay *p_replay, unsigned char addr, struct i2c_msg *msgs, int nmsgs)
+{
+    int k;
+    int stop = (int)p_replay->cursor[addr] - REPLAY_WINDOW;
+
+    for(k = (int)p_replay->cursor[addr] - 1; k >= 0 && k >= stop; k--)
+    {
+        if(p_replay->recs[k].addr == addr && MatchRec(&p_replay->recs[k], msgs, nmsgs, 0))
+        {
+            return k;
+        }
+    }
+
+    return -1;
+}
+
+
+static int replay_transfer(void *priv, struct i2c_msg *msgs, int nmsgs)
+{
+    s_TPS_replay *p_replay = priv;
+    const s_TPS_replay_rec *p_rec;
+    unsigned char addr = msgs[0].addr & (REPLAY_NUM_ADDRS - 1);
+    unsigned long long now = tps65987_now_us();
+    int writes = IsWrite(msgs, nmsgs);
+    int k;
+    int i;
+
+    pthread_mutex_lock(&p_replay->lock);
+
+    p_replay->stats.transfers++;
+
+    if(!p_replay->started[addr])
+    {
+        p_replay->started[addr] = 1;
+        p_replay->anchor_now_us[addr] = now;
+        p_replay->anchor_rec_us[addr] = p_replay->cursor[addr] < p_replay->num_recs ?
+                                        p_replay->recs[p_replay->cursor[addr]].ts_us : 0;
+    }
+
+    if(writes)
+    {
+        k = FindWrite(p_replay, addr, msgs, nmsgs);
+    }
+    else
+    {
+        k = FindPoll(p_replay, addr, msgs, nmsgs, now - p_replay->anchor_now_us[addr]);
+    }
+
+    if(k >= 0)
+    {
+        p_replay->stats.matched++;
+        p_replay->stats.skipped += CountAddr(p_replay, addr, p_replay->cursor[addr] + p_replay->polled[addr], k);
+
+        //a poll may be answered by the same record again
+        p_replay->cursor[addr] = writes ? k + 1 : k;
+        p_replay->polled[addr] = !writes;
+    }
+    else if(!writes && (k = FindStale(p_replay, addr, msgs, nmsgs)) >= 0)
+    {
+        p_replay->stats.stale++;
+    }
+    else
+    {
+        p_replay->stats.diverged++;
+        pthread_mutex_unlock(&p_replay->lock);
+
+        //not on the recorded bus, the driver sees a NACK
+        for(i = 0; i < nmsgs; i++)
+        {
+            if(msgs[i].flags & I2C_M_RD)
+            {
+                memset(msgs[i].buf, 0, msgs[i].len);
+            }
+        }
+        return -EIO;
+    }
+
+    p_rec = &p_replay->recs[k];
+    MatchRec(p_rec, msgs, nmsgs, 1);
+
+    tps65987_sleep_us(p_rec->dur_us * p_replay->time_scale);
+
+    if(writes)
+    {
+        p_replay->anchor_rec_us[addr] = p_rec->ts_us + p_rec->dur_us;
+        p_replay->anchor_now_us[addr] = tps65987_now_us();
+    }
+
+    pthread_mutex_unlock(&p_replay->lock);
+
+    return p_rec->result < 0 ? -EIO : 0;
+}
+
+
+static void replay_close(void *priv)
+{
+    s_TPS_replay *p_replay = priv;
+
+    pthread_mutex_destroy(&p_replay->lock);
+    free(p_replay->recs);
+    free(p_replay->file);
+    free(p_replay);
+}
+
+
+/*
+* index the records of the capture, which stays in memory
+*/
+static int LoadCapture(s_TPS_replay *p_replay, const char *file_name)
+{
+    s_TPS_replay_file_hdr hdr;
+    s_TPS_replay_rec_hdr rec_hdr;
+    s_TPS_replay_msg_hdr msg_hdr;
+    s_TPS_replay_rec *p_rec;
+    unsigned long long ts_us = 0;
+    unsigned int max_recs;
+    long size;
+    long off;
+    int i;
+    FILE *fp;
+
+    fp = fopen(file_name, "rb");
+    if(fp == NULL)
+    {
+        printf("fail to open capture %s\n", file_name);
+        return -1;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    rewind(fp);
+
+    p_replay->file = malloc(size > 0 ? size : 1);
+    if(p_replay->file == NULL || fread(p_replay->file, 1, size, fp) != (size_t)size)
+    {
+        fclose(fp);
+        return -1;
+    }
+
+    fclose(fp);
+
+    memcpy(&hdr, p_replay->file, size >= (long)sizeof(hdr) ? sizeof(hdr) : 0);
+    if(size < (long)sizeof(hdr) || memcmp(hdr.magic, REPLAY_FILE_MAGIC, 4) != 0 || hdr.version != REPLAY_FILE_VERSION)
+    {
+        printf("%s is not a capture\n", file_name);
+        return -1;
+    }
+
+    p_replay->transport.caps = hdr.caps;
+
+    max_recs = (size - sizeof(hdr)) / sizeof(rec_hdr);
+    p_replay->recs = malloc((max_recs ? max_recs : 1) * sizeof(*p_replay->recs));
+    if(p_replay->recs == NULL)
+    {
+        return -1;
+    }
+
+    for(off = sizeof(hdr); off + (long)sizeof(rec_hdr) <= size; )
+    {
+        memcpy(&rec_hdr, &p_replay->file[off], sizeof(rec_hdr));
+        off += sizeof(rec_hdr);
+
+        ts_us += rec_hdr.delta_us;
+
+        p_rec = &p_replay->recs[p_replay->num_recs];
+        p_rec->ts_us = ts_us;
+        p_rec->dur_us = rec_hdr.dur_us;
+        p_rec->result = rec_hdr.result;
+        p_rec->nmsgs = rec_hdr.nmsgs;
+        p_rec->addr = 0;
+        p_rec->writes = 0;
+        p_rec->msgs = &p_replay->file[off];
+
+        for(i = 0; i < rec_hdr.nmsgs; i++)
+        {
+            if(off + (long)sizeof(msg_hdr) > size)
+            {
+                break;
+            }
+
+            memcpy(&msg_hdr, &p_replay->file[off], sizeof(msg_hdr));
+            off += sizeof(msg_hdr);
+
+            p_rec->addr = msg_hdr.addr & (REPLAY_NUM_ADDRS - 1);
+            if(!(msg_hdr.flags & I2C_M_RD) && msg_hdr.len >= 2)
+            {
+                p_rec->writes = 1;
+            }
+
+            if(!(msg_hdr.flags & I2C_M_RD) || rec_hdr.result >= 0)
+            {
+                off += msg_hdr.len;
+            }
+        }
+
+        if(i < rec_hdr.nmsgs || off > size)
+        {
+            printf("capture %s truncated after %u transfers\n", file_name, p_replay->num_recs);
+            break;
+        }
+
+        p_replay->num_recs++;
+    }
+
+    printf("capture %s: %u transfers, %.3fs\n", file_name, p_replay->num_recs, ts_us / 1000000.0);
+
+    return 0;
+}
+
+
+s_TPS_transport *tps65987_replay_transport(const char *file_name, double time_scale)
+{
+    s_TPS_replay *p_replay;
+
+    if(time_scale <= 0)
+    {
+        return NULL;
+    }
+
+    p_replay = calloc(1, sizeof(*p_replay));
+    if(p_replay == NULL)
+    {
+        return NULL;
+    }
+
+    if(LoadCapture(p_replay, file_name) != 0)
+    {
+        free(p_replay->recs);
+        free(p_replay->file);
+        free(p_replay);
+        return NULL;
+    }
+
+    p_replay->time_scale = time_scale;
+    pthread_mutex_init(&p_replay->lock, NULL);
+
+    p_replay->transport.name = "replay";
+    p_replay->transport.transfer = replay_transfer;
+    p_replay->transport.close = replay_close;
+    p_replay->transport.priv = p_replay;
+
+    return &p_replay->transport;
+}
+
+
+int tps65987_replay_get_stats(s_TPS_transport *p_replay, s_TPS_replay_stats *p_stats)
+{
+    s_TPS_replay *p;
+
+    if(p_replay == NULL || p_replay->transfer != replay_transfer)
+    {
+        return -1;
+    }
+
+    p = p_replay->priv;
+
+    pthread_mutex_lock(&p->lock);
+    *p_stats = p->stats;
+    pthread_mutex_unlock(&p->lock);
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+/**
+*  @file      tps65987_replay.h
+*  @brief     tps65987 bus capture and replay transports
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#ifndef TPS65987_REPLAY_H
+#define TPS65987_REPLAY_H
+
+#include<stdint.h>
+
+#include "tps65987_transport.h"
+
+/*
+* The record transport passes every transfer on to the real bus and appends
+* it to a capture file: when it started, how long it took, its result and
+* its messages with their data (what was written, what was read).
+*
+* The replay transport answers from such a file instead of a bus, so an
+* upgrade captured on a board can be run again on a workstation with a
+* changed driver:
+* - a transfer that writes is matched with the next recorded transfer with
+*   the same messages and data (polls in between that the driver no longer
+*   makes are skipped)
+* - a transfer that only reads (a poll) gets the recorded answer that was
+*   current at the same time after the last matched write, so a 4CC command
+*   still takes as long as it did on the board, however often it's polled
+* - every matched transfer takes its recorded duration, times 'time_scale'
+* Each i2c address is followed on its own.
+*/
+#define  REPLAY_FILE_MAGIC          "TPSR"
+#define  REPLAY_FILE_VERSION        1
+#define  REPLAY_WINDOW              1024    //records searched ahead for a match
+
+/*
+* file layout: header, then per transfer a record header and per message a
+* message header and its data (nothing for a failed read)
+*/
+typedef struct
+{
+    char        magic[4];
+    uint16_t    version;
+    uint16_t    caps;           //of the recorded bus, TRANSPORT_CAP_*
+    uint64_t    start_ns;       //CLOCK_MONOTONIC
+} s_TPS_replay_file_hdr;
+
+typedef struct
+{
+    uint32_t    delta_us;       //since the start of the previous transfer
+    uint32_t    dur_us;
+    int16_t     result;
+    uint8_t     nmsgs;
+    uint8_t     reserved;
+} s_TPS_replay_rec_hdr;
+
+typedef struct
+{
+    uint16_t    addr;
+    uint16_t    flags;
+    uint16_t    len;
+} s_TPS_replay_msg_hdr;
+
+
+typedef struct
+{
+    unsigned long long  transfers;
+    unsigned long long  matched;        //writes found in order, polls answered from ahead
+    unsigned long long  skipped;        //recorded transfers the driver didn't make again
+    unsigned long long  stale;          //polls answered with an earlier recorded value
+    unsigned long long  diverged;       //no recorded counterpart at all
+} s_TPS_replay_stats;
+
+
+s_TPS_transport *tps65987_record_transport(s_TPS_transport *p_bus, const char *file_name);
+
+s_TPS_transport *tps65987_replay_transport(const char *file_name, double time_scale);
+int tps65987_replay_get_stats(s_TPS_transport *p_replay, s_TPS_replay_stats *p_stats);
+
+#endif
@@ -0,0 +1,179 @@
+/**
+*  @file      tps65987_shm.c
+*  @brief     tps65987 status snapshot in shared memory
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#include<stdio.h>
+#include<string.h>
+#include<fcntl.h>
+#include<unistd.h>
+#include<sched.h>
+#include<sys/mman.h>
+
+#include "tps65987_shm.h"
+
+
+static void shm_name(char *name, int len, unsigned char i2c_addr)
+{
+    snprintf(name, len, SHM_NAME_FORMAT, i2c_addr);
+}
+
+
+/*
+* the publishing side, the segment is created if needed and reset
+*/
+s_TPS_shm *tps65987_shm_create(unsigned char i2c_addr)
+{
+    s_TPS_shm *p_shm;
+    char name[32];
+    int fd;
+
+    shm_name(name, sizeof(name), i2c_addr);
+
+    fd = shm_open(name, O_RDWR | O_CREAT, 0644);
+    if(fd < 0)
+    {
+        printf("fail to open shm %s\n", name);
+        return NULL;
+    }
+
+    if(ftruncate(fd, sizeof(s_TPS_shm)) != 0)
+    {
+        printf("fail to size shm %s\n", name);
+        close(fd);
+        return NULL;
+    }
+
+    p_shm = mmap(NULL, sizeof(s_TPS_shm), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if(p_shm == MAP_FAILED)
+    {
+        printf("fail to map shm %s\n", name);
+        return NULL;
+    }
+
+    //readers see an odd seq until the first publish
+    atomic_store_explicit(&p_shm->seq, 1, memory_order_relaxed);
+    memset(&p_shm->snapshot, 0, sizeof(p_shm->snapshot));
+    p_shm->version = SHM_VERSION;
+    p_shm->magic = SHM_MAGIC;
+
+    return p_shm;
+}
+
+
+/*
+* the reading side, mapped read-only
+*/
+s_TPS_shm *tps65987_shm_open(unsigned char i2c_addr)
+{
+    s_TPS_shm *p_shm;
+    char name[32];
+    int fd;
+
+    shm_name(name, sizeof(name), i2c_addr);
+
+    fd = shm_open(name, O_RDONLY, 0);
+    if(fd < 0)
+    {
+        return NULL;
+    }
+
+    p_shm = mmap(NULL, sizeof(s_TPS_shm), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if(p_shm == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    if(p_shm->magic != SHM_MAGIC || p_shm->version != SHM_VERSION)
+    {
+        printf("shm %s: unknown layout\n", name);
+        munmap(p_shm, sizeof(s_TPS_shm));
+        return NULL;
+    }
+
+    return p_shm;
+}
+
+
+void tps65987_shm_close(s_TPS_shm *p_shm)
+{
+    if(p_shm != NULL)
+    {
+        munmap(p_shm, sizeof(s_TPS_shm));
+    }
+}
+
+
+int tps65987_shm_unlink(unsigned char i2c_addr)
+{
+    char name[32];
+
+    shm_name(name, sizeof(name), i2c_addr);
+
+    return shm_unlink(name);
+}
+
+
+/*
+* single writer; p_snapshot->generation is filled in
+*/
+void tps65987_shm_publish(s_TPS_shm *p_shm, s_TPS_shm_snapshot *p_snapshot)
+{
+    unsigned int seq = atomic_load_explicit(&p_shm->seq, memory_order_relaxed);
+
+    p_snapshot->generation = p_shm->snapshot.generation + 1;
+
+    //odd: update in progress
+    atomic_store_explicit(&p_shm->seq, seq | 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    memcpy(&p_shm->snapshot, p_snapshot, sizeof(*p_snapshot));
+
+    atomic_store_explicit(&p_shm->seq, (seq | 1) + 1, memory_order_release);
+}
+
+
+/*
+* 0 with a consistent copy, -1 if nothing was published yet
+*/
+int tps65987_shm_read(const s_TPS_shm *p_shm, s_TPS_shm_snapshot *p_snapshot)
+{
+    unsigned int seq0;
+    unsigned int seq1;
+    int spins = 0;
+
+    for(;;)
+    {
+        seq0 = atomic_load_explicit(&p_shm->seq, memory_order_acquire);
+
+        if(!(seq0 & 1))
+        {
+            memcpy(p_snapshot, &p_shm->snapshot, sizeof(*p_snapshot));
+
+            atomic_thread_fence(memory_order_acquire);
+            seq1 = atomic_load_explicit(&p_shm->seq, memory_order_relaxed);
+
+            if(seq0 == seq1)
+            {
+                return 0;
+            }
+        }
+        else if(p_shm->snapshot.generation == 0 && seq0 == 1)
+        {
+            return -1;
+        }
+
+        //the writer was preempted mid-update
+        if(++spins % 64 == 0)
+        {
+            sched_yield();
+        }
+    }
+}
@@ -0,0 +1,69 @@
+/**
+*  @file      tps65987_shm.h
+*  @brief     tps65987 status snapshot in shared memory
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#ifndef TPS65987_SHM_H
+#define TPS65987_SHM_H
+
+#include<stdatomic.h>
+
+#include "tps65987_drv.h"
+#include "tps65987_regmap.h"
+
+#define  SHM_NAME_FORMAT        "/tps65987-%02x"    //per i2c address
+#define  SHM_MAGIC              0x48535054          //"TPSH"
+#define  SHM_VERSION            2
+
+#define  SHM_MAX_PDOS           7
+
+
+/*
+* port state as the monitor last read it: the registers' raw bytes, decode
+* them with the tps65987_regmap.h accessors (the layout doesn't depend on
+* the compiler's bitfield order)
+*/
+typedef struct
+{
+    unsigned long long  generation;         //bumped by every publish
+    unsigned long long  timestamp_us;       //CLOCK_MONOTONIC, when the registers were read
+
+    unsigned char       i2c_addr;
+
+    unsigned char       status[TPS_REG_STATUS_LEN];                 //0x1A
+    unsigned char       power_status[TPS_REG_POWER_STATUS_LEN];     //0x3F
+    unsigned char       portconfig[TPS_REG_PORT_CONFIGURATION_LEN]; //0x28
+    unsigned char       bootflags[TPS_REG_BOOT_FLAGS_LEN];          //0x2D
+
+    unsigned char       num_source_pdos;    //0x30, RX source caps
+    unsigned int        source_pdos[SHM_MAX_PDOS];
+} s_TPS_shm_snapshot;
+
+
+/*
+* One writer, any number of readers in any process. The writer makes seq odd,
+* updates the snapshot and makes it even again; a reader retries until it
+* saw the same even seq before and after copying.
+*/
+typedef struct
+{
+    unsigned int        magic;
+    unsigned int        version;
+
+    atomic_uint         seq;
+    s_TPS_shm_snapshot  snapshot;
+} s_TPS_shm;
+
+
+s_TPS_shm *tps65987_shm_create(unsigned char i2c_addr);
+s_TPS_shm *tps65987_shm_open(unsigned char i2c_addr);
+void tps65987_shm_close(s_TPS_shm *p_shm);
+int tps65987_shm_unlink(unsigned char i2c_addr);
+
+void tps65987_shm_publish(s_TPS_shm *p_shm, s_TPS_shm_snapshot *p_snapshot);
+int tps65987_shm_read(const s_TPS_shm *p_shm, s_TPS_shm_snapshot *p_snapshot);
+
+#endif
@@ -0,0 +1,869 @@
+/**
+*  @file      tps65987_sim.c
+*  @brief     simulated tps65987 behind the i2c transport
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+/*
+* Software model of one TPS65987 on the bus: the register file (lengths as
+* in the .pjt), a 4CC engine for the flash, patch and reset commands with
+* configurable execution times, and a SPI flash holding two regions. The
+* boot flags are worked out from the flash content on every GAID, so a full
+* upgrade can run and be timed without a board.
+*/
+
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include<errno.h>
+#include<pthread.h>
+
+#include "tps65987_drv.h"
+#include "tps65987_latency.h"
+#include "tps65987_sim.h"
+
+#define  CMD1_REG           0x08
+#define  DATA1_REG          0x09
+#define  INT_EVENT1_REG     0x14
+#define  INT_EVENT2_REG     0x15
+#define  INT_CLEAR1_REG     0x18
+#define  INT_CLEAR2_REG     0x19
+
+struct s_TPS_sim
+{
+    s_TPS_sim_config    cfg;
+
+    pthread_mutex_t     lock;
+
+    unsigned char       regs[SIM_NUM_REGS][SIM_REG_SIZE];
+    unsigned char       cur_reg;
+
+    unsigned char       *flash;
+    unsigned int        flash_wr_addr;
+
+    //4CC in progress
+    unsigned char       cmd[4];
+    unsigned char       cmd_pending;
+    unsigned char       cmd_in_len;
+    unsigned long long  cmd_done_us;
+
+    unsigned long long  reset_done_us;
+
+    unsigned char       port_disable_pending;
+    unsigned long long  port_disable_done_us;
+
+    unsigned long long  created_us;
+    unsigned int        plug_toggles;
+
+    unsigned int        flwd_count;
+    unsigned char       powered_off;        //see power_cut_after_flwd
+
+    unsigned int        flwd_attempts;      //see flwd_error_every
+    unsigned int        flwd_errors_left;
+
+    //patch download (PTCx) in PTCH mode
+    unsigned char       *patch;
+    unsigned int        patch_len;
+    unsigned char       patch_started;
+
+    s_TPS_transport     transport;
+};
+
+
+/*
+* register byte length, from TPS65987-DDH-*.pjt
+*/
+static const unsigned char sim_reg_len[SIM_NUM_REGS] =
+{
+    [0x00] = 4,  [0x01] = 4,  [0x03] = 4,  [0x05] = 16, [0x06] = 8,
+    [0x08] = 4,  [0x09] = 64, [0x0F] = 4,  [0x10] = 4,  [0x11] = 64,
+    [0x12] = 64, [0x13] = 64, [0x14] = 11, [0x15] = 11, [0x16] = 11,
+    [0x17] = 11, [0x18] = 11, [0x19] = 11, [0x1A] = 6,  [0x1F] = 4,
+    [0x20] = 1,  [0x22] = 8,  [0x26] = 6,  [0x27] = 14, [0x28] = 7,
+    [0x29] = 4,  [0x2B] = 2,  [0x2D] = 12, [0x2E] = 49, [0x2F] = 47,
+    [0x30] = 29, [0x31] = 57, [0x32] = 64, [0x33] = 57, [0x34] = 4,
+    [0x35] = 4,  [0x36] = 4,  [0x37] = 12, [0x38] = 12, [0x3F] = 2,
+    [0x40] = 4,  [0x41] = 4,  [0x42] = 4,  [0x43] = 9,  [0x47] = 49,
+    [0x48] = 25, [0x49] = 25, [0x4A] = 64, [0x4B] = 4,  [0x4E] = 29,
+    [0x4F] = 29, [0x50] = 6,  [0x51] = 7,  [0x52] = 8,  [0x54] = 8,
+    [0x55] = 1,  [0x57] = 2,  [0x58] = 33, [0x59] = 11, [0x5B] = 1,
+    [0x5C] = 64, [0x5D] = 4,  [0x5E] = 64, [0x5F] = 5,  [0x60] = 29,
+    [0x61] = 29, [0x62] = 10, [0x63] = 1,  [0x64] = 20, [0x69] = 4,
+    [0x6A] = 10, [0x6B] = 12, [0x6C] = 60, [0x70] = 1,  [0x71] = 26,
+    [0x72] = 8,  [0x73] = 26, [0x74] = 4,  [0x75] = 4,  [0x76] = 24,
+    [0x77] = 24, [0x78] = 5,  [0x79] = 5,  [0x7A] = 32, [0x7B] = 32,
+    [0x7C] = 9,  [0x7D] = 63, [0x7E] = 26, [0x7F] = 26,
+};
+
+
+void tps65987_sim_default_config(s_TPS_sim_config *p_cfg)
+{
+    memset(p_cfg, 0, sizeof(*p_cfg));
+
+    p_cfg->i2c_addr = 0x38;
+
+    p_cfg->flash_size = SIM_FLASH_SIZE;
+    p_cfg->region_addr[0] = SIM_REGION0_ADDR;
+    p_cfg->region_addr[1] = SIM_REGION1_ADDR;
+
+    p_cfg->customer_use = 0x02;
+    p_cfg->version = 0x00050201;
+
+    p_cfg->flrr_us = 200;
+    p_cfg->flem_us = 30000;
+    p_cfg->flad_us = 100;
+    p_cfg->flwd_us = 400;
+    p_cfg->flrd_us = 150;
+    p_cfg->flvy_us = 15000;
+    p_cfg->ptc_us = 300;
+
+    p_cfg->reset_us = 250000;
+    p_cfg->port_disable_us = 50000;
+
+    p_cfg->bus_hz = 400000;
+}
+
+
+static void sim_set_u32(unsigned char *buf, unsigned int val)
+{
+    buf[0] = val & 0xff;
+    buf[1] = (val >> 8) & 0xff;
+    buf[2] = (val >> 16) & 0xff;
+    buf[3] = (val >> 24) & 0xff;
+}
+
+
+static unsigned int sim_get_u32(const unsigned char *buf)
+{
+    return buf[0] | (buf[1] << 8) | (buf[2] << 16) | ((unsigned int)buf[3] << 24);
+}
+
+
+static void sim_set_event(s_TPS_sim *p_sim, int bit)
+{
+    p_sim->regs[INT_EVENT1_REG][bit / 8] |= 1 << (bit % 8);
+    p_sim->regs[INT_EVENT2_REG][bit / 8] |= 1 << (bit % 8);
+}
+
+
+/*
+* A region holds a valid patch bundle if its header has the magic and the
+* data it points to fits in the flash. Full-flash images (full-region-*.bin)
+* start with a pointer to the bundle instead, relative to the region.
+*/
+static int sim_region_valid(s_TPS_sim *p_sim, unsigned int addr)
+{
+    unsigned int data_off;
+    unsigned int data_len;
+    unsigned int bundle_off;
+
+    if(addr + 16 > p_sim->cfg.flash_size)
+    {
+        return 0;
+    }
+
+    if(sim_get_u32(&p_sim->flash[addr]) != PATCH_BUNDLE_MAGIC)
+    {
+        bundle_off = sim_get_u32(&p_sim->flash[addr]);
+
+        if(bundle_off == 0 || bundle_off > p_sim->cfg.flash_size - addr - 16)
+        {
+            return 0;
+        }
+
+        addr += bundle_off;
+
+        if(sim_get_u32(&p_sim->flash[addr]) != PATCH_BUNDLE_MAGIC)
+        {
+            return 0;
+        }
+    }
+
+    data_off = sim_get_u32(&p_sim->flash[addr + 8]);
+    data_len = sim_get_u32(&p_sim->flash[addr + 12]);
+
+    if(data_off > p_sim->cfg.flash_size - addr || data_len > p_sim->cfg.flash_size - addr - data_off)
+    {
+        return 0;
+    }
+
+    return 1;
+}
+
+
+static void sim_set_mode(s_TPS_sim *p_sim, const char *mode)
+{
+    memcpy(p_sim->regs[REG_MODE], mode, 4);
+}
+
+
+/*
+* Power-on / GAID: registers back to defaults and boot from the first valid region
+*/
+static void sim_boot(s_TPS_sim *p_sim)
+{
+    unsigned char *bootflags;
+    int region;
+
+    memset(p_sim->regs, 0, sizeof(p_sim->regs));
+
+    sim_set_u32(p_sim->regs[0x00], 0x0451);
+    memcpy(p_sim->regs[0x01], "ACEL", 4);
+    sim_set_u32(p_sim->regs[0x05], 0x65987000 | p_sim->cfg.i2c_addr);
+    p_sim->regs[0x06][0] = p_sim->cfg.customer_use;
+    sim_set_u32(p_sim->regs[REG_Version], p_sim->cfg.version);
+
+    //attached as a sink with a PD contract, 5V 3A source
+    p_sim->regs[REG_Status][0] = 0x01 | (6 << 1);
+    p_sim->regs[REG_PORTCONFIG][0] = 0xCA;
+    p_sim->regs[REG_PORTCONFIG][1] = 0x58;
+    p_sim->regs[REG_PORTCONFIG][2] = 0xB6;
+    p_sim->regs[REG_PORTCONFIG][3] = 0x3F;
+    p_sim->regs[REG_RX_Source_Capabilities][0] = 1;
+    sim_set_u32(&p_sim->regs[REG_RX_Source_Capabilities][1], (100 << 10) | 300);
+    p_sim->regs[REG_Power_Status][0] = 0x0F;
+
+    bootflags = p_sim->regs[REG_BootFlags];
+    bootflags[0] |= 1 << 3;    //SpiFlashPresent
+
+    for(region = 0; region < 2; region++)
+    {
+        bootflags[0] |= 1 << (4 + region);     //Region0/1 attempted
+
+        if(sim_region_valid(p_sim, p_sim->cfg.region_addr[region]))
+        {
+            sim_set_mode(p_sim, "APP ");
+            return;
+        }
+
+        bootflags[0] |= 1 << (6 + region);     //Region0/1 invalid
+    }
+
+    //nothing to boot, wait for a patch from the host
+    bootflags[0] |= 1 << 0;    //PatchHeaderErr
+    sim_set_mode(p_sim, "PTCH");
+}
+
+
+static unsigned int sim_cmd_latency(s_TPS_sim *p_sim, const unsigned char *cmd, const unsigned char *data)
+{
+    if(memcmp(cmd, "FLrr", 4) == 0) return p_sim->cfg.flrr_us;
+    if(memcmp(cmd, "FLem", 4) == 0) return p_sim->cfg.flem_us * (data[4] ? data[4] : 1);
+    if(memcmp(cmd, "FLad", 4) == 0) return p_sim->cfg.flad_us;
+    if(memcmp(cmd, "FLwd", 4) == 0) return p_sim->cfg.flwd_us;
+    if(memcmp(cmd, "FLrd", 4) == 0) return p_sim->cfg.flrd_us;
+    if(memcmp(cmd, "FLvy", 4) == 0) return p_sim->cfg.flvy_us;
+    if(memcmp(cmd, "PTC", 3) == 0)  return p_sim->cfg.ptc_us;
+
+    return 0;
+}
+
+
+static int sim_cmd_known(s_TPS_sim *p_sim, const unsigned char *cmd)
+{
+    static const char *flash_cmds[] = { "FLrr", "FLem", "FLad", "FLwd", "FLrd", "FLvy", "SSrC", "GAID", "Gaid" };
+    static const char *patch_cmds[] = { "PTCs", "PTCd", "PTCc", "PTCq", "PTCr", "GAID", "Gaid" };
+    int i;
+
+    if(memcmp(p_sim->regs[REG_MODE], "PTCH", 4) == 0)
+    {
+        for(i = 0; i < sizeof(patch_cmds) / sizeof(patch_cmds[0]); i++)
+        {
+            if(memcmp(cmd, patch_cmds[i], 4) == 0)
+            {
+                return 1;
+            }
+        }
+
+        return 0;
+    }
+
+    for(i = 0; i < sizeof(flash_cmds) / sizeof(flash_cmds[0]); i++)
+    {
+        if(memcmp(cmd, flash_cmds[i], 4) == 0)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+
+/*
+* Run the 4CC command once its execution time is over.
+* DATA1 holds the input on entry and the output on return,
+* returns 0 for success or -1 to report "CMD " in CMD1
+*/
+static int sim_exec_cmd(s_TPS_sim *p_sim)
+{
+    unsigned char *data = p_sim->regs[DATA1_REG];
+    unsigned char *cmd = p_sim->cmd;
+    unsigned int addr;
+    unsigned int len;
+    unsigned int i;
+
+    if(memcmp(cmd, "FLrr", 4) == 0)
+    {
+        sim_set_u32(data, p_sim->cfg.region_addr[data[0] & 0x01]);
+        return 0;
+    }
+
+    if(memcmp(cmd, "FLem", 4) == 0)
+    {
+        addr = sim_get_u32(data);
+        len = data[4] * FLASH_SECTOR_SIZE;
+
+        if((addr % FLASH_SECTOR_SIZE) != 0 || addr > p_sim->cfg.flash_size || len > p_sim->cfg.flash_size - addr)
+        {
+            data[0] = 1;
+            return 0;
+        }
+
+        memset(&p_sim->flash[addr], FLASH_ERASED_VALUE, len);
+        data[0] = 0;
+        return 0;
+    }
+
+    if(memcmp(cmd, "FLad", 4) == 0)
+    {
+        addr = sim_get_u32(data);
+
+        if(addr >= p_sim->cfg.flash_size)
+        {
+            data[0] = 1;
+            return 0;
+        }
+
+        p_sim->flash_wr_addr = addr;
+        data[0] = 0;
+        return 0;
+    }
+
+    if(memcmp(cmd, "FLwd", 4) == 0)
+    {
+        len = p_sim->cmd_in_len;
+
+        if(p_sim->flash_wr_addr + len > p_sim->cfg.flash_size)
+        {
+            data[0] = 1;
+            return 0;
+        }
+
+        if(p_sim->cfg.flwd_error_every != 0 &&
+           (p_sim->flwd_errors_left != 0 || ++p_sim->flwd_attempts % p_sim->cfg.flwd_error_every == 0))
+        {
+            if(p_sim->flwd_errors_left == 0)
+            {
+                p_sim->flwd_errors_left = p_sim->cfg.flwd_error_burst ? p_sim->cfg.flwd_error_burst : 1;
+            }
+            p_sim->flwd_errors_left--;
+
+            //programming stopped half way
+            for(i = 0; i < len / 2; i++)
+            {
+                p_sim->flash[p_sim->flash_wr_addr + i] &= data[i];
+            }
+
+            p_sim->flash_wr_addr += len / 2;
+            data[0] = 1;
+            return 0;
+        }
+
+        //NOR flash, programming only clears bits
+        for(i = 0; i < len; i++)
+        {
+            p_sim->flash[p_sim->flash_wr_addr + i] &= data[i];
+        }
+
+        p_sim->flash_wr_addr += len;
+        data[0] = 0;
+
+        if(p_sim->cfg.power_cut_after_flwd != 0 && ++p_sim->flwd_count == p_sim->cfg.power_cut_after_flwd)
+        {
+            p_sim->powered_off = 1;
+        }
+        return 0;
+    }
+
+    if(memcmp(cmd, "FLrd", 4) == 0)
+    {
+        addr = sim_get_u32(data);
+
+        if(addr + FLASH_READ_CHUNK_SIZE > p_sim->cfg.flash_size)
+        {
+            return -1;
+        }
+
+        memcpy(data, &p_sim->flash[addr], FLASH_READ_CHUNK_SIZE);
+        return 0;
+    }
+
+    if(memcmp(cmd, "FLvy", 4) == 0)
+    {
+        addr = sim_get_u32(data);
+        data[0] = sim_region_valid(p_sim, addr) ? 0 : 1;
+        return 0;
+    }
+
+    if(memcmp(cmd, "PTCs", 4) == 0)
+    {
+        p_sim->patch_len = 0;
+        p_sim->patch_started = 1;
+        data[0] = 0;
+        return 0;
+    }
+
+    if(memcmp(cmd, "PTCd", 4) == 0)
+    {
+        len = p_sim->cmd_in_len;
+
+        if(!p_sim->patch_started || p_sim->patch_len + len > p_sim->cfg.flash_size)
+        {
+            data[0] = 1;
+            return 0;
+        }
+
+        memcpy(&p_sim->patch[p_sim->patch_len], data, len);
+        p_sim->patch_len += len;
+        data[0] = 0;
+        return 0;
+    }
+
+    if(memcmp(cmd, "PTCc", 4) == 0)
+    {
+        if(!p_sim->patch_started || p_sim->patch_len < 16 || sim_get_u32(p_sim->patch) != PATCH_BUNDLE_MAGIC)
+        {
+            p_sim->regs[REG_BootFlags][1] |= 1 << 2;   //PatchDownloadErr
+            data[0] = 1;
+            return 0;
+        }
+
+        p_sim->patch_started = 0;
+        p_sim->regs[REG_BootFlags][0] &= ~(1 << 0);    //PatchHeaderErr
+        sim_set_mode(p_sim, "APP ");
+        data[0] = 0;
+        return 0;
+    }
+
+    if(memcmp(cmd, "PTCq", 4) == 0)
+    {
+        data[0] = 0;
+        data[1] = p_sim->patch_started;
+        sim_set_u32(&data[2], p_sim->patch_len);
+        return 0;
+    }
+
+    if(memcmp(cmd, "PTCr", 4) == 0)
+    {
+        p_sim->patch_len = 0;
+        p_sim->patch_started = 0;
+        data[0] = 0;
+        return 0;
+    }
+
+    //source capabilities sent, nothing to model
+    if(memcmp(cmd, "SSrC", 4) == 0)
+    {
+        data[0] = 0;
+        return 0;
+    }
+
+    return -1;
+}
+
+
+/*
+* cable attach (as a sink, new contract with the source) or detach
+*/
+static void sim_plug(s_TPS_sim *p_sim, int attached)
+{
+    if(attached)
+    {
+        p_sim->regs[REG_Status][0] = 0x01 | (6 << 1);
+        p_sim->regs[REG_Power_Status][0] = 0x0F;
+        sim_set_event(p_sim, INT_NEW_CONTRACT_AS_CONS);
+        sim_set_event(p_sim, INT_SOURCE_CAP_MSG_RCVD);
+    }
+    else
+    {
+        p_sim->regs[REG_Status][0] = 0;
+        p_sim->regs[REG_Power_Status][0] = 0;
+    }
+
+    sim_set_event(p_sim, INT_PLUG_EVENT);
+    sim_set_event(p_sim, INT_POWER_STATUS_UPDATE);
+    sim_set_event(p_sim, INT_STATUS_UPDATE);
+}
+
+
+/*
+* Complete whatever finished by now
+*/
+static void sim_advance(s_TPS_sim *p_sim, unsigned long long now)
+{
+    if(p_sim->cmd_pending && now >= p_sim->cmd_done_us)
+    {
+        p_sim->cmd_pending = 0;
+
+        if(sim_exec_cmd(p_sim) == 0)
+        {
+            memset(p_sim->regs[CMD1_REG], 0, 4);
+        }
+        else
+        {
+            memcpy(p_sim->regs[CMD1_REG], "CMD ", 4);
+        }
+    }
+
+    if(p_sim->port_disable_pending && now >= p_sim->port_disable_done_us)
+    {
+        p_sim->port_disable_pending = 0;
+
+        p_sim->regs[REG_Status][0] = 0;
+        p_sim->regs[REG_Power_Status][0] = 0;
+        sim_set_event(p_sim, INT_STATUS_UPDATE);
+    }
+
+    if(p_sim->cfg.plug_toggle_us != 0)
+    {
+        while(p_sim->plug_toggles < (now - p_sim->created_us) / p_sim->cfg.plug_toggle_us)
+        {
+            p_sim->plug_toggles++;
+            sim_plug(p_sim, !(p_sim->regs[REG_Status][0] & 0x01));
+        }
+    }
+}
+
+
+static void sim_write_reg(s_TPS_sim *p_sim, unsigned char reg, const unsigned char *data, unsigned int len, unsigned long long now)
+{
+    int i;
+
+    if(len > SIM_REG_SIZE)
+    {
+        len = SIM_REG_SIZE;
+    }
+
+    switch(reg)
+    {
+        case CMD1_REG:
+            if(len < 4)
+            {
+                break;
+            }
+
+            memcpy(p_sim->cmd, data, 4);
+
+            if(!sim_cmd_known(p_sim, p_sim->cmd))
+            {
+                memcpy(p_sim->regs[CMD1_REG], "!CMD", 4);
+                break;
+            }
+
+            if(memcmp(p_sim->cmd, "GAID", 4) == 0 || memcmp(p_sim->cmd, "Gaid", 4) == 0)
+            {
+                //nothing answers until the reset is over
+                p_sim->cmd_pending = 0;
+                p_sim->port_disable_pending = 0;
+                p_sim->patch_started = 0;
+                sim_boot(p_sim);
+                p_sim->reset_done_us = now + p_sim->cfg.reset_us;
+                break;
+            }
+
+            memcpy(p_sim->regs[CMD1_REG], p_sim->cmd, 4);
+            p_sim->cmd_pending = 1;
+            p_sim->cmd_done_us = now + sim_cmd_latency(p_sim, p_sim->cmd, p_sim->regs[DATA1_REG]);
+            break;
+
+        case DATA1_REG:
+            memcpy(p_sim->regs[DATA1_REG], data, len);
+            p_sim->cmd_in_len = len;
+            break;
+
+        case INT_CLEAR1_REG:
+        case INT_CLEAR2_REG:
+            for(i = 0; i < len && i < INT_EVENT_LEN; i++)
+            {
+                p_sim->regs[reg - INT_CLEAR1_REG + INT_EVENT1_REG][i] &= ~data[i];
+            }
+            break;
+
+        case REG_PORTCONFIG:
+            memcpy(p_sim->regs[reg], data, len);
+
+            if((data[0] & 0x03) == DISABLE_PORT)
+            {
+                p_sim->port_disable_pending = 1;
+                p_sim->port_disable_done_us = now + p_sim->cfg.port_disable_us;
+            }
+            break;
+
+        default:
+            memcpy(p_sim->regs[reg], data, len);
+            break;
+    }
+}
+
+
+/*
+* time the transfer would take on a real bus: 9 clocks per byte incl. the
+* address byte of every message that starts with a (repeated) start
+*/
+static void sim_bus_time(s_TPS_sim *p_sim, struct i2c_msg *msgs, int nmsgs)
+{
+    unsigned long long bits = 0;
+    int i;
+
+    if(p_sim->cfg.bus_hz == 0)
+    {
+        return;
+    }
+
+    for(i = 0; i < nmsgs; i++)
+    {
+        bits += (msgs[i].len + ((msgs[i].flags & I2C_M_NOSTART) ? 0 : 1)) * 9;
+    }
+
+    tps65987_sleep_us(bits * 1000000ULL / p_sim->cfg.bus_hz);
+}
+
+
+/*
+* byte 'pos' of the read stream of a register: the byte count, then the data
+*/
+static unsigned char sim_read_byte(s_TPS_sim *p_sim, unsigned char reg, unsigned int pos)
+{
+    if(pos == 0)
+    {
+        return sim_reg_len[reg];
+    }
+
+    if(pos > SIM_REG_SIZE)
+    {
+        return 0;
+    }
+
+    return p_sim->regs[reg][pos - 1];
+}
+
+
+static int sim_transfer(void *priv, struct i2c_msg *msgs, int nmsgs)
+{
+    s_TPS_sim *p_sim = priv;
+    unsigned char wbuf[2 + 255];
+    unsigned long long now;
+    unsigned int wlen;
+    unsigned int count;
+    unsigned int j;
+    int i;
+
+    pthread_mutex_lock(&p_sim->lock);
+
+    sim_bus_time(p_sim, msgs, nmsgs);
+
+    now = tps65987_now_us();
+
+    for(i = 0; i < nmsgs; i++)
+    {
+        //address NACK while resetting or for somebody else
+        if(msgs[i].addr != p_sim->cfg.i2c_addr || now < p_sim->reset_done_us || p_sim->powered_off)
+        {
+            pthread_mutex_unlock(&p_sim->lock);
+            errno = ENXIO;
+            return -1;
+        }
+
+        //the master NACKs the last byte of a read message, the controller doesn't go on after it
+        if((msgs[i].flags & (I2C_M_RD | I2C_M_NOSTART)) == (I2C_M_RD | I2C_M_NOSTART))
+        {
+            pthread_mutex_unlock(&p_sim->lock);
+            errno = EIO;
+            return -1;
+        }
+    }
+
+    sim_advance(p_sim, now);
+
+    for(i = 0; i < nmsgs; i++)
+    {
+        if(msgs[i].flags & I2C_M_RD)
+        {
+            for(j = 0; j < msgs[i].len; j++)
+            {
+                msgs[i].buf[j] = sim_read_byte(p_sim, p_sim->cur_reg, j);
+            }
+            continue;
+        }
+
+        //gather the I2C_M_NOSTART writes that continue this one
+        wlen = 0;
+        do
+        {
+            for(j = 0; j < msgs[i].len && wlen < sizeof(wbuf); j++)
+            {
+                wbuf[wlen++] = msgs[i].buf[j];
+            }
+            i++;
+        } while(i < nmsgs && (msgs[i].flags & (I2C_M_RD | I2C_M_NOSTART)) == I2C_M_NOSTART);
+        i--;
+
+        if(wlen < 1)
+        {
+            continue;
+        }
+
+        p_sim->cur_reg = wbuf[0] % SIM_NUM_REGS;
+
+        if(wlen < 2)
+        {
+            continue;
+        }
+
+        count = wbuf[1];
+        if(count > wlen - 2)
+        {
+            count = wlen - 2;
+        }
+
+        sim_write_reg(p_sim, p_sim->cur_reg, &wbuf[2], count, now);
+    }
+
+    pthread_mutex_unlock(&p_sim->lock);
+
+    return nmsgs;
+}
+
+
+s_TPS_sim *tps65987_sim_create(const s_TPS_sim_config *p_cfg)
+{
+    s_TPS_sim *p_sim;
+
+    p_sim = calloc(1, sizeof(*p_sim));
+    if(p_sim == NULL)
+    {
+        return NULL;
+    }
+
+    p_sim->cfg = *p_cfg;
+
+    p_sim->flash = malloc(p_cfg->flash_size);
+    p_sim->patch = malloc(p_cfg->flash_size);
+    if(p_sim->flash == NULL || p_sim->patch == NULL)
+    {
+        tps65987_sim_destroy(p_sim);
+        return NULL;
+    }
+
+    memset(p_sim->flash, FLASH_ERASED_VALUE, p_cfg->flash_size);
+
+    pthread_mutex_init(&p_sim->lock, NULL);
+
+    p_sim->created_us = tps65987_now_us();
+
+    p_sim->transport.name = "sim";
+    p_sim->transport.caps = TRANSPORT_CAP_NOSTART;
+    p_sim->transport.transfer = sim_transfer;
+    p_sim->transport.close = NULL;
+    p_sim->transport.priv = p_sim;
+
+    sim_boot(p_sim);
+
+    return p_sim;
+}
+
+
+void tps65987_sim_destroy(s_TPS_sim *p_sim)
+{
+    if(p_sim == NULL)
+    {
+        return;
+    }
+
+    free(p_sim->flash);
+    free(p_sim->patch);
+    free(p_sim);
+}
+
+
+s_TPS_transport *tps65987_sim_transport(s_TPS_sim *p_sim)
+{
+    return &p_sim->transport;
+}
+
+
+int tps65987_sim_load_region(s_TPS_sim *p_sim, unsigned char region, const unsigned char *data, unsigned int len)
+{
+    unsigned int addr = p_sim->cfg.region_addr[region & 0x01];
+
+    if(len > p_sim->cfg.flash_size - addr)
+    {
+        return -1;
+    }
+
+    pthread_mutex_lock(&p_sim->lock);
+    memcpy(&p_sim->flash[addr], data, len);
+    pthread_mutex_unlock(&p_sim->lock);
+
+    return 0;
+}
+
+
+/*
+* put the same image in both regions and boot from it
+*/
+int tps65987_sim_load_image_file(s_TPS_sim *p_sim, const char *file_name)
+{
+    FILE *fp;
+    unsigned char *buf;
+    long len;
+    int ret = -1;
+
+    fp = fopen(file_name, "rb");
+    if(fp == NULL)
+    {
+        return -1;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    len = ftell(fp);
+    rewind(fp);
+
+    buf = malloc(len);
+    if(buf != NULL && fread(buf, 1, len, fp) == len)
+    {
+        if(tps65987_sim_load_region(p_sim, REGION_0, buf, len) == 0 &&
+           tps65987_sim_load_region(p_sim, REGION_1, buf, len) == 0)
+        {
+            tps65987_sim_reset(p_sim);
+            ret = 0;
+        }
+    }
+
+    free(buf);
+    fclose(fp);
+
+    return ret;
+}
+
+
+unsigned char *tps65987_sim_flash(s_TPS_sim *p_sim)
+{
+    return p_sim->flash;
+}
+
+
+void tps65987_sim_reset(s_TPS_sim *p_sim)
+{
+    pthread_mutex_lock(&p_sim->lock);
+    p_sim->cmd_pending = 0;
+    p_sim->port_disable_pending = 0;
+    p_sim->patch_started = 0;
+    p_sim->reset_done_us = 0;
+    p_sim->powered_off = 0;
+    sim_boot(p_sim);
+    pthread_mutex_unlock(&p_sim->lock);
+}
@@ -0,0 +1,72 @@
+/**
+*  @file      tps65987_sim.h
+*  @brief     simulated tps65987 behind the i2c transport
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#ifndef TPS65987_SIM_H
+#define TPS65987_SIM_H
+
+#include "tps65987_transport.h"
+
+#define  SIM_NUM_REGS           0x80
+#define  SIM_REG_SIZE           64
+
+#define  SIM_FLASH_SIZE         0x40000
+#define  SIM_REGION0_ADDR       0x2000
+#define  SIM_REGION1_ADDR       0x20000
+
+
+typedef struct
+{
+    unsigned char   i2c_addr;
+
+    unsigned int    flash_size;
+    unsigned int    region_addr[2];
+
+    unsigned char   customer_use;
+    unsigned int    version;
+
+    /*
+    * 4CC execution time in us, FLem is per 4k sector
+    */
+    unsigned int    flrr_us;
+    unsigned int    flem_us;
+    unsigned int    flad_us;
+    unsigned int    flwd_us;
+    unsigned int    flrd_us;
+    unsigned int    flvy_us;
+    unsigned int    ptc_us;
+
+    unsigned int    reset_us;           //GAID until the device answers again
+    unsigned int    port_disable_us;    //PORTCONFIG write until the port reports disabled
+
+    unsigned int    bus_hz;             //0: bus time is not modelled
+
+    unsigned int    plug_toggle_us;     //!= 0: the cable is detached / attached again every plug_toggle_us
+
+    unsigned int    power_cut_after_flwd;   //!= 0: power is lost after that many FLwd, until tps65987_sim_reset()
+
+    unsigned int    flwd_error_every;       //!= 0: every that many FLwd only half the chunk is programmed and it fails
+    unsigned int    flwd_error_burst;       //... and so do the FLwd retries after it, up to this many in a row
+} s_TPS_sim_config;
+
+
+typedef struct s_TPS_sim s_TPS_sim;
+
+
+void tps65987_sim_default_config(s_TPS_sim_config *p_cfg);
+
+s_TPS_sim *tps65987_sim_create(const s_TPS_sim_config *p_cfg);
+void tps65987_sim_destroy(s_TPS_sim *p_sim);
+
+s_TPS_transport *tps65987_sim_transport(s_TPS_sim *p_sim);
+
+int tps65987_sim_load_region(s_TPS_sim *p_sim, unsigned char region, const unsigned char *data, unsigned int len);
+int tps65987_sim_load_image_file(s_TPS_sim *p_sim, const char *file_name);
+unsigned char *tps65987_sim_flash(s_TPS_sim *p_sim);
+void tps65987_sim_reset(s_TPS_sim *p_sim);
+
+#endif
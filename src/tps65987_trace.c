@@ -0,0 +1,223 @@
+/**
+*  @file      tps65987_trace.c
+*  @brief     tps65987 binary transaction trace
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+/*
+* Multi-producer ring: a producer claims a slot with one fetch_add on head
+* and publishes it by storing the claiming position + 1 into the slot's
+* seq. The flush thread copies a slot only when seq matches the position it
+* expects and checks seq again afterwards; a slot that was overwritten
+* meanwhile (ring wrapped because the flush fell behind) is counted as
+* dropped, producers never wait.
+*/
+
+#include<stdio.h>
+#include<string.h>
+#include<time.h>
+#include<pthread.h>
+#include<stdatomic.h>
+
+#include "tps65987_trace.h"
+#include "tps65987_latency.h"
+
+typedef struct
+{
+    atomic_ullong       seq;
+    s_TPS_trace_rec     rec;
+} s_TPS_trace_slot;
+
+static s_TPS_trace_slot trace_ring[TRACE_RING_SIZE];
+static atomic_ullong trace_head;
+
+static unsigned long long trace_tail;
+static atomic_ullong trace_dropped;     //written by the flush thread, read by anyone
+
+static FILE *trace_fp = NULL;
+static pthread_t trace_thread;
+static atomic_int trace_running;
+
+
+static uint64_t trace_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+
+void tps65987_trace_rec(uint8_t op, uint8_t addr, uint8_t reg, uint8_t len, int result,
+                        const unsigned char *data, unsigned int ndata)
+{
+    unsigned long long pos;
+    s_TPS_trace_slot *p_slot;
+
+    pos = atomic_fetch_add_explicit(&trace_head, 1, memory_order_relaxed);
+    p_slot = &trace_ring[pos & (TRACE_RING_SIZE - 1)];
+
+    //mark the slot busy before touching the record
+    atomic_store_explicit(&p_slot->seq, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    if(ndata > TRACE_DATA_SIZE)
+    {
+        ndata = TRACE_DATA_SIZE;
+    }
+
+    p_slot->rec.ts_ns = trace_now_ns();
+    p_slot->rec.op = op;
+    p_slot->rec.addr = addr;
+    p_slot->rec.reg = reg;
+    p_slot->rec.len = len;
+    p_slot->rec.result = result < INT16_MIN ? INT16_MIN : (result > INT16_MAX ? INT16_MAX : result);
+    p_slot->rec.ndata = ndata;
+    p_slot->rec.reserved = 0;
+    if(ndata != 0)
+    {
+        memcpy(p_slot->rec.data, data, ndata);
+    }
+
+    atomic_store_explicit(&p_slot->seq, pos + 1, memory_order_release);
+}
+
+
+/*
+* copy out everything published since the last call, 0 when the ring is empty
+*/
+static int trace_drain(void)
+{
+    unsigned long long head;
+    unsigned long long seq;
+    s_TPS_trace_slot *p_slot;
+    s_TPS_trace_rec rec;
+    int n = 0;
+
+    head = atomic_load_explicit(&trace_head, memory_order_acquire);
+
+    if(head - trace_tail > TRACE_RING_SIZE)
+    {
+        atomic_fetch_add_explicit(&trace_dropped, head - trace_tail - TRACE_RING_SIZE, memory_order_relaxed);
+        trace_tail = head - TRACE_RING_SIZE;
+    }
+
+    while(trace_tail != head)
+    {
+        p_slot = &trace_ring[trace_tail & (TRACE_RING_SIZE - 1)];
+
+        seq = atomic_load_explicit(&p_slot->seq, memory_order_acquire);
+        if(seq == 0)
+        {
+            //claimed, not published yet
+            break;
+        }
+
+        if(seq == trace_tail + 1)
+        {
+            rec = p_slot->rec;
+            atomic_thread_fence(memory_order_acquire);
+
+            if(atomic_load_explicit(&p_slot->seq, memory_order_relaxed) == seq)
+            {
+                if(trace_fp != NULL)
+                {
+                    fwrite(&rec, sizeof(rec), 1, trace_fp);
+                }
+                n++;
+            }
+            else
+            {
+                atomic_fetch_add_explicit(&trace_dropped, 1, memory_order_relaxed);
+            }
+        }
+        else
+        {
+            atomic_fetch_add_explicit(&trace_dropped, 1, memory_order_relaxed);
+        }
+
+        trace_tail++;
+    }
+
+    return n;
+}
+
+
+static void *trace_flush_thread(void *arg)
+{
+    while(atomic_load(&trace_running))
+    {
+        if(trace_drain() == 0)
+        {
+            tps65987_sleep_us(TRACE_FLUSH_US);
+        }
+    }
+
+    return NULL;
+}
+
+
+int tps65987_trace_start(const char *file_name)
+{
+    s_TPS_trace_file_hdr hdr;
+
+    if(trace_fp != NULL)
+    {
+        return -1;
+    }
+
+    trace_fp = fopen(file_name, "wb");
+    if(trace_fp == NULL)
+    {
+        printf("fail to open trace file %s\n", file_name);
+        return -1;
+    }
+
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, TRACE_FILE_MAGIC, 4);
+    hdr.version = TRACE_FILE_VERSION;
+    hdr.rec_size = sizeof(s_TPS_trace_rec);
+    hdr.start_ns = trace_now_ns();
+    fwrite(&hdr, sizeof(hdr), 1, trace_fp);
+
+    //records from before the start are not written
+    trace_tail = atomic_load(&trace_head);
+    atomic_store(&trace_dropped, 0);
+
+    atomic_store(&trace_running, 1);
+    if(pthread_create(&trace_thread, NULL, trace_flush_thread, NULL) != 0)
+    {
+        atomic_store(&trace_running, 0);
+        fclose(trace_fp);
+        trace_fp = NULL;
+        return -1;
+    }
+
+    return 0;
+}
+
+
+void tps65987_trace_stop(void)
+{
+    if(trace_fp == NULL)
+    {
+        return;
+    }
+
+    atomic_store(&trace_running, 0);
+    pthread_join(trace_thread, NULL);
+
+    while(trace_drain() != 0);
+
+    fclose(trace_fp);
+    trace_fp = NULL;
+}
+
+
+unsigned long long tps65987_trace_dropped(void)
+{
+    return atomic_load_explicit(&trace_dropped, memory_order_relaxed);
+}
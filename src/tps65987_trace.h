@@ -0,0 +1,95 @@
+/**
+*  @file      tps65987_trace.h
+*  @brief     tps65987 binary transaction trace
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#ifndef TPS65987_TRACE_H
+#define TPS65987_TRACE_H
+
+#include<stdint.h>
+
+/*
+* Bus transactions are traced as fixed 32 byte records into a lock-free
+* ring instead of being printed. A flush thread started by
+* tps65987_trace_start() writes the ring to a binary file, which
+* tools/tps65987_trace_decode.py turns back into a readable log.
+*
+* TPS_TRACE_LEVEL selects at build time what is traced, everything above
+* it compiles to nothing:
+*   0  off
+*   1  failed transactions
+*   2  every transaction, 4CC completion (default)
+*/
+#define  TRACE_LEVEL_OFF        0
+#define  TRACE_LEVEL_ERROR      1
+#define  TRACE_LEVEL_XFER       2
+
+#ifndef TPS_TRACE_LEVEL
+#define TPS_TRACE_LEVEL         TRACE_LEVEL_XFER
+#endif
+
+#define  TRACE_RING_SIZE        4096    //records, power of 2
+#define  TRACE_DATA_SIZE        16      //data bytes kept per record
+#define  TRACE_FLUSH_US         20000
+
+#define  TRACE_FILE_MAGIC       "TPST"
+#define  TRACE_FILE_VERSION     1
+
+enum TRACE_OP
+{
+    TRACE_OP_WRITE = 1,     //reg, len, data = bytes after reg/len
+    TRACE_OP_READ,          //reg, len, data = register content
+    TRACE_OP_4CC,           //data = cmd, u32 us until complete; result = 4CC status
+};
+
+typedef struct
+{
+    uint64_t    ts_ns;      //CLOCK_MONOTONIC
+    uint8_t     op;
+    uint8_t     addr;
+    uint8_t     reg;
+    uint8_t     len;
+    int16_t     result;
+    uint8_t     ndata;
+    uint8_t     reserved;
+    uint8_t     data[TRACE_DATA_SIZE];
+} s_TPS_trace_rec;
+
+/*
+* file layout: header, then s_TPS_trace_rec records in order
+*/
+typedef struct
+{
+    char        magic[4];
+    uint16_t    version;
+    uint16_t    rec_size;
+    uint64_t    start_ns;
+} s_TPS_trace_file_hdr;
+
+
+void tps65987_trace_rec(uint8_t op, uint8_t addr, uint8_t reg, uint8_t len, int result,
+                        const unsigned char *data, unsigned int ndata);
+
+int tps65987_trace_start(const char *file_name);
+void tps65987_trace_stop(void);
+unsigned long long tps65987_trace_dropped(void);
+
+
+#if TPS_TRACE_LEVEL >= TRACE_LEVEL_XFER
+#define TPS_TRACE_XFER(op, addr, reg, len, result, data, ndata) \
+    tps65987_trace_rec(op, addr, reg, len, result, data, ndata)
+#else
+#define TPS_TRACE_XFER(op, addr, reg, len, result, data, ndata) do {} while(0)
+#endif
+
+#if TPS_TRACE_LEVEL >= TRACE_LEVEL_ERROR
+#define TPS_TRACE_ERROR(op, addr, reg, len, result, data, ndata) \
+    tps65987_trace_rec(op, addr, reg, len, result, data, ndata)
+#else
+#define TPS_TRACE_ERROR(op, addr, reg, len, result, data, ndata) do {} while(0)
+#endif
+
+#endif
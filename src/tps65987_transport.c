@@ -0,0 +1,117 @@
+/**
+*  @file      tps65987_transport.c
+*  @brief     tps65987 i2c transport
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#include<stdio.h>
+#include<stdlib.h>
+#include<unistd.h>
+#include<sys/ioctl.h>
+
+#include<linux/i2c.h>
+#include<linux/i2c-dev.h>
+
+#include "tps65987_transport.h"
+
+//the transport of the default controller, see tps65987_default_dev()
+static s_TPS_transport *transport = NULL;
+
+
+void tps65987_set_transport(s_TPS_transport *p_transport)
+{
+    transport = p_transport;
+}
+
+
+s_TPS_transport *tps65987_get_transport(void)
+{
+    return transport;
+}
+
+
+int tps65987_transfer(s_TPS_transport *p_transport, struct i2c_msg *msgs, int nmsgs)
+{
+    int ret;
+    int i;
+
+    if(p_transport == NULL)
+    {
+        printf("no i2c transport\n");
+        return -1;
+    }
+
+    ret = p_transport->transfer(p_transport->priv, msgs, nmsgs);
+
+    p_transport->transfers++;
+    p_transport->msgs += nmsgs;
+    for(i = 0; i < nmsgs; i++)
+    {
+        p_transport->bytes += msgs[i].len;
+    }
+
+    if(ret < 0)
+    {
+        p_transport->errors++;
+    }
+
+    return ret;
+}
+
+
+void tps65987_close_transport(void)
+{
+    if(transport != NULL && transport->close != NULL)
+    {
+        transport->close(transport->priv);
+    }
+
+    transport = NULL;
+}
+
+
+/*
+* linux i2c-dev, one I2C_RDWR ioctl per transfer
+*/
+static int i2cdev_transfer(void *priv, struct i2c_msg *msgs, int nmsgs)
+{
+    struct i2c_rdwr_ioctl_data data;
+
+    data.msgs = msgs;
+    data.nmsgs = nmsgs;
+
+    return ioctl((int)(long)priv, I2C_RDWR, &data);
+}
+
+
+static void i2cdev_close(void *priv)
+{
+    close((int)(long)priv);
+}
+
+
+s_TPS_transport *tps65987_i2cdev_transport(int fd)
+{
+    s_TPS_transport *p_i2cdev;
+    unsigned long funcs = 0;
+
+    p_i2cdev = calloc(1, sizeof(*p_i2cdev));
+    if(p_i2cdev == NULL)
+    {
+        return NULL;
+    }
+
+    if(ioctl(fd, I2C_FUNCS, &funcs) == 0 && (funcs & I2C_FUNC_NOSTART))
+    {
+        p_i2cdev->caps |= TRANSPORT_CAP_NOSTART;
+    }
+
+    p_i2cdev->name = "i2c-dev";
+    p_i2cdev->transfer = i2cdev_transfer;
+    p_i2cdev->close = i2cdev_close;
+    p_i2cdev->priv = (void *)(long)fd;
+
+    return p_i2cdev;
+}
@@ -0,0 +1,48 @@
+/**
+*  @file      tps65987_transport.h
+*  @brief     tps65987 i2c transport
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#ifndef TPS65987_TRANSPORT_H
+#define TPS65987_TRANSPORT_H
+
+#include<linux/i2c.h>
+
+/*
+* One transport is one bus, shared by every controller on it.
+* Everything the driver puts on the bus goes through one transfer() call,
+* which has the semantics of one I2C_RDWR ioctl: the messages are sent as
+* one combined transaction, read messages are filled in, 0 on success and
+* < 0 on error (NACK, timeout, ...).
+*/
+#define  TRANSPORT_CAP_NOSTART      0x01    //I2C_M_NOSTART messages are supported
+
+typedef struct
+{
+    const char  *name;
+    unsigned int caps;
+
+    int         (*transfer)(void *priv, struct i2c_msg *msgs, int nmsgs);
+    void        (*close)(void *priv);
+
+    void        *priv;
+
+    //statistics, kept by tps65987_transfer()
+    unsigned long long  transfers;
+    unsigned long long  msgs;
+    unsigned long long  bytes;
+    unsigned long long  errors;
+} s_TPS_transport;
+
+
+void tps65987_set_transport(s_TPS_transport *p_transport);
+s_TPS_transport *tps65987_get_transport(void);
+int tps65987_transfer(s_TPS_transport *p_transport, struct i2c_msg *msgs, int nmsgs);
+void tps65987_close_transport(void);
+
+s_TPS_transport *tps65987_i2cdev_transport(int fd);
+
+#endif
@@ -0,0 +1,226 @@
+/**
+*  @file      tps65987_xact.c
+*  @brief     tps65987 multi-message i2c transactions
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#include<stdio.h>
+#include<string.h>
+
+#include "tps65987_xact.h"
+#include "tps65987_trace.h"
+
+
+void tps65987_xact_init(s_TPS_xact *p_xact, s_TPS_transport *p_transport, unsigned char addr)
+{
+    p_xact->transport = p_transport;
+    p_xact->addr = addr;
+    p_xact->nops = 0;
+    p_xact->nmsgs = 0;
+    p_xact->bounce_used = 0;
+    p_xact->overflow = 0;
+}
+
+
+static void add_msg(s_TPS_xact *p_xact, unsigned short flags, unsigned char *buf, unsigned short len)
+{
+    struct i2c_msg *p_msg = &p_xact->msgs[p_xact->nmsgs++];
+
+    p_msg->addr = p_xact->addr;
+    p_msg->flags = flags;
+    p_msg->len = len;
+    p_msg->buf = buf;
+}
+
+
+static int nostart(s_TPS_xact *p_xact)
+{
+    return p_xact->transport != NULL && (p_xact->transport->caps & TRANSPORT_CAP_NOSTART);
+}
+
+
+static unsigned char *bounce_alloc(s_TPS_xact *p_xact, unsigned int len)
+{
+    unsigned char *buf;
+
+    if(p_xact->bounce_used + len > XACT_BOUNCE_SIZE)
+    {
+        return NULL;
+    }
+
+    buf = &p_xact->bounce[p_xact->bounce_used];
+    p_xact->bounce_used += len;
+
+    return buf;
+}
+
+
+static s_TPS_xact_op *add_op(s_TPS_xact *p_xact, unsigned char op, unsigned char reg, unsigned char *data, unsigned char len)
+{
+    s_TPS_xact_op *p_op;
+
+    if(p_xact->nops == XACT_MAX_OPS)
+    {
+        p_xact->overflow = 1;
+        return NULL;
+    }
+
+    p_op = &p_xact->ops[p_xact->nops++];
+    p_op->op = op;
+    p_op->reg = reg;
+    p_op->len = len;
+    p_op->data = data;
+    p_op->bounce = NULL;
+
+    return p_op;
+}
+
+
+/*
+* [reg, len, data...]
+*/
+int tps65987_xact_write(s_TPS_xact *p_xact, unsigned char reg, unsigned char *data, unsigned char len)
+{
+    unsigned char *hdr;
+    unsigned char *buf;
+    int idx = p_xact->nops;
+
+    if(add_op(p_xact, TRACE_OP_WRITE, reg, data, len) == NULL)
+    {
+        return -1;
+    }
+
+    hdr = p_xact->hdr[idx];
+    hdr[0] = reg;
+    hdr[1] = len;
+
+    if(len == 0)
+    {
+        add_msg(p_xact, 0, hdr, 2);
+        return 0;
+    }
+
+    if(nostart(p_xact))
+    {
+        add_msg(p_xact, 0, hdr, 2);
+        add_msg(p_xact, I2C_M_NOSTART, data, len);
+        return 0;
+    }
+
+    buf = bounce_alloc(p_xact, len + 2);
+    if(buf == NULL)
+    {
+        p_xact->overflow = 1;
+        return -1;
+    }
+
+    memcpy(buf, hdr, 2);
+    memcpy(&buf[2], data, len);
+    add_msg(p_xact, 0, buf, len + 2);
+
+    return 0;
+}
+
+
+/*
+* a write that is already laid out as [reg, len, data...]
+*/
+int tps65987_xact_write_frame(s_TPS_xact *p_xact, unsigned char *frame, unsigned char len)
+{
+    if(len < 2 || add_op(p_xact, TRACE_OP_WRITE, frame[0], &frame[2], len - 2) == NULL)
+    {
+        p_xact->overflow = 1;
+        return -1;
+    }
+
+    add_msg(p_xact, 0, frame, len);
+
+    return 0;
+}
+
+
+/*
+* 'len' bytes of register 'reg' into val, the byte count the device sends
+* first is dropped
+*/
+int tps65987_xact_read(s_TPS_xact *p_xact, unsigned char reg, unsigned char *val, unsigned char len)
+{
+    s_TPS_xact_op *p_op;
+    unsigned char *hdr;
+    int idx = p_xact->nops;
+
+    p_op = add_op(p_xact, TRACE_OP_READ, reg, val, len);
+    if(p_op == NULL)
+    {
+        return -1;
+    }
+
+    hdr = p_xact->hdr[idx];
+    hdr[0] = reg;
+
+    add_msg(p_xact, 0, hdr, 1);
+
+    /*
+    * one read message for count and data, even with I2C_M_NOSTART: the master
+    * NACKs the last byte of every read message and the controller stops there
+    */
+    p_op->bounce = bounce_alloc(p_xact, len + 1);
+    if(p_op->bounce == NULL)
+    {
+        p_xact->overflow = 1;
+        return -1;
+    }
+
+    add_msg(p_xact, I2C_M_RD, p_op->bounce, len + 1);
+
+    return 0;
+}
+
+
+int tps65987_xact_run(s_TPS_xact *p_xact)
+{
+    s_TPS_xact_op *p_op;
+    int ret;
+    int i;
+
+    if(p_xact->overflow)
+    {
+        printf("i2c transaction too large\n");
+        return -1;
+    }
+
+    if(p_xact->nmsgs == 0)
+    {
+        return 0;
+    }
+
+    ret = tps65987_transfer(p_xact->transport, p_xact->msgs, p_xact->nmsgs);
+
+    for(i = 0; i < p_xact->nops; i++)
+    {
+        p_op = &p_xact->ops[i];
+
+        if(ret < 0)
+        {
+            TPS_TRACE_ERROR(p_op->op, p_xact->addr, p_op->reg, p_op->len, ret, NULL, 0);
+            continue;
+        }
+
+        if(p_op->bounce != NULL)
+        {
+            memcpy(p_op->data, &p_op->bounce[1], p_op->len);
+        }
+
+        TPS_TRACE_XFER(p_op->op, p_xact->addr, p_op->reg, p_op->len, 0, p_op->data, p_op->len);
+    }
+
+    if(ret < 0)
+    {
+        printf("i2c transaction err %d\n", ret);
+        return ret;
+    }
+
+    return 0;
+}
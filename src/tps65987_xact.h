@@ -0,0 +1,63 @@
+/**
+*  @file      tps65987_xact.h
+*  @brief     tps65987 multi-message i2c transactions
+*  @author    Link Lin
+*  @date      10 -2026
+*  @copyright
+*/
+
+#ifndef TPS65987_XACT_H
+#define TPS65987_XACT_H
+
+#include "tps65987_transport.h"
+
+/*
+* Several register accesses sent as one transfer (one I2C_RDWR ioctl).
+*
+* A register write goes out as [reg, len] followed by the caller's data as an
+* I2C_M_NOSTART message, so nothing is copied; without TRANSPORT_CAP_NOSTART
+* it goes through the bounce buffer instead. A read is [reg] and one read
+* message of the byte count and the data into the bounce buffer.
+*
+* Buffers handed in must stay valid until tps65987_xact_run() returns.
+*/
+#define  XACT_MAX_OPS           6
+#define  XACT_MAX_MSGS          (XACT_MAX_OPS * 3)
+#define  XACT_BOUNCE_SIZE       (XACT_MAX_OPS * 80)
+
+typedef struct
+{
+    unsigned char   op;             //TRACE_OP_WRITE / TRACE_OP_READ
+    unsigned char   reg;
+    unsigned char   len;
+    unsigned char   *data;
+
+    unsigned char   *bounce;        //!= NULL: read lands here and is copied to data
+} s_TPS_xact_op;
+
+typedef struct
+{
+    s_TPS_transport     *transport;
+    unsigned char       addr;
+
+    s_TPS_xact_op       ops[XACT_MAX_OPS];
+    int                 nops;
+
+    struct i2c_msg      msgs[XACT_MAX_MSGS];
+    int                 nmsgs;
+
+    unsigned char       hdr[XACT_MAX_OPS][2];   //[reg, len] of a write, [reg] of a read
+    unsigned char       bounce[XACT_BOUNCE_SIZE];
+    unsigned int        bounce_used;
+
+    int                 overflow;
+} s_TPS_xact;
+
+
+void tps65987_xact_init(s_TPS_xact *p_xact, s_TPS_transport *p_transport, unsigned char addr);
+int tps65987_xact_write(s_TPS_xact *p_xact, unsigned char reg, unsigned char *data, unsigned char len);
+int tps65987_xact_write_frame(s_TPS_xact *p_xact, unsigned char *frame, unsigned char len);
+int tps65987_xact_read(s_TPS_xact *p_xact, unsigned char reg, unsigned char *val, unsigned char len);
+int tps65987_xact_run(s_TPS_xact *p_xact);
+
+#endif
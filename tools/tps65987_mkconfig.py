@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+#
+# Extract the application customization of a TI Application Customization
+# Tool project (src/M&D/TPS65987-DDH-*.pjt) into the register configuration
+# read by "tps65987-drv <addr> <bus> config <file>" (see src/tps65987_config.h):
+# one register per line, its address and then its bytes, all hex.
+#
+# INT_MASK1/2 and Port Configuration are left out: "monitor" sets the
+# interrupt masks for the events it waits for, and the upgrade disables the
+# port through Port Configuration; a config written next to them would undo
+# either.
+#
+# usage: tps65987_mkconfig.py TPS65987-DDH-08.pjt TPS65987-DDH-08.cfg
+#
+
+import json
+import os
+import sys
+
+JSON_DELIMITER = 'ACE_register_definition_metadata_json_delimiter'
+
+# INT_MASK1, INT_MASK2, Port Configuration
+SKIP_REGISTERS = (0x16, 0x17, 0x28)
+
+
+def load_registers(path):
+    with open(path, encoding='latin-1') as f:
+        text = f.read()
+
+    # the project's JSON part follows the python templates and this marker
+    start = text.index(JSON_DELIMITER) + len(JSON_DELIMITER)
+    project = json.loads(text[start:])
+    values = json.loads(project['configuration values'])
+
+    registers = {}
+    for ace in values['data']['selected_ace']:
+        if ace.get('offset', 0) != 0 or ace['register'] in SKIP_REGISTERS:
+            continue
+        registers[ace['register']] = ace['data']
+
+    return registers
+
+
+def main():
+    if len(sys.argv) != 3:
+        print('usage: %s <project.pjt> <config.cfg>' % sys.argv[0])
+        return 1
+
+    registers = load_registers(sys.argv[1])
+
+    with open(sys.argv[2], 'w') as out:
+        out.write('# %s\n' % os.path.basename(sys.argv[1]))
+        for reg in sorted(registers):
+            out.write('0x%02x %s\n' % (reg, ' '.join('%02x' % b for b in registers[reg])))
+
+    print('%d registers' % len(registers))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
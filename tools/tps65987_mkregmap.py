@@ -0,0 +1,289 @@
+#!/usr/bin/env python3
+#
+# Generate the tps65987 register map (src/tps65987_regmap.h / .c) from a
+# TI Application Customization Tool project (src/M&D/TPS65987-DDH-*.pjt).
+#
+# Every register class in the .pjt gives its address, byte length and
+# permission; every data model terminator under it a bit offset (relative to
+# its parent array) and a bit length. Fields placed by loops or generator
+# functions, and the 4CC argument mini registers, are not plain constants
+# in the .pjt and are left out.
+#
+# Some addresses have more than one register class in the .pjt (0x6C is
+# both "App configuration" and "Debug Control"). The one whose byte length
+# matches the data of the project's configuration values is kept; if that
+# doesn't settle it, nothing is generated.
+#
+# usage: tps65987_mkregmap.py src/M&D/TPS65987-DDH-02.pjt src/tps65987_regmap
+#
+
+import json
+import os
+import re
+import sys
+
+REGISTER_CLASS = re.compile(r'^class (c\w+_0x[0-9A-Fa-f]+_register)\s*\(', re.M)
+TOP_LEVEL = re.compile(r'^(?:class|def) ', re.M)
+REGISTER_DICT = re.compile(r"'register name'\s*:\s*'([^']*)'\s*,\s*'address'\s*:\s*(0x[0-9A-Fa-f]+|\d+)\s*,"
+                           r"\s*'byte length'\s*:\s*(\d+)\s*,\s*'permission'\s*:\s*'(\w+)'")
+NODE = re.compile(r'([\w.]+)\s*=\s*register_class\.(c\w+)\(\s*self\s*,\s*(?:\d+\s*,\s*)?\{(.*?)\}', re.S)
+ADD_CHILD = re.compile(r'([\w.]+)\.addChild\(\s*(\w+)\s*\)')
+NAME = re.compile(r"'name'\s*:\s*'([^']*)'")
+OFFSET = re.compile(r"'offset'\s*:\s*(\d+)\s*[,}]?\s*$", re.M)
+BITS = re.compile(r"'bit length'\s*:\s*(\d+)\s*[,}]?\s*$", re.M)
+
+JSON_DELIMITER = 'ACE_register_definition_metadata_json_delimiter'
+
+ROOT = 'self.dataModel'
+ACCESSOR_MAX_BITS = 32
+
+
+def c_name(text):
+    name = re.sub(r'[^0-9A-Za-z]+', '_', text).strip('_').upper()
+    return name if not name[:1].isdigit() else '_' + name
+
+
+def parse_register(body):
+    m = REGISTER_DICT.search(body)
+    if m is None:
+        return None
+
+    reg = {'name': m.group(1), 'addr': int(m.group(2), 0), 'len': int(m.group(3)),
+           'perm': m.group(4), 'fields': []}
+
+    # walk definitions and addChild() in source order: variable names are reused
+    nodes = {}
+    events = [(m.start(), 'node', m) for m in NODE.finditer(body)]
+    events += [(m.start(), 'child', m) for m in ADD_CHILD.finditer(body)]
+    events.sort(key=lambda e: e[0])
+
+    for _, kind, m in events:
+        if kind == 'node':
+            args = m.group(3)
+            name = NAME.search(args)
+            offset = OFFSET.search(args)
+            bits = BITS.search(args)
+            nodes[m.group(1)] = {
+                'name': name.group(1) if name else None,
+                'offset': int(offset.group(1)) if offset else None,
+                'bits': int(bits.group(1)) if bits else None,
+                'terminator': m.group(2).endswith('DMTerminator'),
+                'parent': None,
+            }
+        elif m.group(2) in nodes:
+            child = nodes[m.group(2)]
+            parent = nodes.get(m.group(1))
+            child['parent'] = 'root' if m.group(1) == ROOT else parent
+            if child['terminator']:
+                add_field(reg, child)
+
+    return reg
+
+
+def add_field(reg, node):
+    if node['name'] is None or node['bits'] is None or node['offset'] is None:
+        return
+    if node['name'].lower().startswith('reserved'):
+        return
+
+    offset = node['offset']
+    parent = node['parent']
+    while parent != 'root':
+        if parent is None or parent['offset'] is None:
+            return
+        offset += parent['offset']
+        parent = parent['parent']
+
+    if offset + node['bits'] > reg['len'] * 8:
+        return
+
+    name = c_name(node['name'])
+    used = [f['name'] for f in reg['fields']]
+    if name in used:
+        n = 2
+        while '%s_%d' % (name, n) in used:
+            n += 1
+        name = '%s_%d' % (name, n)
+
+    reg['fields'].append({'name': name, 'offset': offset, 'bits': node['bits'], 'desc': node['name']})
+
+
+def configured_lengths(text):
+    # the project's JSON part follows the python templates and this marker
+    start = text.find(JSON_DELIMITER)
+    if start < 0:
+        return {}
+
+    project = json.loads(text[start + len(JSON_DELIMITER):])
+    values = json.loads(project['configuration values'])
+
+    return {ace['register']: len(ace['data']) for ace in values['data']['selected_ace']
+            if ace.get('offset', 0) == 0}
+
+
+def drop_duplicates(registers, lengths):
+    by_addr = {}
+    for reg in registers:
+        by_addr.setdefault(reg['addr'], []).append(reg)
+
+    for addr, regs in sorted(by_addr.items()):
+        if len(regs) == 1:
+            continue
+
+        keep = [r for r in regs if r['len'] == lengths.get(addr)]
+        names = ', '.join('%s (%d bytes)' % (r['name'], r['len']) for r in regs)
+        if len(keep) != 1:
+            raise SystemExit('0x%02X: %s share the address and the configuration doesn\'t tell which one' %
+                             (addr, names))
+
+        print('0x%02X: %s, keeping %s' % (addr, names, keep[0]['name']))
+        registers[:] = [r for r in registers if r['addr'] != addr or r is keep[0]]
+
+
+def parse_pjt(text):
+    registers = []
+    starts = [m.start() for m in TOP_LEVEL.finditer(text)] + [len(text)]
+
+    for m in REGISTER_CLASS.finditer(text):
+        end = next(s for s in starts if s > m.start())
+        reg = parse_register(text[m.start():end])
+        if reg is not None:
+            registers.append(reg)
+
+    registers.sort(key=lambda r: r['addr'])
+    drop_duplicates(registers, configured_lengths(text))
+
+    names = set()
+    for reg in registers:
+        reg['cname'] = c_name(reg['name'])
+        if reg['cname'] in names:
+            reg['cname'] += '_%02X' % reg['addr']
+        names.add(reg['cname'])
+
+    return registers
+
+
+def write_header(registers, source, out):
+    w = out.write
+
+    w('/**\n*  @file      tps65987_regmap.h\n*  @brief     tps65987 register map, generated from %s\n'
+      '*  @author    Link Lin\n*  @date      10 -2026\n*  @copyright\n*/\n\n' % source)
+    w('/*\n* DO NOT EDIT: tools/tps65987_mkregmap.py %s\n*\n' % source)
+    w('* Fields are read from the little-endian register buffer with shifts and\n'
+      '* masks, so unlike the bitfield structs in tps65987_drv.h they don\'t depend\n'
+      '* on the host byte order or the compiler\'s bitfield layout. With constant\n'
+      '* offsets every accessor folds into a load, a shift and a mask.\n*/\n\n')
+    w('#ifndef TPS65987_REGMAP_H\n#define TPS65987_REGMAP_H\n\n')
+
+    w('#define  TPS_REG_READ            0x01\n')
+    w('#define  TPS_REG_WRITE           0x02\n')
+    w('#define  TPS_REG_DEVICE          0x04    //D*: one per controller, not per port\n\n')
+    w('#define  TPS_REGMAP_NUM          %d\n\n\n' % len(registers))
+
+    w('typedef struct\n{\n'
+      '    const char      *name;\n'
+      '    unsigned char   addr;\n'
+      '    unsigned char   len;            //bytes, without the byte count\n'
+      '    unsigned char   perm;           //TPS_REG_*\n'
+      '    unsigned char   num_fields;\n'
+      '} s_TPS_regdesc;\n\n')
+    w('extern const s_TPS_regdesc tps65987_regmap[TPS_REGMAP_NUM];\n\n')
+    w('const s_TPS_regdesc *tps65987_regmap_find(unsigned char addr);\n\n\n')
+
+    w('static inline unsigned int tps65987_field_get(const unsigned char *buf, unsigned int offset, unsigned int bits)\n'
+      '{\n'
+      '    unsigned long long v = 0;\n'
+      '    unsigned int i;\n\n'
+      '    for(i = offset / 8; i <= (offset + bits - 1) / 8; i++)\n'
+      '    {\n'
+      '        v |= (unsigned long long)buf[i] << (8 * (i - offset / 8));\n'
+      '    }\n\n'
+      '    return (unsigned int)((v >> (offset % 8)) & ((1ULL << bits) - 1));\n'
+      '}\n\n\n')
+    w('static inline void tps65987_field_set(unsigned char *buf, unsigned int offset, unsigned int bits, unsigned int value)\n'
+      '{\n'
+      '    unsigned long long mask = ((1ULL << bits) - 1) << (offset % 8);\n'
+      '    unsigned long long v = ((unsigned long long)value << (offset % 8)) & mask;\n'
+      '    unsigned int i;\n\n'
+      '    for(i = offset / 8; i <= (offset + bits - 1) / 8; i++)\n'
+      '    {\n'
+      '        buf[i] = (buf[i] & ~(unsigned char)(mask >> (8 * (i - offset / 8)))) | (unsigned char)(v >> (8 * (i - offset / 8)));\n'
+      '    }\n'
+      '}\n\n')
+
+    for reg in registers:
+        w('\n/*\n* 0x%02X %s, %d bytes, %s\n*/\n' % (reg['addr'], reg['name'], reg['len'], reg['perm']))
+        w('#define  %-48s 0x%02X\n' % ('TPS_REG_%s' % reg['cname'], reg['addr']))
+        w('#define  %-48s %d\n' % ('TPS_REG_%s_LEN' % reg['cname'], reg['len']))
+
+        for f in reg['fields']:
+            macro = 'TPS_%s_%s' % (reg['cname'], f['name'])
+            w('#define  %-48s %d, %d\n' % (macro, f['offset'], f['bits']))
+
+        writable = 'W' in reg['perm']
+        for f in reg['fields']:
+            if f['bits'] > ACCESSOR_MAX_BITS:
+                continue
+            fn = ('%s_%s' % (reg['cname'], f['name'])).lower()
+            macro = 'TPS_%s_%s' % (reg['cname'], f['name'])
+            w('static inline unsigned int tps65987_%s(const unsigned char *buf) '
+              '{ return tps65987_field_get(buf, %s); }\n' % (fn, macro))
+            if writable:
+                w('static inline void tps65987_set_%s(unsigned char *buf, unsigned int v) '
+                  '{ tps65987_field_set(buf, %s, v); }\n' % (fn, macro))
+
+    w('\n#endif\n')
+
+
+def write_source(registers, source, out):
+    w = out.write
+
+    w('/**\n*  @file      tps65987_regmap.c\n*  @brief     tps65987 register map, generated from %s\n'
+      '*  @author    Link Lin\n*  @date      10 -2026\n*  @copyright\n*/\n\n' % source)
+    w('//DO NOT EDIT: tools/tps65987_mkregmap.py %s\n\n' % source)
+    w('#include<stddef.h>\n\n#include "tps65987_regmap.h"\n\n\n')
+
+    w('const s_TPS_regdesc tps65987_regmap[TPS_REGMAP_NUM] =\n{\n')
+    for reg in registers:
+        perm = ['TPS_REG_READ']
+        if 'W' in reg['perm']:
+            perm.append('TPS_REG_WRITE')
+        if reg['perm'].startswith('D'):
+            perm.append('TPS_REG_DEVICE')
+        w('    { %-40s 0x%02X, %3d, %-50s %2d },\n' % ('"%s",' % reg['name'], reg['addr'], reg['len'],
+                                                     ' | '.join(perm) + ',', len(reg['fields'])))
+    w('};\n\n\n')
+
+    w('const s_TPS_regdesc *tps65987_regmap_find(unsigned char addr)\n{\n'
+      '    unsigned int i;\n\n'
+      '    for(i = 0; i < TPS_REGMAP_NUM; i++)\n'
+      '    {\n'
+      '        if(tps65987_regmap[i].addr == addr)\n'
+      '        {\n'
+      '            return &tps65987_regmap[i];\n'
+      '        }\n'
+      '    }\n\n'
+      '    return NULL;\n}\n')
+
+
+def main():
+    if len(sys.argv) != 3:
+        print('usage: %s <project.pjt> <out prefix>' % sys.argv[0])
+        return 1
+
+    with open(sys.argv[1], encoding='latin-1') as f:
+        registers = parse_pjt(f.read())
+
+    source = os.path.basename(sys.argv[1])
+
+    with open(sys.argv[2] + '.h', 'w') as out:
+        write_header(registers, source, out)
+    with open(sys.argv[2] + '.c', 'w') as out:
+        write_source(registers, source, out)
+
+    print('%d registers, %d fields' % (len(registers), sum(len(r['fields']) for r in registers)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+#
+# Convert a tps65987 flash image (.bin) into the sparse image format read by
+# tps65987-drv (see SPARSE_IMAGE_MAGIC in src/tps65987_drv.h).
+# Every 64 byte chunk that is all 0xFF is left out of the file.
+#
+# usage: tps65987_mksparse.py low-region-flash-08.bin low-region-flash-08.sparse
+#
+
+import struct
+import sys
+
+CHUNK_SIZE = 64
+ERASED = b'\xff' * CHUNK_SIZE
+
+
+def make_records(image):
+    records = []
+    start = None
+
+    for off in range(0, len(image), CHUNK_SIZE):
+        blank = image[off:off + CHUNK_SIZE] == ERASED[:len(image[off:off + CHUNK_SIZE])]
+
+        if not blank and start is None:
+            start = off
+        elif blank and start is not None:
+            records.append((start, image[start:off]))
+            start = None
+
+    if start is not None:
+        records.append((start, image[start:]))
+
+    return records
+
+
+def main():
+    if len(sys.argv) != 3:
+        print('usage: %s <image.bin> <image.sparse>' % sys.argv[0])
+        return 1
+
+    image = open(sys.argv[1], 'rb').read()
+    records = make_records(image)
+
+    with open(sys.argv[2], 'wb') as out:
+        out.write(b'TPSS' + struct.pack('<II', len(image), len(records)))
+        for (off, data) in records:
+            out.write(struct.pack('<II', off, len(data)))
+            out.write(data)
+
+    kept = sum(len(data) for (off, data) in records)
+    print('%s: %d bytes, %d records, %d bytes of data kept' % (sys.argv[2], len(image), len(records), kept))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+#
+# Decode a tps65987-drv binary trace (see src/tps65987_trace.h) into a
+# readable log, one line per bus transaction / 4CC completion.
+#
+# usage: tps65987_trace_decode.py /data/tps65987-trace.bin [out.txt]
+#
+
+import struct
+import sys
+
+FILE_MAGIC = b'TPST'
+HDR = struct.Struct('<4sHHQ')
+REC = struct.Struct('<QBBBBhBB16s')
+
+OP_WRITE = 1
+OP_READ = 2
+OP_4CC = 3
+
+CMD_STATUS = {0: 'done', 1: 'fail', -1: 'unrecognized/timeout'}
+CMD_SENT = 2
+
+
+def format_rec(ts_ns, start_ns, op, addr, reg, length, result, data):
+    ts = '[%12.6f]' % ((ts_ns - start_ns) / 1e9)
+
+    if op == OP_4CC:
+        cmd = data[0:4].decode('ascii', 'replace')
+        us = struct.unpack('<I', data[4:8])[0]
+        if result == CMD_SENT:
+            return '%s 4CC %s sent' % (ts, cmd)
+        return '%s 4CC %s %s after %uus' % (ts, cmd, CMD_STATUS.get(result, str(result)), us)
+
+    if op == OP_WRITE:
+        kind = 'W'
+    elif op == OP_READ:
+        kind = 'R'
+    else:
+        kind = 'op%d' % op
+
+    line = '%s %s 0x%02x reg 0x%02x len %3u' % (ts, kind, addr, reg, length)
+
+    if result < 0:
+        return '%s err %d' % (line, result)
+
+    dump = ' '.join('%02x' % b for b in data)
+    if length > len(data):
+        dump += ' ...'
+
+    return '%s: %s' % (line, dump)
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        print('usage: %s <trace.bin> [out.txt]' % sys.argv[0])
+        return 1
+
+    with open(sys.argv[1], 'rb') as f:
+        raw = f.read()
+
+    if len(raw) < HDR.size:
+        print('%s: too short' % sys.argv[1])
+        return 1
+
+    magic, version, rec_size, start_ns = HDR.unpack_from(raw, 0)
+    if magic != FILE_MAGIC or rec_size != REC.size:
+        print('%s: not a tps65987 trace (magic %r, record size %u)' % (sys.argv[1], magic, rec_size))
+        return 1
+
+    out = open(sys.argv[2], 'w') if len(sys.argv) == 3 else sys.stdout
+
+    for off in range(HDR.size, len(raw) - REC.size + 1, REC.size):
+        ts_ns, op, addr, reg, length, result, ndata, _, data = REC.unpack_from(raw, off)
+        out.write(format_rec(ts_ns, start_ns, op, addr, reg, length, result, data[:ndata]) + '\n')
+
+    if out is not sys.stdout:
+        out.close()
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())